@@ -17,11 +17,16 @@ set( configUSE_IDLE_HOOK                      1)
 set( configUSE_PORT_OPTIMISED_TASK_SELECTION  1)
 
 set( configUSE_MUTEXES                        1)
+set( configUSE_RECURSIVE_MUTEXES              1)
 set( configUSE_COUNTING_SEMAPHORES            1)
 set( configUSE_TASK_NOTIFICATIONS             1)
 set( configUSE_TASK_FPU_SUPPORT               1)
 
 #set( configUSE_TICKLESS_IDLE                  0)
+if(USE_TICKLESS_IDLE)
+# User defined vPortSuppressTicksAndSleep (see rtos.c)
+set( configUSE_TICKLESS_IDLE                  2)
+endif(USE_TICKLESS_IDLE)
 set( configCPU_CLOCK_HZ                       "SystemCoreClock" )
 set( configTICK_RATE_HZ                       1000)
 
@@ -6,7 +6,19 @@ function(display_option)
     message ("      -> USE_LPUART_COM                  : ${USE_LPUART_COM}")
 
     message ("      -> USE_PHY_TRIG                    : ${USE_PHY_TRIG}")
+    message ("      -> USE_PHY_IRQ_WAIT                : ${USE_PHY_IRQ_WAIT}")
     message ("      -> USE_PHY_LAYER_TRACE             : ${USE_PHY_LAYER_TRACE}")
+    message ("      -> USE_SPI_DMA                     : ${USE_SPI_DMA}")
+    message ("      -> USE_UART_RX_DMA                 : ${USE_UART_RX_DMA}")
+    message ("      -> USE_UART_TX_QUEUE               : ${USE_UART_TX_QUEUE}")
+    message ("      -> USE_TICKLESS_IDLE               : ${USE_TICKLESS_IDLE}")
+    message ("      -> USE_PHY_TIME_TRACE              : ${USE_PHY_TIME_TRACE}")
+    message ("      -> USE_SPI_BENCH                   : ${USE_SPI_BENCH}")
+    message ("      -> USE_SPI_FAST_BULK               : ${USE_SPI_FAST_BULK}")
+    message ("      -> USE_PHY_STATS                   : ${USE_PHY_STATS}")
+    message ("      -> USE_PHY_AFC_TRACK               : ${USE_PHY_AFC_TRACK}")
+    message ("      -> USE_PHY_SCHED                   : ${USE_PHY_SCHED}")
+    message ("      -> USE_PHY_LOG_CODE                : ${USE_PHY_LOG_CODE}")
     message ("      -> HAS_HIRES_TIME_MEAS             : ${HAS_HIRES_TIME_MEAS}")
     
     message ("      -> HAS_WIZE_CORE_EXTEND_PARAMETER  : ${HAS_WIZE_CORE_EXTEND_PARAMETER}")
@@ -21,6 +33,8 @@ function(display_option)
     message ("      -> HAS_ATUID_CMD                   : ${HAS_ATUID_CMD}")
     message ("      -> HAS_ATCCLK_CMD                  : ${HAS_ATCCLK_CMD}")
     message ("      -> HAS_ATSTAT_CMD                  : ${HAS_ATSTAT_CMD}")
+    message ("      -> HAS_ATSCAN_CMD                  : ${HAS_ATSCAN_CMD}")
+    message ("      -> HAS_ATPERR_CMD                  : ${HAS_ATPERR_CMD}")
     message ("      -> HAS_ATZn_CMD                    : ${HAS_ATZn_CMD}")
     
     message ("      -> HW_NAME         : ${HW_NAME}")
@@ -46,7 +60,19 @@ set(PARAM_XML_FILE_LIST "${PARAM_XML_FILE_LIST} ${DEFAULT_CFG_FILE_DIR}/LANParam
 option(USE_LPUART_COM                    "Use the LPUART as COM port (default UART4)" OFF)
 
 option(USE_PHY_TRIG                      "Use the PHY trigger pin as TX/RX command" OFF)
+option(USE_PHY_IRQ_WAIT                  "Use the PHY interrupt pin 1 to wait for state transition (instead of SPI polling)" OFF)
 option(USE_PHY_LAYER_TRACE               "Enable the PHY layer trace messages." OFF)
+option(USE_SPI_DMA                       "Use the DMA for the large PHY SPI transfers (block, configuration)." OFF)
+option(USE_UART_RX_DMA                   "Receive the AT commands in a DMA circular ring (idle line and character match events)." OFF)
+option(USE_UART_TX_QUEUE                 "Queue the console and logger transmissions, drained under interrupt (the caller doesn't wait the wire time)." OFF)
+option(USE_TICKLESS_IDLE                 "Stop the RTOS tick when idle, wake-up on the RTC wake-up timer from STOP2 (or SLEEP when STOP is not allowed)." OFF)
+option(USE_PHY_TIME_TRACE                "Enable the PHY timing trace (event ring and latency statistics, AT%PTRC command). Requires HAS_HIRES_TIME_MEAS." OFF)
+option(USE_SPI_BENCH                     "Enable the PHY SPI throughput micro-benchmark (AT%SPIB command). Requires HAS_HIRES_TIME_MEAS." OFF)
+option(USE_SPI_FAST_BULK                 "Use the fast SPI clock rate for the PHY bulk memory transfers too (default rate otherwise)." OFF)
+option(USE_PHY_STATS                     "Enable the PHY signal statistics (RSSI, noise, AFC per channel and modulation, AT%PSTA command)." ON)
+option(USE_PHY_AFC_TRACK                 "Enable the PHY frequency correction tracking from the AFC error of the received frames (stored daily)." OFF)
+option(USE_PHY_SCHED                     "Enable the PHY TX/RX scheduled at a HiResTime timestamp (trigger pin pulsed from the LPTIM1 compare). Requires USE_PHY_TRIG and HAS_HIRES_TIME_MEAS." OFF)
+option(USE_PHY_LOG_CODE                  "Keep only the numerical codes of the PHY error messages in flash (decoded on host by tools/scripts/phy_err_decode.py)." OFF)
 option(HAS_HIRES_TIME_MEAS               "Define if High-Resolution timer is present (used to get the clock on PONG message)." ON)
 option(HAS_WIZE_CORE_EXTEND_PARAMETER    "Use the low power xml file." ON)
 option(HAS_LOW_POWER_PARAMETER           "Use the low power xml file." ON)
@@ -62,6 +88,8 @@ option(HAS_ATKEY_CMD                     "ATKENC and ATKMAC are replaced by the
 option(HAS_ATUID_CMD                     "AT%UID command is defined." ON)
 option(HAS_ATCCLK_CMD                    "AT%CCLK command is defined." ON)
 option(HAS_ATSTAT_CMD                    "AT%STAT command is defined." ON)
+option(HAS_ATSCAN_CMD                    "AT%SCAN command (noise scan) is defined." ON)
+option(HAS_ATPERR_CMD                    "AT%PERR command (PHY last error codes ring) is defined." ON)
 option(HAS_ATZn_CMD                      "ATZ0 and ATZ1 command are defined." ON)
 
 # HW info
@@ -90,10 +118,56 @@ if(USE_PHY_TRIG)
 	add_compile_definitions(USE_PHY_TRIG=1)
 endif(USE_PHY_TRIG)
 #-------------------------------------------------------------------------------
+if(USE_PHY_IRQ_WAIT)
+	add_compile_definitions(USE_PHY_IRQ_WAIT=1)
+endif(USE_PHY_IRQ_WAIT)
+#-------------------------------------------------------------------------------
 if(USE_PHY_LAYER_TRACE)
 	add_compile_definitions(USE_PHY_LAYER_TRACE=1)
 endif(USE_PHY_LAYER_TRACE)
 #-------------------------------------------------------------------------------
+if(USE_SPI_DMA)
+	add_compile_definitions(USE_SPI_DMA=1)
+endif(USE_SPI_DMA)
+#-------------------------------------------------------------------------------
+if(USE_UART_RX_DMA)
+	add_compile_definitions(USE_UART_RX_DMA=1)
+endif(USE_UART_RX_DMA)
+#-------------------------------------------------------------------------------
+if(USE_UART_TX_QUEUE)
+	add_compile_definitions(USE_UART_TX_QUEUE=1)
+endif(USE_UART_TX_QUEUE)
+#-------------------------------------------------------------------------------
+if(USE_TICKLESS_IDLE)
+	add_compile_definitions(USE_TICKLESS_IDLE=1)
+endif(USE_TICKLESS_IDLE)
+#-------------------------------------------------------------------------------
+if(USE_PHY_TIME_TRACE)
+	add_compile_definitions(USE_PHY_TIME_TRACE=1)
+endif(USE_PHY_TIME_TRACE)
+#-------------------------------------------------------------------------------
+if(USE_SPI_BENCH)
+	add_compile_definitions(USE_SPI_BENCH=1)
+endif(USE_SPI_BENCH)
+#-------------------------------------------------------------------------------
+if(USE_SPI_FAST_BULK)
+	add_compile_definitions(USE_SPI_FAST_BULK=1)
+endif(USE_SPI_FAST_BULK)
+#-------------------------------------------------------------------------------
+if(USE_PHY_STATS)
+	add_compile_definitions(USE_PHY_STATS=1)
+endif(USE_PHY_STATS)
+if(USE_PHY_AFC_TRACK)
+	add_compile_definitions(USE_PHY_AFC_TRACK=1)
+endif(USE_PHY_AFC_TRACK)
+if(USE_PHY_SCHED)
+	add_compile_definitions(USE_PHY_SCHED=1)
+	add_compile_definitions(USE_LPTIMER=1)
+endif(USE_PHY_SCHED)
+if(USE_PHY_LOG_CODE)
+	add_compile_definitions(USE_PHY_LOG_CODE=1)
+endif(USE_PHY_LOG_CODE)
+#-------------------------------------------------------------------------------
 if(HAS_HIRES_TIME_MEAS)
     add_compile_definitions(HAS_HIRES_TIME_MEAS=1)
 endif(HAS_HIRES_TIME_MEAS)
@@ -155,6 +229,14 @@ if(HAS_ATSTAT_CMD)
     add_compile_definitions(HAS_ATSTAT_CMD=1)
 endif(HAS_ATSTAT_CMD)
 
+if(HAS_ATSCAN_CMD)
+    add_compile_definitions(HAS_ATSCAN_CMD=1)
+endif(HAS_ATSCAN_CMD)
+
+if(HAS_ATPERR_CMD)
+    add_compile_definitions(HAS_ATPERR_CMD=1)
+endif(HAS_ATPERR_CMD)
+
 if(HAS_ATCCLK_CMD)
     add_compile_definitions(HAS_ATCCLK_CMD=1)
 endif(HAS_ATCCLK_CMD)
@@ -16,6 +16,10 @@ option( HAL_PWR_MODULE_ENABLED "Enable HAL PWR" ON )
 option( HAL_FIREWALL_MODULE_ENABLED "Enable HAL FIREWALL" OFF )
 option( HAL_TIM_MODULE_ENABLED "Enable HAL TIM" ON )
 option( HAL_LPTIM_MODULE_ENABLED "Enable HAL LPTIM" OFF )
+if(USE_PHY_SCHED)
+# The scheduled TX/RX requires the LPTIM (option only set the default value of a new cache)
+set( HAL_LPTIM_MODULE_ENABLED ON CACHE BOOL "Enable HAL LPTIM" FORCE )
+endif()
 option( HAL_IWDG_MODULE_ENABLED "Enable HAL IWDG" OFF )
 option( HAL_WWDG_MODULE_ENABLED "Enable HAL WWDG" OFF )
 option( HAL_SRAM_MODULE_ENABLED "Enable HAL SRAM" ON )    
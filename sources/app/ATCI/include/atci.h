@@ -233,6 +233,26 @@ typedef enum
 	CMD_ATSTAT,
 #endif
 	// ----
+#ifdef USE_PHY_TIME_TRACE
+	CMD_ATPTRC,
+#endif
+	// ----
+#ifdef HAS_ATPERR_CMD
+	CMD_ATPERR,
+#endif
+	// ----
+#ifdef USE_SPI_BENCH
+	CMD_ATSPIB,
+#endif
+	// ----
+#ifdef USE_PHY_STATS
+	CMD_ATPSTA,
+#endif
+	// ----
+#ifdef HAS_ATSCAN_CMD
+	CMD_ATSCAN,
+#endif
+	// ----
 #ifdef HAS_ATCCLK_CMD
 	CMD_ATCCLK,
 #endif
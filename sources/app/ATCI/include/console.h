@@ -46,6 +46,10 @@
 
 #define CONSOLE_BUF_LEN  512
 
+#ifndef CONSOLE_RX_RING_LEN
+#define CONSOLE_RX_RING_LEN 1024 // DMA circular RX ring (USE_UART_RX_DMA)
+#endif
+
 //#define CONSOLE_RX_TIMEOUT_ms		5000
 
 #define CONSOLE_RX_ERR	 0xEF
@@ -39,6 +39,7 @@
  *============================================================================*/
 
 #include <stdint.h>
+#include <string.h>
 
 #include "atci.h"
 #include "atci_get_cmd.h"
@@ -112,6 +113,26 @@ const pf_exec_cmd_t Atci_Exec_Cmd[NB_AT_CMD] =
 	[CMD_ATSTAT] = Exec_ATSTAT_Cmd,
 #endif
 
+#ifdef USE_PHY_TIME_TRACE
+	[CMD_ATPTRC] = Exec_ATPTRC_Cmd,
+#endif
+
+#ifdef HAS_ATPERR_CMD
+	[CMD_ATPERR] = Exec_ATPERR_Cmd,
+#endif
+
+#ifdef USE_SPI_BENCH
+	[CMD_ATSPIB] = Exec_ATSPIB_Cmd,
+#endif
+
+#ifdef USE_PHY_STATS
+	[CMD_ATPSTA] = Exec_ATPSTA_Cmd,
+#endif
+
+#ifdef HAS_ATSCAN_CMD
+	[CMD_ATSCAN] = Exec_ATSCAN_Cmd,
+#endif
+
 #ifdef HAS_ATCCLK_CMD
 	[CMD_ATCCLK] = Exec_ATCCLK_Cmd,
 #endif
@@ -166,14 +187,19 @@ extern void* hLoItfTask;
 
 static void _loitf_evt_(void *p_CbParam,  uint32_t evt)
 {
+#ifndef USE_UART_RX_DMA
 	if (p_CbParam)
 	{
 		((atci_cmd_t*)p_CbParam)->len = BSP_Uart_GetNbReceive(UART_ID_COM);
 	}
+#endif
 	sys_flag_set_isr(hLoItfTask, evt);
 }
 
 static uint32_t _u32_rx_cmd_tmo_;
+#ifdef HAS_LP_PARAMETER
+static uint8_t _u8PhySleepMode_ = 0xFF; /*!< PHY sleep mode last applied (0xFF : none) */
+#endif
 /*!-----------------------------------------------------------------------------
  * @internal
  *
@@ -192,6 +218,88 @@ static uint32_t _u32_rx_cmd_tmo_;
  *
  * @endinternal
  *----------------------------------------------------------------------------*/
+#ifdef USE_UART_RX_DMA
+atci_status_t Atci_Rx_Cmd(atci_cmd_t *atciCmdData)
+{
+	atci_status_t status = ATCI_RX_CMD_NONE;
+	uint32_t ulEvent;
+	uint8_t *pData;
+	uint8_t *pEnd;
+	uint16_t u16Len;
+	uint16_t u16Seen = 0;
+
+	atciCmdData->len = 0;
+
+	while (1)
+	{
+		// Look for the end of command in the new bytes, in place in the RX ring
+		do
+		{
+			if ( BSP_Uart_RxRing_Peek(UART_ID_COM, u16Seen, &pData, &u16Len) != DEV_SUCCESS )
+			{
+				// Overflow (the ring is resynchronized)
+				return ATCI_RX_CMD_ERR;
+			}
+			pEnd = (u16Len)?(memchr(pData, END_OF_CMD_CHAR, u16Len)):(NULL);
+			u16Seen += (pEnd)?((uint16_t)(pEnd - pData) + 1):(u16Len);
+		} while ( (pEnd == NULL) && u16Len );
+
+		if ( (pEnd == NULL) && (u16Seen < AT_CMD_BUF_LEN) )
+		{
+			// Wait for more (unless some came meanwhile)
+			if ( BSP_Uart_RxRing_Arm(UART_ID_COM, u16Seen) == DEV_SUCCESS )
+			{
+				if ( sys_flag_wait(&ulEvent, _u32_rx_cmd_tmo_) == 0 )
+				{
+					// Timeout
+					BSP_Uart_RxRing_Disarm(UART_ID_COM);
+					return ATCI_RX_CMD_TIMEOUT;
+				}
+			}
+			continue;
+		}
+		break;
+	}
+
+	if ( (pEnd == NULL) || (u16Seen > AT_CMD_BUF_LEN) )
+	{
+		// buffer overflow : no end of command within the buffer size
+		BSP_Uart_RxRing_Release(UART_ID_COM, u16Seen);
+		return ATCI_RX_CMD_ERR;
+	}
+
+	// Copy the command (at most 2 parts if wrapped), with its END_OF_CMD_CHAR
+	while (atciCmdData->len < u16Seen)
+	{
+		BSP_Uart_RxRing_Peek(UART_ID_COM, atciCmdData->len, &pData, &u16Len);
+		if (u16Len == 0)
+		{
+			// Overflow (the ring is resynchronized), see the release below
+			break;
+		}
+		if (u16Len > (u16Seen - atciCmdData->len))
+		{
+			u16Len = u16Seen - atciCmdData->len;
+		}
+		memcpy(&(atciCmdData->buf[atciCmdData->len]), pData, u16Len);
+		atciCmdData->len += u16Len;
+	}
+	if ( BSP_Uart_RxRing_Release(UART_ID_COM, u16Seen) != DEV_SUCCESS )
+	{
+		// Overwritten while copied
+		atciCmdData->len = 0;
+		return ATCI_RX_CMD_ERR;
+	}
+
+	if ( atciCmdData->len > AT_CMD_CODE_MIN_LEN )
+	{
+		status = ATCI_RX_CMD_OK;
+	}
+	// Don't take the END_OF_CMD_CHAR
+	atciCmdData->len--;
+	return status;
+}
+#else
 atci_status_t Atci_Rx_Cmd(atci_cmd_t *atciCmdData)
 {
 	atci_status_t status = ATCI_RX_CMD_NONE;
@@ -236,6 +344,7 @@ atci_status_t Atci_Rx_Cmd(atci_cmd_t *atciCmdData)
 	}
 	return status;
 }
+#endif
 
 static uint8_t _bPaState_;
 
@@ -410,6 +519,8 @@ static uint8_t _init_lp_var_(void)
 	 *  0b xxxx xxxxxx00
 	 *  0b xxxx xx00 : disable
 	 *  0b xxxx xx01 : enable
+	 *  0b xxxx xx0x : PHY warm sleep (fast wake-up)
+	 *  0b xxxx xx1x : PHY cold sleep (lowest current)
 	 *  0b 0000 xx01 : manual LP (no TMO)
 	 *  0b 0001 xx01 : 1 seconds
 	 *  0b 0010 xx01 : 2 seconds
@@ -419,6 +530,12 @@ static uint8_t _init_lp_var_(void)
 	 */
 	Param_Access(LOW_POWER_MODE, &eLPmode, 0);
 	u32LPdelay = (eLPmode >> 4) * 1000;
+	if ( ((eLPmode >> 1) & 0x1) != _u8PhySleepMode_ )
+	{
+		// Only on the first load and when the parameter has changed
+		_u8PhySleepMode_ = (eLPmode >> 1) & 0x1;
+		EX_PHY_SetSleepMode(_u8PhySleepMode_);
+	}
 	eLPmode = eLPmode & 0x1;
 	if (!u32LPdelay)
 	{
@@ -92,6 +92,26 @@ const char * const atci_cmd_code_str[NB_AT_CMD] =
 	[CMD_ATSTAT] = "AT%STAT",
 #endif
 
+#ifdef USE_PHY_TIME_TRACE
+	[CMD_ATPTRC] = "AT%PTRC",
+#endif
+
+#ifdef HAS_ATPERR_CMD
+	[CMD_ATPERR] = "AT%PERR",
+#endif
+
+#ifdef USE_SPI_BENCH
+	[CMD_ATSPIB] = "AT%SPIB",
+#endif
+
+#ifdef USE_PHY_STATS
+	[CMD_ATPSTA] = "AT%PSTA",
+#endif
+
+#ifdef HAS_ATSCAN_CMD
+	[CMD_ATSCAN] = "AT%SCAN",
+#endif
+
 #ifdef HAS_ATCCLK_CMD
 	[CMD_ATCCLK] = "AT%CCLK",
 #endif
@@ -54,6 +54,10 @@
 console_buf_t consoleTxBuf;
 console_buf_t consoleRxBuf;
 
+#ifdef USE_UART_RX_DMA
+static uint8_t consoleRxRing[CONSOLE_RX_RING_LEN];
+#endif
+
 /*! @} @endcond */
 
 /*=========================================================================================================
@@ -91,6 +95,13 @@ void Console_Init(const char cMatch, pfEvtCb_t const pfEvtCb, void *pCbParam)
 void Console_Enable(void)
 {
 	BSP_Uart_Open(UART_ID_COM);
+#ifdef USE_UART_RX_DMA
+	BSP_Uart_RxRing_Start(UART_ID_COM, consoleRxRing, CONSOLE_RX_RING_LEN);
+#endif
+#if (USE_UART_COM_ID == 0) || defined(USE_UART_RX_DMA)
+	// The UART4 doesn't receive in STOP mode, nor the RX DMA (the LPUART1 alone does)
+	BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_COM, 1);
+#endif
 }
 
 /*!-----------------------------------------------------------------------------
@@ -102,7 +113,15 @@ void Console_Enable(void)
  *----------------------------------------------------------------------------*/
 void Console_Disable(void)
 {
+#ifdef USE_UART_TX_QUEUE
+	// Don't lose the last response
+	BSP_Uart_TxQueue_Flush(UART_ID_COM, CONSOLE_TX_TIMEOUT);
+#endif
+#ifdef USE_UART_RX_DMA
+	BSP_Uart_RxRing_Stop(UART_ID_COM);
+#endif
 	BSP_Uart_Close(UART_ID_COM);
+	BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_COM, 0);
 }
 
 /*==============================================================================
@@ -50,10 +50,13 @@ void EX_PHY_SetCpy(void);
 void EX_PHY_OnOff(uint8_t bOn);
 void EX_PHY_SetPa(uint8_t bEnable);
 int32_t EX_PHY_GetPa(void);
+void EX_PHY_SetSleepMode(uint8_t bCold);
 int32_t EX_PHY_RssiCalibrate(int8_t i8RssiRefLevel);
 int32_t EX_PHY_AutoCalibrate(void);
+int32_t EX_PHY_CalEnv(uint8_t u8Vdd);
 int32_t EX_PHY_SetPowerEntry(phy_power_entry_t *pPhyPwrEntry);
 int32_t EX_PHY_GetPowerEntry(phy_power_entry_t *pPhyPwrEntry);
+int32_t EX_PHY_NoiseScan(phy_scan_t *pScan);
 
 #ifdef __cplusplus
 }
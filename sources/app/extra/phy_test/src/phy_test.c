@@ -316,6 +316,17 @@ inline int32_t EX_PHY_GetPa(void)
 	return ret;
 }
 
+/*!
+ * @brief  This function set the PHY sleep mode
+ *
+ * @param [in]  bCold   0 : warm sleep (fast wake-up), 1 : cold sleep (lowest current)
+ *
+ */
+inline void EX_PHY_SetSleepMode(uint8_t bCold)
+{
+	sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_SLEEP_MODE, (uint32_t)(bCold & 0x1));
+}
+
 /*!
  * @brief  This function launch the RSSI offset calibration sequence.
  *
@@ -353,6 +364,30 @@ inline int32_t EX_PHY_AutoCalibrate(void)
 }
 
 
+/*!
+ * @brief  This function measure the temperature with the PHY, then select the
+ *         nearest cached calibration (auto-calibration if none is close enough)
+ *
+ * @details The PHY is not disturbed while transmitting or receiving (busy), it
+ * is left powered off or sleeping if it was.
+ *
+ * @param [in]  u8Vdd Supply voltage (20 mV unit, 0 : unknown)
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+inline int32_t EX_PHY_CalEnv(uint8_t u8Vdd)
+{
+	cal_env_info_t sEnv;
+	sEnv.calEnv = 0;
+	sEnv.u8Vdd = u8Vdd;
+	sEnv.bMeasTemp = 1;
+	sEnv.bAutoCal = 1;
+	return sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_CAL_ENV, sEnv.calEnv);
+}
+
 /*!
  * @brief  This function set/change entry in power table
  *
@@ -381,6 +416,24 @@ inline int32_t EX_PHY_GetPowerEntry(phy_power_entry_t *pPhyPwrEntry)
 	return sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CTL_GET_PWR_ENTRY, (uint32_t)pPhyPwrEntry);
 }
 
+/*!
+ * @brief  This function launch a noise scan of several channels and modulations
+ *
+ * @param [in, out] pScan Pointer on the scan request and result
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ */
+inline int32_t EX_PHY_NoiseScan(phy_scan_t *pScan)
+{
+	int32_t i32Ret;
+	EX_PHY_OnOff(1);
+	i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_NOISE_SCAN, (uint32_t)pScan);
+	EX_PHY_OnOff(0);
+	return i32Ret;
+}
+
 #ifdef __cplusplus
 }
 #endif
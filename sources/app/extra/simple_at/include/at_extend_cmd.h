@@ -54,6 +54,26 @@ atci_error_t Exec_ATZn_Cmd(atci_cmd_t *atciCmdData);
 atci_error_t Exec_ATSTAT_Cmd(atci_cmd_t *atciCmdData);
 #endif
 
+#ifdef USE_PHY_TIME_TRACE
+atci_error_t Exec_ATPTRC_Cmd(atci_cmd_t *atciCmdData);
+#endif
+
+#ifdef HAS_ATPERR_CMD
+atci_error_t Exec_ATPERR_Cmd(atci_cmd_t *atciCmdData);
+#endif
+
+#ifdef USE_SPI_BENCH
+atci_error_t Exec_ATSPIB_Cmd(atci_cmd_t *atciCmdData);
+#endif
+
+#ifdef USE_PHY_STATS
+atci_error_t Exec_ATPSTA_Cmd(atci_cmd_t *atciCmdData);
+#endif
+
+#ifdef HAS_ATSCAN_CMD
+atci_error_t Exec_ATSCAN_Cmd(atci_cmd_t *atciCmdData);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -324,6 +324,550 @@ atci_error_t Exec_ATSTAT_Cmd(atci_cmd_t *atciCmdData)
 
 /******************************************************************************/
 
+#if defined (USE_PHY_TIME_TRACE) || defined (HAS_ATPERR_CMD) || defined (USE_SPI_BENCH) || defined (USE_PHY_STATS)
+static
+uint8_t* _put_u32_(uint8_t *pData, uint32_t u32Val);
+
+static
+uint8_t* _put_u32_(uint8_t *pData, uint32_t u32Val)
+{
+	pData[0] = (uint8_t)(u32Val >> 24);
+	pData[1] = (uint8_t)(u32Val >> 16);
+	pData[2] = (uint8_t)(u32Val >> 8);
+	pData[3] = (uint8_t)(u32Val);
+	return &(pData[4]);
+}
+#endif
+
+#ifdef USE_PHY_TIME_TRACE
+#include "phy_trace.h"
+
+#define PTRC_DUMP_NB 30
+
+/*!-----------------------------------------------------------------------------
+ * @brief		Execute AT%PTRC command (PHY timing trace)
+ *
+ * @details		Command format:
+ * 	- "AT%PTRC?" : get the latency statistics. One parameter, for each
+ * 	  transition (see phy_trace_lat_e) : id (1 byte), then count, min, average,
+ * 	  max and 99th percentile in us (4 bytes each, MSB first).
+ * 	- "AT%PTRC=0" : clear the trace ring and the statistics.
+ * 	- "AT%PTRC=1" : get the last trace entries (oldest first). One parameter,
+ * 	  for each entry : time-stamp in us (4 bytes, MSB first), sequence number
+ * 	  (1 byte), event (1 byte, see phy_trace_evt_e), argument (2 bytes, MSB
+ * 	  first).
+ *
+ * @param[in,out]	atciCmdData Pointer on "atci_cmd_t" structure
+ *
+ * @return
+ * 	- ATCI_ERR_NONE if succeed
+ * 	- Else error code (ATCI_INV_NB_PARAM_ERR ... ATCI_INV_CMD_LEN_ERR or ATCI_ERR)
+ *
+ *----------------------------------------------------------------------------*/
+atci_error_t Exec_ATPTRC_Cmd(atci_cmd_t *atciCmdData)
+{
+	atci_error_t status = ATCI_ERR_NONE;
+	phy_trace_lat_t sLat;
+	phy_trace_entry_t aEntry[PTRC_DUMP_NB];
+	uint8_t *pData;
+	uint16_t u16Nb;
+	uint8_t u8Req;
+	uint8_t i;
+
+	Atci_Cmd_Param_Init(atciCmdData);
+
+	if ( atciCmdData->cmdType == AT_CMD_READ_WITHOUT_PARAM )
+	{
+		atciCmdData->params[0].size = PHY_TRACE_NB_LAT * (1 + 5*4);
+		status = Atci_Add_Cmd_Param_Resp(atciCmdData);
+		if (status == ATCI_ERR_NONE)
+		{
+			pData = atciCmdData->params[0].data;
+			for (i = 0; i < PHY_TRACE_NB_LAT; i++)
+			{
+				PhyTrace_GetLat(i, &sLat);
+				*pData++ = i;
+				pData = _put_u32_(pData, sLat.u32Count);
+				pData = _put_u32_(pData, sLat.u32Min);
+				pData = _put_u32_(pData, sLat.u32Avg);
+				pData = _put_u32_(pData, sLat.u32Max);
+				pData = _put_u32_(pData, sLat.u32P99);
+			}
+			Atci_Resp_Data(atci_cmd_code_str[atciCmdData->cmdCode], atciCmdData);
+		}
+	}
+	else if (atciCmdData->cmdType == AT_CMD_WITH_PARAM_TO_GET)
+	{
+		status = Atci_Buf_Get_Cmd_Param(atciCmdData, PARAM_INT8);
+		if (status == ATCI_ERR_NONE)
+		{
+			u8Req = *(atciCmdData->params[0].val8);
+			if (atciCmdData->cmdType != AT_CMD_WITH_PARAM)
+			{
+				status = ATCI_ERR_PARAM_NB;
+			}
+			else if (u8Req == 0)
+			{
+				PhyTrace_Clear();
+			}
+			else if (u8Req == 1)
+			{
+				u16Nb = PhyTrace_GetLast(aEntry, PTRC_DUMP_NB);
+				if (u16Nb == 0)
+				{
+					return ATCI_ERR_NONE;
+				}
+				Atci_Cmd_Param_Init(atciCmdData);
+				atciCmdData->params[0].size = u16Nb * 8;
+				status = Atci_Add_Cmd_Param_Resp(atciCmdData);
+				if (status == ATCI_ERR_NONE)
+				{
+					pData = atciCmdData->params[0].data;
+					for (i = 0; i < u16Nb; i++)
+					{
+						pData = _put_u32_(pData, aEntry[i].u32Time);
+						*pData++ = aEntry[i].u8Seq;
+						*pData++ = aEntry[i].u8Evt;
+						*pData++ = (uint8_t)(aEntry[i].u16Arg >> 8);
+						*pData++ = (uint8_t)(aEntry[i].u16Arg);
+					}
+					Atci_Resp_Data(atci_cmd_code_str[atciCmdData->cmdCode], atciCmdData);
+				}
+			}
+			else
+			{
+				status = ATCI_ERR_PARAM_VAL;
+			}
+		}
+	}
+	else
+	{
+		status = ATCI_ERR_PARAM_NB;
+	}
+
+	return status;
+}
+#endif
+
+/******************************************************************************/
+
+#ifdef HAS_ATPERR_CMD
+#include "adf7030-1_phy_log.h"
+
+/*!-----------------------------------------------------------------------------
+ * @brief		Execute AT%PERR command (PHY last error codes ring)
+ *
+ * @details		Command format:
+ * 	- "AT%PERR?" : get the last PHY errors. One parameter : number of errors
+ * 	  since the last clear (4 bytes, MSB first), then for each error kept in
+ * 	  the ring (oldest first) : epoch in s (4 bytes, MSB first), milliseconds
+ * 	  (2 bytes, MSB first), instance error (1 byte, adf7030_1_res_e) and PHY
+ * 	  Radio error (1 byte, MISC_FW ERR_CODE).
+ * 	- "AT%PERR=0" : clear the error ring.
+ *
+ * @param[in,out]	atciCmdData Pointer on "atci_cmd_t" structure
+ *
+ * @return
+ * 	- ATCI_ERR_NONE if succeed
+ * 	- Else error code (ATCI_INV_NB_PARAM_ERR ... ATCI_INV_CMD_LEN_ERR or ATCI_ERR)
+ *
+ *----------------------------------------------------------------------------*/
+atci_error_t Exec_ATPERR_Cmd(atci_cmd_t *atciCmdData)
+{
+	atci_error_t status = ATCI_ERR_NONE;
+	phy_log_err_t aErr[PHY_LOG_ERR_RING_NB];
+	uint32_t u32Total;
+	uint8_t *pData;
+	uint8_t u8Nb;
+	uint8_t i;
+
+	Atci_Cmd_Param_Init(atciCmdData);
+
+	if ( atciCmdData->cmdType == AT_CMD_READ_WITHOUT_PARAM )
+	{
+		// Copy first, the PHY task could push an error meanwhile
+		u32Total = PhyLog_ErrTotal();
+		for (u8Nb = 0; u8Nb < PHY_LOG_ERR_RING_NB; u8Nb++)
+		{
+			if ( PhyLog_ErrGet(u8Nb, &(aErr[u8Nb])) )
+			{
+				break;
+			}
+		}
+		atciCmdData->params[0].size = 4 + u8Nb * 8;
+		status = Atci_Add_Cmd_Param_Resp(atciCmdData);
+		if (status == ATCI_ERR_NONE)
+		{
+			pData = atciCmdData->params[0].data;
+			pData = _put_u32_(pData, u32Total);
+			i = u8Nb;
+			while (i--)
+			{
+				pData = _put_u32_(pData, aErr[i].u32Time);
+				*pData++ = (uint8_t)(aErr[i].u16Ms >> 8);
+				*pData++ = (uint8_t)(aErr[i].u16Ms);
+				*pData++ = aErr[i].u8Inst;
+				*pData++ = aErr[i].u8Phy;
+			}
+			Atci_Resp_Data(atci_cmd_code_str[atciCmdData->cmdCode], atciCmdData);
+		}
+	}
+	else if (atciCmdData->cmdType == AT_CMD_WITH_PARAM_TO_GET)
+	{
+		status = Atci_Buf_Get_Cmd_Param(atciCmdData, PARAM_INT8);
+		if (status == ATCI_ERR_NONE)
+		{
+			if (atciCmdData->cmdType != AT_CMD_WITH_PARAM)
+			{
+				status = ATCI_ERR_PARAM_NB;
+			}
+			else if (*(atciCmdData->params[0].val8) == 0)
+			{
+				PhyLog_ErrClear();
+			}
+			else
+			{
+				status = ATCI_ERR_PARAM_VAL;
+			}
+		}
+	}
+	else
+	{
+		status = ATCI_ERR_PARAM_NB;
+	}
+
+	return status;
+}
+#endif
+
+/******************************************************************************/
+
+#ifdef USE_SPI_BENCH
+#ifndef HAS_HIRES_TIME_MEAS
+#error "USE_SPI_BENCH requires HAS_HIRES_TIME_MEAS (time-stamp source)"
+#endif
+#include "phy_layer_private.h"
+#include "bsp_hires_time.h"
+
+#define SPIB_REG_NB 500
+#define SPIB_BULK_NB 50
+
+extern phydev_t sPhyDev;
+
+/*!-----------------------------------------------------------------------------
+ * @brief		Execute AT%SPIB command (PHY SPI throughput micro-benchmark)
+ *
+ * @details		Command format:
+ * 	- "AT%SPIB=0" : time SPIB_REG_NB single register reads (MISC_FW).
+ * 	- "AT%SPIB=1" : time SPIB_BULK_NB bulk reads of PHY_SPI_BENCH_BULK_SZ bytes
+ * 	  from the packet buffer.
+ *
+ * 	The response holds the number of done reads (2 bytes, MSB first) and the
+ * 	elapsed time in us (4 bytes, MSB first). The PHY must be awake (not in
+ * 	sleep state).
+ *
+ * @param[in,out]	atciCmdData Pointer on "atci_cmd_t" structure
+ *
+ * @return
+ * 	- ATCI_ERR_NONE if succeed
+ * 	- Else error code (ATCI_INV_NB_PARAM_ERR ... ATCI_INV_CMD_LEN_ERR or ATCI_ERR)
+ *
+ *----------------------------------------------------------------------------*/
+atci_error_t Exec_ATSPIB_Cmd(atci_cmd_t *atciCmdData)
+{
+	static phy_spi_bench_t sBench;
+	atci_error_t status = ATCI_ERR_NONE;
+	uint32_t u32Start;
+	uint32_t u32Elapsed;
+	uint8_t *pData;
+	uint8_t u8Req;
+
+	Atci_Cmd_Param_Init(atciCmdData);
+
+	if (atciCmdData->cmdType == AT_CMD_WITH_PARAM_TO_GET)
+	{
+		status = Atci_Buf_Get_Cmd_Param(atciCmdData, PARAM_INT8);
+		if (status == ATCI_ERR_NONE)
+		{
+			u8Req = *(atciCmdData->params[0].val8);
+			if (atciCmdData->cmdType != AT_CMD_WITH_PARAM)
+			{
+				status = ATCI_ERR_PARAM_NB;
+			}
+			else if (u8Req > 1)
+			{
+				status = ATCI_ERR_PARAM_VAL;
+			}
+			else
+			{
+				if ( !HiResTime_IsEnabled() )
+				{
+					HiResTime_EnDis(1);
+				}
+				sBench.bBulk = u8Req;
+				sBench.u16Nb = (u8Req)?(SPIB_BULK_NB):(SPIB_REG_NB);
+				u32Start = HiResTime_Now();
+				if (sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_SPI_BENCH, (uint32_t)(&sBench)))
+				{
+					status = ATCI_ERR_UNK;
+				}
+				u32Elapsed = HiResTime_Now() - u32Start;
+				if (status == ATCI_ERR_NONE)
+				{
+					Atci_Cmd_Param_Init(atciCmdData);
+					atciCmdData->params[0].size = 2 + 4;
+					status = Atci_Add_Cmd_Param_Resp(atciCmdData);
+					if (status == ATCI_ERR_NONE)
+					{
+						pData = atciCmdData->params[0].data;
+						*pData++ = (uint8_t)(sBench.u16Done >> 8);
+						*pData++ = (uint8_t)(sBench.u16Done);
+						pData = _put_u32_(pData, u32Elapsed);
+						Atci_Resp_Data(atci_cmd_code_str[atciCmdData->cmdCode], atciCmdData);
+					}
+				}
+			}
+		}
+	}
+	else
+	{
+		status = ATCI_ERR_PARAM_NB;
+	}
+
+	return status;
+}
+#endif
+
+/******************************************************************************/
+
+#ifdef USE_PHY_STATS
+#include "phy_stats.h"
+#include "phy_itf.h"
+
+static
+uint8_t* _put_lvl_(uint8_t *pData, phy_stats_lvl_t *pLvl);
+
+static
+uint8_t* _put_lvl_(uint8_t *pData, phy_stats_lvl_t *pLvl)
+{
+	int16_t aVal[7] = {
+		(int16_t)pLvl->u16Count, pLvl->i16Ewma, pLvl->i16Min, pLvl->i16Max,
+		pLvl->i16P10, pLvl->i16P50, pLvl->i16P90
+	};
+	uint8_t i;
+	for (i = 0; i < 7; i++)
+	{
+		*pData++ = (uint8_t)((uint16_t)aVal[i] >> 8);
+		*pData++ = (uint8_t)(aVal[i]);
+	}
+	return pData;
+}
+
+/*!-----------------------------------------------------------------------------
+ * @brief		Execute AT%PSTA command (PHY signal statistics)
+ *
+ * @details		Command format:
+ * 	- "AT%PSTA?" : get the quietest channel of each modulation. One parameter,
+ * 	  for each modulation : channel (1 byte, 0xFF if none is measured), its
+ * 	  noise average in 1/4 dBm (2 bytes, MSB first).
+ * 	- "AT%PSTA=<mod>" : get the statistics of each channel for this modulation
+ * 	  (0 : WM2400, 1 : WM4800, 2 : WM6400). One parameter, for each channel :
+ * 	  channel (1 byte), RSSI then noise level statistics (count, average,
+ * 	  minimum, maximum, 10th, 50th and 90th percentiles; 2 bytes each, MSB
+ * 	  first, levels in 1/4 dBm), AFC measures count (2 bytes) and mean AFC
+ * 	  frequency error in Hz (4 bytes, MSB first).
+ * 	- "AT%PSTA=255" : clear the statistics.
+ *
+ * @param[in,out]	atciCmdData Pointer on "atci_cmd_t" structure
+ *
+ * @return
+ * 	- ATCI_ERR_NONE if succeed
+ * 	- Else error code (ATCI_INV_NB_PARAM_ERR ... ATCI_INV_CMD_LEN_ERR or ATCI_ERR)
+ *
+ *----------------------------------------------------------------------------*/
+atci_error_t Exec_ATPSTA_Cmd(atci_cmd_t *atciCmdData)
+{
+	atci_error_t status = ATCI_ERR_NONE;
+	phy_stats_t sStats;
+	uint8_t *pData;
+	uint8_t u8Req;
+	uint8_t u8Ch;
+	int16_t i16Noise;
+	uint8_t i;
+
+	Atci_Cmd_Param_Init(atciCmdData);
+
+	if ( atciCmdData->cmdType == AT_CMD_READ_WITHOUT_PARAM )
+	{
+		atciCmdData->params[0].size = PHY_NB_MOD * 3;
+		status = Atci_Add_Cmd_Param_Resp(atciCmdData);
+		if (status == ATCI_ERR_NONE)
+		{
+			pData = atciCmdData->params[0].data;
+			for (i = 0; i < PHY_NB_MOD; i++)
+			{
+				u8Ch = PhyStats_Quietest(i, &i16Noise);
+				*pData++ = (u8Ch < PHY_NB_CH)?(u8Ch):(0xFF);
+				*pData++ = (uint8_t)((uint16_t)i16Noise >> 8);
+				*pData++ = (uint8_t)(i16Noise);
+			}
+			Atci_Resp_Data(atci_cmd_code_str[atciCmdData->cmdCode], atciCmdData);
+		}
+	}
+	else if (atciCmdData->cmdType == AT_CMD_WITH_PARAM_TO_GET)
+	{
+		status = Atci_Buf_Get_Cmd_Param(atciCmdData, PARAM_INT8);
+		if (status == ATCI_ERR_NONE)
+		{
+			u8Req = *(atciCmdData->params[0].val8);
+			if (atciCmdData->cmdType != AT_CMD_WITH_PARAM)
+			{
+				status = ATCI_ERR_PARAM_NB;
+			}
+			else if (u8Req == 0xFF)
+			{
+				PhyStats_Clear();
+			}
+			else if (u8Req < PHY_NB_MOD)
+			{
+				Atci_Cmd_Param_Init(atciCmdData);
+				atciCmdData->params[0].size = PHY_NB_CH * (1 + 2*7*2 + 2 + 4);
+				status = Atci_Add_Cmd_Param_Resp(atciCmdData);
+				if (status == ATCI_ERR_NONE)
+				{
+					pData = atciCmdData->params[0].data;
+					for (i = 0; i < PHY_NB_CH; i++)
+					{
+						PhyStats_Get(i, u8Req, &sStats);
+						*pData++ = i;
+						pData = _put_lvl_(pData, &(sStats.sRssi));
+						pData = _put_lvl_(pData, &(sStats.sNoise));
+						*pData++ = (uint8_t)(sStats.u16FerrNb >> 8);
+						*pData++ = (uint8_t)(sStats.u16FerrNb);
+						pData = _put_u32_(pData, (uint32_t)sStats.i32FerrHz);
+					}
+					Atci_Resp_Data(atci_cmd_code_str[atciCmdData->cmdCode], atciCmdData);
+				}
+			}
+			else
+			{
+				status = ATCI_ERR_PARAM_VAL;
+			}
+		}
+	}
+	else
+	{
+		status = ATCI_ERR_PARAM_NB;
+	}
+
+	return status;
+}
+#endif
+
+/******************************************************************************/
+
+#ifdef HAS_ATSCAN_CMD
+#include "phy_test.h"
+#include "adf7030-1_phy_conv.h"
+
+extern uint8_t bTestMode;
+
+/*!-----------------------------------------------------------------------------
+ * @brief		Execute AT%SCAN command (noise scan)
+ *
+ * @details		Command format:
+ * 	- "AT%SCAN=<ch_msk>,<mod_msk>,<nb_sample>" : measure the noise of each
+ * 	  channel in ch_msk (bit 0 : 100, bit 1 : 110 ... bit 5 : 150), for each
+ * 	  modulation in mod_msk (bit 0 : WM2400, bit 1 : WM4800, bit 2 : WM6400),
+ * 	  averaging nb_sample samples (1 to 255) on each channel. The PHY is
+ * 	  powered and configured once per modulation, then only retuned.
+ *
+ * 	The response holds ch_msk, mod_msk and the noise table : for each
+ * 	modulation then each channel (ascending order), the noise level in dBm
+ * 	(1 byte, signed).
+ *
+ * @param[in,out]	atciCmdData Pointer on "atci_cmd_t" structure
+ *
+ * @return
+ * 	- ATCI_ERR_NONE if succeed
+ * 	- Else error code (ATCI_INV_NB_PARAM_ERR ... ATCI_INV_CMD_LEN_ERR or ATCI_ERR)
+ *
+ *----------------------------------------------------------------------------*/
+atci_error_t Exec_ATSCAN_Cmd(atci_cmd_t *atciCmdData)
+{
+	static phy_scan_t sScan;
+	atci_error_t status = ATCI_ERR_NONE;
+	uint8_t *pData;
+	uint8_t i, j;
+
+	Atci_Cmd_Param_Init(atciCmdData);
+
+	if (atciCmdData->cmdType != AT_CMD_WITH_PARAM_TO_GET)
+	{
+		return ATCI_ERR_PARAM_NB;
+	}
+	for (i = 0; i < 3; i++)
+	{
+		if (atciCmdData->cmdType != AT_CMD_WITH_PARAM_TO_GET)
+		{
+			return ATCI_ERR_PARAM_NB;
+		}
+		status = Atci_Buf_Get_Cmd_Param(atciCmdData, PARAM_INT8);
+		if (status != ATCI_ERR_NONE)
+		{
+			return status;
+		}
+	}
+	if (atciCmdData->cmdType != AT_CMD_WITH_PARAM)
+	{
+		return ATCI_ERR_PARAM_NB;
+	}
+	sScan.u8ChMsk = *(atciCmdData->params[0].val8);
+	sScan.u8ModMsk = *(atciCmdData->params[1].val8);
+	sScan.u8NbSample = *(atciCmdData->params[2].val8);
+	if ( !sScan.u8ChMsk || (sScan.u8ChMsk >= (1 << PHY_NB_CH)) ||
+		 !sScan.u8ModMsk || (sScan.u8ModMsk >= (1 << PHY_NB_MOD)) ||
+		 !sScan.u8NbSample )
+	{
+		return ATCI_ERR_PARAM_VAL;
+	}
+	if ( bTestMode || (EX_PHY_NoiseScan(&sScan) != PHY_STATUS_OK) )
+	{
+		return ATCI_ERR_UNK;
+	}
+
+	Atci_Cmd_Param_Init(atciCmdData);
+	atciCmdData->params[0].size = PARAM_INT8;
+	Atci_Add_Cmd_Param_Resp(atciCmdData);
+	atciCmdData->params[1].size = PARAM_INT8;
+	Atci_Add_Cmd_Param_Resp(atciCmdData);
+	atciCmdData->params[2].size = sScan.u8Nb;
+	status = Atci_Add_Cmd_Param_Resp(atciCmdData);
+	if (status == ATCI_ERR_NONE)
+	{
+		*(atciCmdData->params[0].val8) = sScan.u8ChMsk;
+		*(atciCmdData->params[1].val8) = sScan.u8ModMsk;
+		pData = atciCmdData->params[2].data;
+		for (j = 0; j < PHY_NB_MOD; j++)
+		{
+			for (i = 0; i < PHY_NB_CH; i++)
+			{
+				if ( (sScan.u8ModMsk & (1 << j)) && (sScan.u8ChMsk & (1 << i)) )
+				{
+					// 1/4 dBm to dBm, rounded
+					*pData++ = (uint8_t)((PHY_CONV_Signed11ToQdBm(sScan.aNoise[j][i]) + 2) >> 2);
+				}
+			}
+		}
+		Atci_Resp_Data(atci_cmd_code_str[atciCmdData->cmdCode], atciCmdData);
+	}
+
+	return status;
+}
+#endif
+
+/******************************************************************************/
+
 #ifdef __cplusplus
 }
 #endif
@@ -100,7 +100,7 @@ typedef enum {
     L6_EXCH_DIS_FLT = 0xEF, /*!< L6 Reception Filter disable (see struct proto_config_s) */
     TEST_MODE_CHANNEL = 0xFA, /*!< Get or Set the current test mode channel */
     TEST_MODE_MODULATION = 0xFB, /*!< Get or Set the current test mode modulation */
-    LOW_POWER_MODE = 0xFC, /*!< Get or Set the LowPower mode. b[0] : Enable/Disable, b[1:3] : Reserved, b[4:7] : Delay without activity to go in low power mode (0 : manual only). */
+    LOW_POWER_MODE = 0xFC, /*!< Get or Set the LowPower mode. b[0] : Enable/Disable, b[1] : PHY sleep mode (0 : fast wake-up, 1 : lowest current), b[2:3] : Reserved, b[4:7] : Delay without activity to go in low power mode (0 : manual only). */
     LOGGER_LEVEL = 0xFD, /*!< Get or Set the Logger level (see logger_level_e for details) */
     LOGGER_TIME_OPT = 0xFE, /*!< Get or Set the Logger time (Unix EPOCH) option (see logger_tstamp_e for details). [b0] : Enable (1) / Disable (0); [b1] : If set : Extended with millisecond; [b2] : If set : Truncated on 5 digits; [b3-b6] Reserved; [b7] Enable/Disable Color. */
     LAST_ID = 0xFE, /*!< Don't remove, it marks the end of table. */
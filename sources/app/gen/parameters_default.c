@@ -88,7 +88,7 @@ const uint8_t a_ParamDefault[] = {
    0x0, /*!< L6 Reception Filter disable (see struct proto_config_s)*/
    0x78, /*!< Get or Set the current test mode channel*/
    0x0, /*!< Get or Set the current test mode modulation*/
-   0x51, /*!< Get or Set the LowPower mode. b[0] : Enable/Disable, b[1:3] : Reserved, b[4:7] : Delay without activity to go in low power mode (0 : manual only).*/
+   0x51, /*!< Get or Set the LowPower mode. b[0] : Enable/Disable, b[1] : PHY sleep mode (0 : fast wake-up, 1 : lowest current), b[2:3] : Reserved, b[4:7] : Delay without activity to go in low power mode (0 : manual only).*/
    0x0, /*!< Get or Set the Logger level (see logger_level_e for details)*/
    0x0, /*!< Get or Set the Logger time (Unix EPOCH) option (see logger_tstamp_e for details). [b0] : Enable (1) / Disable (0); [b1] : If set : Extended with millisecond; [b2] : If set : Truncated on 5 digits; [b3-b6] Reserved; [b7] Enable/Disable Color.*/
    };
@@ -49,6 +49,7 @@ void Storage_Init(uint8_t bForce);
 void Storage_SetDefault(void);
 uint8_t Storage_Store(void);
 uint8_t Storage_Get(void);
+uint8_t Storage_PhyAfcDrift(void);
 
 #ifdef __cplusplus
 }
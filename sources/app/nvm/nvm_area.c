@@ -15,7 +15,10 @@ struct _store_special_s
 	phy_power_t aPhyPower[PHY_NB_PWR];
 	uint8_t     ND2[3];
 	uint8_t     aPhyCalRes[CAL_RES_SZ] __attribute__ ((aligned(8)));
-	uint8_t     ND3[4];
+	uint8_t     aPhyCalCache[PHY_CAL_CACHE_SZ] __attribute__ ((aligned(8)));
+	int16_t     i16PhyAfcCorr;
+	uint8_t     u8PhyAfcTag;
+	uint8_t     ND3;
 };
 
 /******************************************************************************/
@@ -120,6 +123,8 @@ const struct _store_special_s sCalibration =
 	{
 		0, 0, 0, 0, 0, 0, 0, 0
 	},
+	.i16PhyAfcCorr = 0,
+	.u8PhyAfcTag = 0xA5, // STORE_PHY_AFC_TAG (see storage.c) : valid, no correction
 };
 // don't add any data in NVM between sCalibration and aParamSetup
 // don't move or remove it
@@ -36,6 +36,9 @@
 extern "C" {
 #endif
 
+#include "FreeRTOS.h"
+#include "task.h"
+
 #include "app_entry.h"
 #include "atci.h"
 #include "update.h"
@@ -129,6 +132,10 @@ extern struct update_ctx_s sUpdateCtx;
 #define MONITOR_PERIOD_EVT 30000
 #endif
 
+#ifndef MONITOR_CAL_ENV_PERIOD
+#define MONITOR_CAL_ENV_PERIOD 900000
+#endif
+
 #include "default_device_config.h"
 
 /*
@@ -151,6 +158,7 @@ void Monitor_Task(void const * argument)
 	uint32_t ret;
 
 	uint32_t ulPeriod = pdMS_TO_TICKS(MONITOR_PERIOD_EVT);
+	TickType_t xCalEnvTime = xTaskGetTickCount() - pdMS_TO_TICKS(MONITOR_CAL_ENV_PERIOD);
 
 	WizeApi_TimeMgr_Register(sys_get_pid());
 
@@ -203,6 +211,13 @@ b[7] if 1: Activate the keys writing in NVM;
 					// Param_Access(VERS_FW_TRX, tmp, 1);
 					BSP_Boot_Reboot(0);
 				}
+#if defined (USE_PHY_AFC_TRACK)
+				// Keep the learned frequency correction (flash wear : once a day at most)
+				if ( Storage_PhyAfcDrift() )
+				{
+					Storage_Store();
+				}
+#endif
 			}
 		}
 		else
@@ -218,6 +233,16 @@ b[7] if 1: Activate the keys writing in NVM;
 			LOG_DBG("Monitor alive\n");
 		}
 
+		// Follow the temperature : select the cached PHY calibration (or calibrate)
+		if ( (xTaskGetTickCount() - xCalEnvTime) >= pdMS_TO_TICKS(MONITOR_CAL_ENV_PERIOD) )
+		{
+			// The voltage is unknown (no ADC), busy PHY : retried on next period
+			if ( EX_PHY_CalEnv(0) != PHY_STATUS_BUSY )
+			{
+				xCalEnvTime = xTaskGetTickCount();
+			}
+		}
+
 #ifdef HAS_EXTEND_PARAMETER
 
 #endif
@@ -239,9 +239,17 @@ struct _store_special_s
 	phy_power_t aPhyPower[PHY_NB_PWR];
 	uint8_t     ND2[3];
 	uint8_t     aPhyCalRes[CAL_RES_SZ] __attribute__ ((aligned(8)));
-	uint8_t     ND3[4];
+	uint8_t     aPhyCalCache[PHY_CAL_CACHE_SZ] __attribute__ ((aligned(8)));
+	int16_t     i16PhyAfcCorr;
+	uint8_t     u8PhyAfcTag;
+	uint8_t     ND3;
 };
 
+/*!
+  * @brief Tag of a valid i16PhyAfcCorr (previous storage has unset bytes there)
+  */
+#define STORE_PHY_AFC_TAG 0xA5
+
 /*!
   * @brief  This initialize the storage area
   *
@@ -282,10 +290,11 @@ void Storage_Init(uint8_t bForce)
 void Storage_SetDefault(void)
 {
 	WizeApi_SetDeviceId(&sDefaultDevId);
-	memcpy(aPhyPower, aDefaultPhyPower, sizeof(phy_power_t)*PHY_NB_PWR);
+	Phy_SetPower(aDefaultPhyPower);
 	EX_PHY_SetPa(bDefaultPaState);
 	i16RssiOffsetCal = i16DefaultRssiOffsetCal;
 	Phy_ClrCal();
+	Phy_SetAfcCorr(0);
 	Param_Init(a_ParamDefault);
 	memcpy(_a_Key_, sDefaultKey, sizeof(_a_Key_));
 }
@@ -330,6 +339,9 @@ uint8_t Storage_Store(void)
 		memcpy(&(store_special.aPhyPower), aPhyPower, sizeof(phy_power_t)*PHY_NB_PWR);
 		store_special.i16PhyRssiOffset = i16RssiOffsetCal;
 		Phy_GetCal(store_special.aPhyCalRes);
+		Phy_GetCalCache(store_special.aPhyCalCache);
+		store_special.i16PhyAfcCorr = Phy_GetAfcCorr();
+		store_special.u8PhyAfcTag = STORE_PHY_AFC_TAG;
 	}
 	// Write ident in Flash is enable
 	if( (u8ExtFlags & EXT_FLAGS_IDENT_WRITE_EN_MSK))
@@ -390,13 +402,51 @@ uint8_t Storage_Get(void)
 
 	// Init special
 	WizeApi_SetDeviceId( &(store_special.sDeviceInfo) );
-	memcpy(aPhyPower, store_special.aPhyPower, sizeof(phy_power_t)*PHY_NB_PWR);
+	Phy_SetPower(store_special.aPhyPower);
 	EX_PHY_SetPa(store_special.bPaState);
 	i16RssiOffsetCal = store_special.i16PhyRssiOffset;
 	Phy_SetCal(store_special.aPhyCalRes);
+	Phy_SetCalCache(store_special.aPhyCalCache);
+	if ( (store_special.u8PhyAfcTag != STORE_PHY_AFC_TAG) ||
+	     (Phy_SetAfcCorr(store_special.i16PhyAfcCorr) != PHY_STATUS_OK) )
+	{
+		Phy_SetAfcCorr(0);
+	}
 	return 0;
 }
 
+/*!
+  * @brief  Check if the PHY frequency correction drifted from the stored one
+  *
+  * @retval  0 Not drifted
+  * @retval  1 Drifted over PHY_AFC_TRACK_STORE_HZ (worth a store)
+  *
+  */
+uint8_t Storage_PhyAfcDrift(void)
+{
+	const struct _store_special_s *p;
+	int32_t i32Drift = Phy_GetAfcCorr();
+	uint8_t u8ExtFlags = EXT_FLAGS_PHYCAL_WRITE_EN_MSK;
+
+	if (pStorage_FlashArea->sHeader.u16Status != 0xFFFF)
+	{
+#ifdef HAS_EXTEND_PARAMETER
+		Param_Access(EXTEND_FLAGS, &u8ExtFlags, 0);
+#endif
+		// Not stored anyway
+		if ( !(u8ExtFlags & EXT_FLAGS_PHYCAL_WRITE_EN_MSK))
+		{
+			return 0;
+		}
+		p = ((const struct _store_special_s*)pStorage_FlashArea->sHeader.u32PartAddr[1]);
+		if (p->u8PhyAfcTag == STORE_PHY_AFC_TAG)
+		{
+			i32Drift -= p->i16PhyAfcCorr;
+		}
+	}
+	return ( (i32Drift > PHY_AFC_TRACK_STORE_HZ) || (i32Drift < -PHY_AFC_TRACK_STORE_HZ) );
+}
+
 #ifdef __cplusplus
 }
 #endif
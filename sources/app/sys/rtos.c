@@ -37,6 +37,13 @@
 #include "task.h"
 #include <stdio.h>
 
+#if defined(USE_TICKLESS_IDLE)
+#include "bsp_lp.h"
+#endif
+#if defined(USE_UART_TX_QUEUE)
+#include "bsp_uart.h"
+#endif
+
 /*!
  * @cond INTERNAL
  * @{
@@ -103,12 +110,45 @@ void vApplicationDaemonTaskStartupHook( void )
 }
 #endif
 /******************************************************************************/
+#if defined(USE_TICKLESS_IDLE)
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+	uint32_t u32Ms;
+	// Called when configUSE_TICKLESS_IDLE == 2, from the idle task (scheduler suspended).
+	// Mask all interrupts (not only up to configMAX_SYSCALL_INTERRUPT_PRIORITY),
+	// so the one that ends the sleep is served once the tick has been corrected.
+	__asm volatile( "cpsid i" ::: "memory" );
+	__asm volatile( "dsb" );
+	__asm volatile( "isb" );
+	if ( eTaskConfirmSleepModeStatus() != eAbortSleep )
+	{
+		u32Ms = BSP_LowPower_Idle( xExpectedIdleTime * portTICK_PERIOD_MS );
+		vTaskStepTick( u32Ms / portTICK_PERIOD_MS );
+	}
+	__asm volatile( "cpsie i" ::: "memory" );
+	__asm volatile( "dsb" );
+	__asm volatile( "isb" );
+}
+#else
 void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
 {
   // Generated when configUSE_TICKLESS_IDLE == 2.
   // Function called in tasks.c (in portTASK_FUNCTION).
   // TO BE COMPLETED or TO BE REPLACED by a user one, overriding that weak one.
 }
+#endif
+/******************************************************************************/
+#if defined(USE_UART_TX_QUEUE)
+void BSP_Uart_TxQueue_Yield(void)
+{
+	// Called with the interrupts (and BASEPRI) unmasked, outside of interrupt.
+	// Only a running scheduler can delay the task (not suspended, not started)
+	if ( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+	{
+		vTaskDelay(1);
+	}
+}
+#endif
 
 /*!
  * @}
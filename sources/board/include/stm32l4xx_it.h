@@ -45,6 +45,11 @@ void UART4_IRQHandler(void);
 #ifdef USE_LPUART1
 void LPUART1_IRQHandler(void);
 #endif
+#ifdef USE_SPI_DMA
+void DMA1_Channel2_IRQHandler(void);
+void DMA1_Channel3_IRQHandler(void);
+void SPI1_IRQHandler(void);
+#endif
 
 void TIM6_DAC_IRQHandler(void);
 
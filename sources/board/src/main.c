@@ -92,13 +92,21 @@ int main(void)
   /*
   * The "PeriphClock_Config" call is not required because all "Peripherals
   * independent clock" have expected configuration at Reset.
+  * Except the LPUART1 in tickless idle, that have to receive in STOP2.
   */
+#if defined(USE_LPUART1) && defined(USE_TICKLESS_IDLE)
+  PeriphClock_Config();
+#else
   //PeriphClock_Config();
+#endif
 
   MX_GPIO_Init();
   BSP_PwrLine_Init();
 
   BSP_Uart_Init(UART_ID_COM, '\r', UART_MODE_NONE);
+#ifdef USE_LPTIMER
+  BSP_LpTimer_Init(1);
+#endif
 
   app_entry();
   while (1)
@@ -201,6 +209,18 @@ void PeriphClock_Config(void)
 	PeriphClkInit.I2c1ClockSelection = RCC_I2C1CLKSOURCE_PCLK1;
 	PeriphClkInit.I2c2ClockSelection = RCC_I2C2CLKSOURCE_PCLK1;
 	*/
+
+#if defined(USE_LPUART1) && defined(USE_TICKLESS_IDLE)
+	/*
+	* The LPUART1 receives in STOP2 on the HSI16 kernel clock (requested by the
+	* LPUART1 on the start bit). In Run mode, the HSI16 has to be on (see
+	* BSP_LowPower_OnStopExit).
+	*/
+	__HAL_RCC_HSI_ENABLE();
+	while (__HAL_RCC_GET_FLAG(RCC_FLAG_HSIRDY) == 0U) {}
+	PeriphClkInit.PeriphClockSelection |= RCC_PERIPHCLK_LPUART1;
+	PeriphClkInit.Lpuart1ClockSelection = RCC_LPUART1CLKSOURCE_HSI;
+#endif
 	if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
 	{
 		Error_Handler();
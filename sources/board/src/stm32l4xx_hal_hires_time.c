@@ -34,6 +34,7 @@ extern "C" {
 /******************************************************************************/
 #include "stm32l4xx_hal.h"
 #include "stm32l4xx_hal_tim.h"
+#include "bsp_hires_time.h"
 
 TIM_HandleTypeDef htim2;
 TIM_HandleTypeDef htim3;
@@ -114,6 +115,30 @@ int32_t HiResTime_EnDis(uint8_t bEnable)
 	return 0;
 }
 
+/**
+  * @brief  This function check if the high resolution timer is running.
+  *
+  * @retval 1 if running, 0 otherwise
+  */
+uint8_t HiResTime_IsEnabled(void)
+{
+	return (__HAL_RCC_TIM2_IS_CLK_ENABLED() && (htim2.Instance != NULL))?(1):(0);
+}
+
+/**
+  * @brief  This function get the current high resolution time (1 us tick).
+  *
+  * @retval The free running counter value (0 if not running)
+  */
+uint32_t HiResTime_Now(void)
+{
+	if (HiResTime_IsEnabled())
+	{
+		return htim2.Instance->CNT;
+	}
+	return 0;
+}
+
 /**
   * @brief  This function .
   *
@@ -29,6 +29,16 @@
 
 /******************************************************************************/
 #include "main.h"
+
+#ifdef USE_SPI_DMA
+	extern DMA_HandleTypeDef hdma_spi1_rx;
+	extern DMA_HandleTypeDef hdma_spi1_tx;
+#endif
+
+#ifdef USE_UART_RX_DMA
+	extern DMA_HandleTypeDef hdma_com_rx;
+	static void _uart_rx_dma_init(UART_HandleTypeDef* huart, uint32_t u32Request, IRQn_Type eIrq);
+#endif
 /**
   * Initializes the Global MSP.
   */
@@ -115,6 +125,42 @@ void HAL_RTC_MspDeInit(RTC_HandleTypeDef* hrtc)
 	}
 }
 
+#if defined(HAL_LPTIM_MODULE_ENABLED)
+/**
+* @brief LPTIM MSP Initialization
+* This function configures the hardware resources used in this example
+* @param hlptim: LPTIM handle pointer
+* @retval None
+*/
+void HAL_LPTIM_MspInit(LPTIM_HandleTypeDef* hlptim)
+{
+	if (hlptim->Instance == LPTIM1)
+	{
+		__HAL_RCC_LPTIM1_CLK_ENABLE();
+		/* LPTIM1 interrupt Init : above configMAX_SYSCALL_INTERRUPT_PRIORITY,
+		 * so not delayed by the kernel critical sections (no RTOS call from it) */
+		HAL_NVIC_SetPriority(LPTIM1_IRQn, 4, 0);
+		HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+	}
+}
+
+/**
+* @brief LPTIM MSP De-Initialization
+* This function freeze the hardware resources used in this example
+* @param hlptim: LPTIM handle pointer
+* @retval None
+*/
+void HAL_LPTIM_MspDeInit(LPTIM_HandleTypeDef* hlptim)
+{
+	if (hlptim->Instance == LPTIM1)
+	{
+		__HAL_RCC_LPTIM1_CLK_DISABLE();
+		/* LPTIM1 interrupt DeInit */
+		HAL_NVIC_DisableIRQ(LPTIM1_IRQn);
+	}
+}
+#endif
+
 /**
 * @brief SPI MSP Initialization
 * This function configures the hardware resources used in this example
@@ -142,6 +188,44 @@ void HAL_SPI_MspInit(SPI_HandleTypeDef* hspi)
 		GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
 		GPIO_InitStruct.Alternate = GPIO_AF5_SPI1;
 		HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+#ifdef USE_SPI_DMA
+		__HAL_RCC_DMA1_CLK_ENABLE();
+
+		/* SPI1_RX : DMA1 channel 2, request 1 */
+		hdma_spi1_rx.Instance = DMA1_Channel2;
+		hdma_spi1_rx.Init.Request = DMA_REQUEST_1;
+		hdma_spi1_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+		hdma_spi1_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+		hdma_spi1_rx.Init.MemInc = DMA_MINC_ENABLE;
+		hdma_spi1_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+		hdma_spi1_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+		hdma_spi1_rx.Init.Mode = DMA_NORMAL;
+		hdma_spi1_rx.Init.Priority = DMA_PRIORITY_HIGH;
+		HAL_DMA_Init(&hdma_spi1_rx);
+		__HAL_LINKDMA(hspi, hdmarx, hdma_spi1_rx);
+
+		/* SPI1_TX : DMA1 channel 3, request 1 */
+		hdma_spi1_tx.Instance = DMA1_Channel3;
+		hdma_spi1_tx.Init.Request = DMA_REQUEST_1;
+		hdma_spi1_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+		hdma_spi1_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+		hdma_spi1_tx.Init.MemInc = DMA_MINC_ENABLE;
+		hdma_spi1_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+		hdma_spi1_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+		hdma_spi1_tx.Init.Mode = DMA_NORMAL;
+		hdma_spi1_tx.Init.Priority = DMA_PRIORITY_HIGH;
+		HAL_DMA_Init(&hdma_spi1_tx);
+		__HAL_LINKDMA(hspi, hdmatx, hdma_spi1_tx);
+
+		/* DMA and SPI1 interrupt priority */
+		HAL_NVIC_SetPriority(DMA1_Channel2_IRQn, 5, 0);
+		HAL_NVIC_EnableIRQ(DMA1_Channel2_IRQn);
+		HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 5, 0);
+		HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+		HAL_NVIC_SetPriority(SPI1_IRQn, 5, 0);
+		HAL_NVIC_EnableIRQ(SPI1_IRQn);
+#endif
 	}
 }
 
@@ -157,6 +241,13 @@ void HAL_SPI_MspDeInit(SPI_HandleTypeDef* hspi)
 	{
 		__HAL_RCC_SPI1_CLK_DISABLE();
 		HAL_GPIO_DeInit(GPIOA, SPI_CLK_Pin|SPI_MISO_Pin|SPI_MOSI_Pin);
+#ifdef USE_SPI_DMA
+		HAL_NVIC_DisableIRQ(SPI1_IRQn);
+		HAL_NVIC_DisableIRQ(DMA1_Channel2_IRQn);
+		HAL_NVIC_DisableIRQ(DMA1_Channel3_IRQn);
+		HAL_DMA_DeInit(hspi->hdmarx);
+		HAL_DMA_DeInit(hspi->hdmatx);
+#endif
 	}
 }
 
@@ -185,6 +276,11 @@ void HAL_UART_MspInit(UART_HandleTypeDef* huart)
 
 		/* UART4 interrupt priority */
 		HAL_NVIC_SetPriority(UART4_IRQn, 5, 0);
+
+#if defined(USE_UART_RX_DMA) && (USE_UART_COM_ID == 0)
+		/* UART4_RX : DMA2 channel 5, request 2 */
+		_uart_rx_dma_init(huart, DMA_REQUEST_2, DMA2_Channel5_IRQn);
+#endif
 	}
 #endif
 
@@ -203,6 +299,14 @@ void HAL_UART_MspInit(UART_HandleTypeDef* huart)
 
 		/* LPUART1 interrupt priority */
 		HAL_NVIC_SetPriority(LPUART1_IRQn, 5, 0);
+
+#if defined(USE_UART_RX_DMA) && (USE_UART_COM_ID == 1)
+		/* LPUART1_RX : DMA2 channel 7, request 4 */
+		/* Note : the LPUART1 receives in STOP2 but the DMA doesn't run, so with
+		 * USE_TICKLESS_IDLE the console relies on LP_STOP_INHIBIT_COM (see
+		 * Console_Enable) to stay out of STOP2 while listening. */
+		_uart_rx_dma_init(huart, DMA_REQUEST_4, DMA2_Channel7_IRQn);
+#endif
 	}
 #endif
 }
@@ -220,6 +324,10 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* huart)
 	{
 		__HAL_RCC_UART4_CLK_DISABLE();
 		HAL_GPIO_DeInit(GPIOA, UART_TXD_Pin|UART_RXD_Pin);
+#if defined(USE_UART_RX_DMA) && (USE_UART_COM_ID == 0)
+		HAL_NVIC_DisableIRQ(DMA2_Channel5_IRQn);
+		HAL_DMA_DeInit(huart->hdmarx);
+#endif
 	}
 #endif
 
@@ -228,6 +336,39 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* huart)
 	{
 		__HAL_RCC_LPUART1_CLK_DISABLE();
 		HAL_GPIO_DeInit(GPIOB, IOx0_Pin|IOx1_Pin);
+#if defined(USE_UART_RX_DMA) && (USE_UART_COM_ID == 1)
+		HAL_NVIC_DisableIRQ(DMA2_Channel7_IRQn);
+		HAL_DMA_DeInit(huart->hdmarx);
+#endif
 	}
 #endif
 }
+
+#ifdef USE_UART_RX_DMA
+/**
+* @brief UART RX DMA (circular) Initialization
+* @param huart: UART handle pointer
+* @param u32Request: DMA request of the UART RX
+* @param eIrq: DMA channel interrupt line
+* @retval None
+*/
+static void _uart_rx_dma_init(UART_HandleTypeDef* huart, uint32_t u32Request, IRQn_Type eIrq)
+{
+	__HAL_RCC_DMA2_CLK_ENABLE();
+
+	hdma_com_rx.Init.Request = u32Request;
+	hdma_com_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+	hdma_com_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma_com_rx.Init.MemInc = DMA_MINC_ENABLE;
+	hdma_com_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+	hdma_com_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+	hdma_com_rx.Init.Mode = DMA_CIRCULAR;
+	hdma_com_rx.Init.Priority = DMA_PRIORITY_LOW;
+	HAL_DMA_Init(&hdma_com_rx);
+	__HAL_LINKDMA(huart, hdmarx, hdma_com_rx);
+
+	/* DMA interrupt priority (same as the UART one) */
+	HAL_NVIC_SetPriority(eIrq, 5, 0);
+	HAL_NVIC_EnableIRQ(eIrq);
+}
+#endif
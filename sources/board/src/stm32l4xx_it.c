@@ -13,6 +13,20 @@ extern TIM_HandleTypeDef htim6;
 	extern UART_HandleTypeDef lphuart1;
 #endif
 
+#ifdef USE_SPI_DMA
+	extern SPI_HandleTypeDef hspi1;
+	extern DMA_HandleTypeDef hdma_spi1_rx;
+	extern DMA_HandleTypeDef hdma_spi1_tx;
+#endif
+
+#if defined(USE_LPTIMER) && defined(HAL_LPTIM_MODULE_ENABLED)
+	extern LPTIM_HandleTypeDef hlptim1;
+#endif
+
+#ifdef USE_UART_RX_DMA
+	extern DMA_HandleTypeDef hdma_com_rx;
+#endif
+
 /**
   * @brief This function handles RTC wake-up interrupt through EXTI line 20.
   */
@@ -35,6 +49,13 @@ void RTC_Alarm_IRQHandler(void)
   */
 void UART4_IRQHandler(void)
 {
+#ifdef USE_UART_RX_DMA
+	if ( huart4.Instance->CR1 & USART_CR1_IDLEIE )
+	{
+		// RX ring : idle line and character match (data are moved by the DMA)
+		huart4.RxISR(&huart4);
+	}
+#endif
 	if ( huart4.Instance->ISR & USART_ISR_RTOF)
 	{
 		huart4.RxISR(&huart4);
@@ -52,6 +73,13 @@ void UART4_IRQHandler(void)
   */
 void LPUART1_IRQHandler(void)
 {
+#ifdef USE_UART_RX_DMA
+	if ( lphuart1.Instance->CR1 & USART_CR1_IDLEIE )
+	{
+		// RX ring : idle line and character match (data are moved by the DMA)
+		lphuart1.RxISR(&lphuart1);
+	}
+#endif
 	if ( lphuart1.Instance->ISR & USART_ISR_RTOF)
 	{
 		lphuart1.RxISR(&lphuart1);
@@ -63,6 +91,59 @@ void LPUART1_IRQHandler(void)
 }
 #endif
 
+#ifdef USE_SPI_DMA
+/**
+  * @brief This function handles DMA1 channel2 (SPI1_RX) global interrupt.
+  */
+void DMA1_Channel2_IRQHandler(void)
+{
+	HAL_DMA_IRQHandler(&hdma_spi1_rx);
+}
+
+/**
+  * @brief This function handles DMA1 channel3 (SPI1_TX) global interrupt.
+  */
+void DMA1_Channel3_IRQHandler(void)
+{
+	HAL_DMA_IRQHandler(&hdma_spi1_tx);
+}
+
+/**
+  * @brief This function handles SPI1 global interrupt.
+  */
+void SPI1_IRQHandler(void)
+{
+	HAL_SPI_IRQHandler(&hspi1);
+}
+#endif
+
+#ifdef USE_UART_RX_DMA
+#if USE_UART_COM_ID == 0
+/**
+  * @brief This function handles DMA2 channel5 (UART4_RX) global interrupt.
+  */
+void DMA2_Channel5_IRQHandler(void)
+#else
+/**
+  * @brief This function handles DMA2 channel7 (LPUART1_RX) global interrupt.
+  */
+void DMA2_Channel7_IRQHandler(void)
+#endif
+{
+	HAL_DMA_IRQHandler(&hdma_com_rx);
+}
+#endif
+
+#if defined(USE_LPTIMER) && defined(HAL_LPTIM_MODULE_ENABLED)
+/**
+  * @brief This function handles LPTIM1 global interrupt.
+  */
+void LPTIM1_IRQHandler(void)
+{
+	HAL_LPTIM_IRQHandler(&hlptim1);
+}
+#endif
+
 /**
   * @brief This function handles TIM6 global interrupt, DAC channel1 and channel2 underrun error interrupts.
   */
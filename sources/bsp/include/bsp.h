@@ -68,6 +68,10 @@ extern "C" {
 #include <bsp_pwrlines.h>
 #endif
 
+#ifdef HAS_HIRES_TIME_MEAS
+#include <bsp_hires_time.h>
+#endif
+
 #define GP_PORT_NAME(name) name ##_GPIO_Port
 #define GP_PIN_NAME(name) name##_Pin
 
@@ -0,0 +1,56 @@
+/**
+  * @file bsp_hires_time.h
+  * @brief This file declares the high resolution timer functions (1 us tick).
+  * 
+  * @details The implementation is given by the board
+  * (stm32l4xx_hal_hires_time.c, on TIM2), or by the simulator (bsp_sim.c).
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without 
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright 
+  *      notice, this list of conditions and the following disclaimer in the 
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup hires_time
+ * @ingroup bsp
+ * @{
+ */
+
+#ifndef _BSP_HIRES_TIME_H_
+#define _BSP_HIRES_TIME_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+int32_t HiResTime_EnDis(uint8_t bEnable);
+uint8_t HiResTime_IsEnabled(void);
+uint32_t HiResTime_Now(void);
+uint32_t HiResTime_Get(uint8_t id);
+void HiResTime_Capture(uint8_t id);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _BSP_HIRES_TIME_H_ */
+
+/*! @} */
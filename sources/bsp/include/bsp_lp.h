@@ -78,7 +78,34 @@ typedef enum {
 	LP_WAKEUP_PIN5_POL_LOW = 0b10000,  /*!< Wakeup pin 5 falling edge */
 } lp_wakeup_pin_poll_msk;
 
+/*!
+ * @brief This enum define the sources that don't allow the STOP mode while idle
+ */
+typedef enum {
+	LP_STOP_INHIBIT_COM  = 0x01, /*!< Console is listening on UART4 or with the RX DMA (they don't run in STOP mode) */
+	LP_STOP_INHIBIT_UART = 0x02, /*!< UART transmission queue is draining */
+	LP_STOP_INHIBIT_PHY  = 0x04, /*!< PHY is receiving, transmitting or measuring */
+	LP_STOP_INHIBIT_PHY_SCHED = 0x08, /*!< PHY scheduled TX/RX is waiting for its start time */
+} lp_stop_inhibit_msk;
+
+/*!
+ * @brief Idle time (ms) from which STOP2 is used (SLEEP below)
+ */
+#ifndef LP_IDLE_STOP_MIN_MS
+#define LP_IDLE_STOP_MIN_MS 10
+#endif
+
+/*!
+ * @brief Maximum idle time (ms) in one BSP_LowPower_Idle call
+ */
+#ifndef LP_IDLE_MAX_MS
+#define LP_IDLE_MAX_MS 30000
+#endif
+
 void BSP_LowPower_Enter(lp_mode_e eLpMode);
+void BSP_LowPower_StopInhibit(uint8_t u8Src, uint8_t bInhibit);
+uint8_t BSP_LowPower_IsStopInhibited(void);
+uint32_t BSP_LowPower_Idle(uint32_t u32Ms);
 
 void BSP_LowPower_OnStandbyShutdwnEnter(lp_mode_e eLpMode);
 void BSP_LowPower_OnStopEnter(lp_mode_e eLpMode);
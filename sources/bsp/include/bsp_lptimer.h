@@ -44,7 +44,9 @@ extern "C" {
 extern pfHandlerCB_t pfLptim1Event;
 extern pfHandlerCB_t pfLptim2Event;
 
+uint8_t BSP_LpTimer_Init(const uint8_t u8TimerId);
 uint32_t BSP_LpTimer_Start(const uint8_t u8TimerId, uint32_t u32Elapse);
+uint32_t BSP_LpTimer_StartUs(const uint8_t u8TimerId, uint32_t u32Us);
 uint32_t BSP_LpTimer_Stop(const uint8_t u8TimerId);
 void BSP_LpTimer_SetHandler (const uint8_t u8TimerId, pfHandlerCB_t const pfCb);
 
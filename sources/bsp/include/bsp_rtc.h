@@ -50,6 +50,11 @@ extern pfHandlerCB_t pfWakeUpTimerEvent;
 extern pfHandlerCB_t pfAlarmAEvent;
 extern pfHandlerCB_t pfAlarmBEvent;
 
+/*!
+ * @brief Maximum short delay of the wake-up timer (ms, 16 bits at RTCCLK/16)
+ */
+#define RTC_WUT_SHORT_MAX_MS 31999
+
 typedef enum {
 	WINTER_TIME_CHANGE = -1,
 	NONE_TIME_CHANGE   = 0,
@@ -70,6 +75,7 @@ uint32_t BSP_Rtc_Backup_Read(uint32_t regNum);
 void BSP_Rtc_Time_Write(time_t t);
 void BSP_Rtc_Time_ReadMicro(struct timeval * tp);
 uint64_t BSP_Rtc_Time_GetEpochMs(void);
+uint32_t BSP_Rtc_Time_GetDayTicks(uint8_t bSync);
 time_t BSP_Rtc_Time_Read(void);
 
 void BSP_Rtc_Time_UpdateDaylight(daylight_sav_e dayligth_sav);
@@ -84,6 +90,8 @@ void BSP_Rtc_WakeUpTimer_Disable(void);
 void BSP_Rtc_WakeUptimer_Reload(void);
 void BSP_Rtc_WakeUpTimer_SetCallback (pfEventCB_t const pfCb);
 void BSP_Rtc_WakeUpTimer_SetHandler (pfHandlerCB_t const pfCb);
+uint8_t BSP_Rtc_WakeUpTimer_StartMs(uint32_t u32Ms);
+void BSP_Rtc_WakeUpTimer_StopMs(void);
 
 void BSP_Rtc_Alarm_Start(const uint8_t u8AlarmId, uint32_t u32Elapse);
 void BSP_Rtc_Alarm_StartMs(const uint8_t u8AlarmId, uint64_t u64Elapse);
@@ -55,6 +55,16 @@ typedef struct
     uint32_t nRxIncrement;     /*!< Receive pointer increment flag */
 } spi_transceiver_s;
 
+/*!
+  * @brief This enum define the spi event
+  */
+typedef enum
+{
+	SPI_EVT_NONE      = 0x00, /*!< No event */
+	SPI_EVT_XFER_CPLT = 0x01, /*!< DMA transfer is complete */
+	SPI_EVT_XFER_ERR  = 0x02, /*!< DMA transfer failed */
+} spi_evt_e;
+
 /*!
   * @brief This struct define the spi device
   */
@@ -63,6 +73,8 @@ typedef struct
     uint8_t bus_id;   /*!< SPI bus id */
     uint32_t ss_port; /*!< Chip select gpio port */
     uint16_t ss_pin;  /*!< Chip select gpio pin */
+    pfEvtCb_t pfEvent;/*!< Event callback (DMA transfer end, called from ISR) */
+    void *pCbParam;   /*!< Event callback parameter */
 } spi_dev_t;
 
 /*!
@@ -81,6 +93,11 @@ uint8_t BSP_Spi_SetClockPhase (const p_spi_dev_t p_Device, const bool b_Flag);
 uint8_t BSP_Spi_SetClockPol (const p_spi_dev_t p_Device, const bool b_Flag);
 uint8_t BSP_Spi_ReadWrite (const p_spi_dev_t p_Device, spi_transceiver_s* const p_Xfr);
 
+uint8_t BSP_Spi_SetCallback (const p_spi_dev_t p_Device, pfEvtCb_t const pfEvtCb, void *pCbParam);
+uint8_t BSP_Spi_ReadWrite_DMA (const p_spi_dev_t p_Device, spi_transceiver_s* const p_Xfr);
+uint8_t BSP_Spi_Wait (const p_spi_dev_t p_Device, uint32_t u32Timeout);
+uint8_t BSP_Spi_Abort (const p_spi_dev_t p_Device);
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,6 +51,7 @@ typedef enum
 	UART_EVT_RX_CPLT  = 0x02, /*!< Reception is complete */
 	UART_EVT_RX_HCPLT = 0x04, /*!< */
 	UART_EVT_RX_ABT   = 0x08, /*!< Timeout */
+	UART_EVT_RX_IDLE  = 0x10, /*!< Idle line (RX ring only) */
 } uart_evt_e;
 
 /*!
@@ -74,6 +75,29 @@ typedef enum
 	UART_MODE_EOB,  /*!< Event is sent when character match the end of block */
 } uart_mode_e;
 
+/*!
+ * @brief This enum define the policy of the UART TX queue when it is full
+ */
+typedef enum
+{
+	UART_TXQ_BLOCK,       /*!< Wait for room, up to the TX timeout (nothing is lost) */
+	UART_TXQ_DROP_OLDEST, /*!< Discard the oldest lines to make room (never wait) */
+} uart_txq_policy_e;
+
+/*!
+ * @brief This structure define the UART TX queue (shared by the devices on the same uart)
+ */
+typedef struct
+{
+	uint8_t *pBuf;               /*!< Queue buffer */
+	uint16_t u16Size;            /*!< Queue size */
+	uint16_t u16Rd;              /*!< Read position (next byte to send) */
+	uint16_t u16Wr;              /*!< Write position */
+	volatile uint16_t u16Count;  /*!< Number of queued bytes */
+	volatile uint16_t u16Keep;   /*!< Number of queued bytes (from the read position) that can't be dropped */
+	volatile uint32_t u32Drop;   /*!< Number of dropped bytes */
+} uart_tx_queue_t;
+
 /*!
  * @brief This structure define the UART device
  */
@@ -88,6 +112,8 @@ typedef struct
     pfEvtCb_t pfEvent;    /*!< Function pointer on event call-back */
     void *pCbParam;       /*!< Pointer on Call-back parameter */
     void *hHandle;        /*!< Pointer on HAL UART handle*/
+    uart_tx_queue_t *pTxQueue; /*!< Pointer on the TX queue (NULL : polling TX) */
+    uint8_t u8TxPolicy;   /*!< TX queue policy (see @link uart_txq_policy_e @endlink) */
 } uart_dev_t;
 
 /*!
@@ -115,6 +141,10 @@ typedef uart_dev_t* p_uart_dev_t;
 #define LOGGER_RX_TIMEOUT 0xFFFFFFFF
 #endif
 
+#ifndef UART_TX_QUEUE_LEN
+#define UART_TX_QUEUE_LEN 1024
+#endif
+
 /*!
  * @}
  * @endcond
@@ -140,6 +170,23 @@ uint8_t BSP_Uart_AbortReceive(uint8_t u8DevId);
 uint16_t BSP_Uart_GetNbReceive(uint8_t u8DevId);
 uint16_t BSP_Uart_GetNbTransmit(uint8_t u8DevId);
 
+#ifdef USE_UART_RX_DMA
+uint8_t BSP_Uart_RxRing_Start(uint8_t u8DevId, uint8_t *pBuf, uint16_t u16Size);
+uint8_t BSP_Uart_RxRing_Stop(uint8_t u8DevId);
+uint8_t BSP_Uart_RxRing_Peek(uint8_t u8DevId, uint16_t u16Offset, uint8_t **ppData, uint16_t *pu16Len);
+uint8_t BSP_Uart_RxRing_Release(uint8_t u8DevId, uint16_t u16Len);
+uint8_t BSP_Uart_RxRing_Arm(uint8_t u8DevId, uint16_t u16Seen);
+uint8_t BSP_Uart_RxRing_Disarm(uint8_t u8DevId);
+#endif
+
+#ifdef USE_UART_TX_QUEUE
+uint8_t BSP_Uart_TxQueue_Send(uint8_t u8DevId, const uint8_t *pData, uint16_t u16Length);
+void BSP_Uart_TxQueue_Yield(void);
+uint8_t BSP_Uart_TxQueue_Flush(uint8_t u8DevId, uint32_t u32Tmo);
+uint8_t BSP_Uart_TxQueue_SetPolicy(uint8_t u8DevId, uint8_t u8Policy);
+uint32_t BSP_Uart_TxQueue_GetDropped(uint8_t u8DevId);
+#endif
+
 /*******************************************************************************/
 #ifdef __cplusplus
 }
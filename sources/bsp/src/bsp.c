@@ -155,10 +155,41 @@ int __io_putchar(int ch){
 		nb = 2;
 		((uint8_t *)&ch)[1] = '\r';
 	}
+#ifdef USE_UART_TX_QUEUE
+	BSP_Uart_TxQueue_Send(STDOUT_UART_ID, (uint8_t *)&ch, nb);
+#else
 	HAL_UART_Transmit(aDevUart[STDOUT_UART_ID].hHandle, (uint8_t *)&ch, nb, aDevUart[STDOUT_UART_ID].u32TxTmo);
+#endif
 	return ch;
 }
 
+#ifdef USE_UART_TX_QUEUE
+/*
+ * Queue the whole string at once instead of one __io_putchar per character
+ * (overload the weak one from syscalls.c)
+ */
+int _write(int file, char *ptr, int len)
+{
+	static const uint8_t u8Cr = '\r';
+	int i, s = 0;
+
+	for (i = 0; i < len; i++)
+	{
+		if (ptr[i] == '\n')
+		{
+			BSP_Uart_TxQueue_Send(STDOUT_UART_ID, (uint8_t *)&ptr[s], i + 1 - s);
+			BSP_Uart_TxQueue_Send(STDOUT_UART_ID, &u8Cr, 1);
+			s = i + 1;
+		}
+	}
+	if (s < len)
+	{
+		BSP_Uart_TxQueue_Send(STDOUT_UART_ID, (uint8_t *)&ptr[s], len - s);
+	}
+	return len;
+}
+#endif
+
 int __io_getchar(void){
 	int c;
 	HAL_UART_Receive(aDevUart[STDOUT_UART_ID].hHandle, (uint8_t*)&c, 1, aDevUart[STDOUT_UART_ID].u32RxTmo);
@@ -39,6 +39,7 @@ extern "C" {
 
 /******************************************************************************/
 #include "bsp_lp.h"
+#include "bsp_rtc.h"
 #include "platform.h"
 #include <stm32l4xx_hal.h>
 
@@ -162,6 +163,8 @@ __attribute__((weak)) const uint16_t u16LpPdPortI = 0;
 
 static void _bsp_lp_setup_pupd_(void);
 
+static volatile uint8_t _u8StopInhibit_; /*!< see lp_stop_inhibit_msk */
+
 static void _bsp_lp_setup_pupd_(void)
 {
 	/* Set PU/PD on port A */
@@ -270,6 +273,116 @@ void BSP_LowPower_Enter (lp_mode_e eLpMode)
 	}
 }
 
+/*!
+  * @brief This function inhibit (or allow) the STOP mode while idle
+  *
+  * @details Each source is independent, the STOP mode is allowed when none
+  * inhibit it. Could be called from an interrupt.
+  *
+  * @param [in] u8Src    The source (see @link lp_stop_inhibit_msk @endlink)
+  * @param [in] bInhibit 1 to inhibit, 0 to allow
+  *
+  */
+void BSP_LowPower_StopInhibit(uint8_t u8Src, uint8_t bInhibit)
+{
+	uint32_t u32Primask = __get_PRIMASK();
+	__disable_irq();
+	if (bInhibit)
+	{
+		_u8StopInhibit_ |= u8Src;
+	}
+	else
+	{
+		_u8StopInhibit_ &= ~u8Src;
+	}
+	__set_PRIMASK(u32Primask);
+}
+
+/*!
+  * @brief This function tell if the STOP mode is inhibited
+  *
+  * @return The inhibiting sources (see @link lp_stop_inhibit_msk @endlink), 0 if none
+  */
+uint8_t BSP_LowPower_IsStopInhibited(void)
+{
+	return _u8StopInhibit_;
+}
+
+/*!
+  * @brief This function sleep for an idle time (i.e. the RTOS tickless idle)
+  *
+  * @details Must be called with the interrupts masked : any interrupt ends
+  * the idle time but is only served after the return. The SysTick and the HAL
+  * tick are stopped, the RTC wake-up timer ends the idle time. The STOP2 mode
+  * is used when the idle time is long enough and no source inhibit it,
+  * otherwise the SLEEP mode. The elapsed time is measured with the RTC
+  * sub-seconds, the HAL tick is corrected (the fraction of millisecond is
+  * carried to the next call).
+  *
+  * If the RTC wake-up timer is not available, the CPU just sleep until the
+  * next interrupt with the tick running (return 0).
+  *
+  * @param [in] u32Ms The expected idle time in millisecond
+  *
+  * @return The elapsed time in millisecond (up to u32Ms)
+  */
+uint32_t BSP_LowPower_Idle(uint32_t u32Ms)
+{
+	static uint32_t u32Rem;
+	uint32_t u32Start, u32Elapse;
+	uint8_t bStop;
+
+	if (u32Ms > LP_IDLE_MAX_MS)
+	{
+		u32Ms = LP_IDLE_MAX_MS;
+	}
+	if ( BSP_Rtc_WakeUpTimer_StartMs(u32Ms) )
+	{
+		HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+		return 0;
+	}
+	bStop = ( (u32Ms >= LP_IDLE_STOP_MIN_MS) && (_u8StopInhibit_ == 0) );
+	u32Start = BSP_Rtc_Time_GetDayTicks(0);
+
+	CLEAR_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Msk);
+	HAL_SuspendTick();
+	if (bStop)
+	{
+		MODIFY_REG(PWR->CR1, PWR_CR1_LPMS, LP_STOP2_MODE);
+		BSP_LowPower_OnStopEnter(LP_STOP2_MODE);
+		SET_BIT(SCB->SCR, ((uint32_t)SCB_SCR_SLEEPDEEP_Msk));
+		__WFI();
+		CLEAR_BIT(SCB->SCR, ((uint32_t)SCB_SCR_SLEEPDEEP_Msk));
+		BSP_LowPower_OnStopExit(LP_STOP2_MODE);
+	}
+	else
+	{
+		HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+	}
+	// After STOP, the RTC shadow registers are not up to date
+	u32Elapse = BSP_Rtc_Time_GetDayTicks(bStop);
+	BSP_Rtc_WakeUpTimer_StopMs();
+
+	// RTC sub-seconds to ms, modulo one day (midnight in between)
+	u32Elapse = (u32Elapse + 86400*(RTC_PREDIV_S + 1) - u32Start) % (86400*(RTC_PREDIV_S + 1));
+	if ( u32Elapse <= (u32Ms / 1000 + 1) * (RTC_PREDIV_S + 1) )
+	{
+		u32Elapse = u32Elapse * 1000 + u32Rem;
+		u32Rem = u32Elapse % (RTC_PREDIV_S + 1);
+		u32Elapse /= (RTC_PREDIV_S + 1);
+	}
+	if (u32Elapse > u32Ms)
+	{
+		u32Elapse = u32Ms;
+		u32Rem = 0;
+	}
+	// HAL tick (TIM6) has missed the idle time
+	uwTick += u32Elapse;
+	HAL_ResumeTick();
+	SET_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Msk);
+	return u32Elapse;
+}
+
 __attribute__((weak)) void BSP_LowPower_OnStandbyShutdwnEnter(lp_mode_e eLpMode)
 {
 	(void)eLpMode;
@@ -92,6 +92,54 @@ static uint16_t _set_prescaler_(LPTIM_HandleTypeDef *hlptim, uint32_t u32NbClkCy
 }
 #endif
 
+/*!
+ * @brief Initialize a LPTim as simple one-shot timer (internal clock, default
+ *        PCLK, software start)
+ *
+ * @param [in] u8TimerId Timer id (0 : LPTIM2, otherwise : LPTIM1)
+ *
+ * @retval DEV_SUCCESS (see dev_res_e::DEV_SUCCESS)
+ * @retval DEV_FAILURE (see dev_res_e::DEV_FAILURE)
+ */
+uint8_t BSP_LpTimer_Init(const uint8_t u8TimerId)
+{
+	uint8_t eRet = DEV_FAILURE;
+#if defined(HAL_LPTIM_MODULE_ENABLED)
+	LPTIM_HandleTypeDef *pHandle;
+	if (u8TimerId)
+	{
+#if defined (LPTIM1)
+		pHandle = &hlptim1;
+		pHandle->Instance = LPTIM1;
+#else
+		return eRet;
+#endif
+	}
+	else
+	{
+#if defined (LPTIM2)
+		pHandle = &hlptim2;
+		pHandle->Instance = LPTIM2;
+#else
+		return eRet;
+#endif
+	}
+	pHandle->Init.Clock.Source = LPTIM_CLOCKSOURCE_APBCLOCK_LPOSC;
+	pHandle->Init.Clock.Prescaler = LPTIM_PRESCALER_DIV1;
+	pHandle->Init.Trigger.Source = LPTIM_TRIGSOURCE_SOFTWARE;
+	pHandle->Init.OutputPolarity = LPTIM_OUTPUTPOLARITY_HIGH;
+	pHandle->Init.UpdateMode = LPTIM_UPDATE_IMMEDIATE;
+	pHandle->Init.CounterSource = LPTIM_COUNTERSOURCE_INTERNAL;
+	pHandle->Init.Input1Source = LPTIM_INPUT1SOURCE_GPIO;
+	pHandle->Init.Input2Source = LPTIM_INPUT2SOURCE_GPIO;
+	if (HAL_LPTIM_Init(pHandle) == HAL_OK)
+	{
+		eRet = DEV_SUCCESS;
+	}
+#endif
+	return eRet;
+}
+
 // u32Elapse is in ms
 uint32_t BSP_LpTimer_Start(const uint8_t u8TimerId, uint32_t u32Elapse)
 {
@@ -126,6 +174,59 @@ uint32_t BSP_LpTimer_Start(const uint8_t u8TimerId, uint32_t u32Elapse)
 	return u32NbClkCyc;
 }
 
+/*!
+ * @brief Start a LPTim one-shot timer with a micro-second delay
+ *
+ * @details The handler (see BSP_LpTimer_SetHandler) is called from the compare
+ * match interrupt. The resolution is the LPTim clock period times the
+ * prescaler, selected to fit the delay in 16 bits (e.g. 21 ns up to 1.3 ms,
+ * 0.33 us up to 21 ms with a 48 MHz PCLK).
+ *
+ * @param [in] u8TimerId Timer id (0 : LPTIM2, otherwise : LPTIM1)
+ * @param [in] u32Us     Delay in micro-second
+ *
+ * @return The number of timer counts (0 : out of range, the timer is not started)
+ */
+uint32_t BSP_LpTimer_StartUs(const uint8_t u8TimerId, uint32_t u32Us)
+{
+	uint32_t u32NbClkCyc = 0;
+#if defined(HAL_LPTIM_MODULE_ENABLED)
+	uint32_t frequency;
+	LPTIM_HandleTypeDef *pHandle;
+	if (u8TimerId)
+	{
+#if defined (LPTIM1)
+		frequency = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_LPTIM1);
+		pHandle = &hlptim1;
+#else
+		return 0;
+#endif
+	}
+	else
+	{
+#if defined (LPTIM2)
+		frequency = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_LPTIM2);
+		pHandle = &hlptim2;
+#else
+		return 0;
+#endif
+	}
+	HAL_LPTIM_SetOnce_Stop_IT(pHandle);
+	// u32Us is in micro-second and frequency in Hertz
+	u32NbClkCyc = (uint32_t)( ((uint64_t)frequency * u32Us) / 1000000 );
+	if ( (u32NbClkCyc == 0) || (u32NbClkCyc > NB_CYC_MAX) )
+	{
+		return 0;
+	}
+	u32NbClkCyc = (uint32_t)_set_prescaler_(pHandle, u32NbClkCyc);
+	HAL_LPTIM_SetOnce_Start_IT(pHandle, 0xFFFF, u32NbClkCyc);
+#else
+	(void)u8TimerId;
+	(void)u32Us;
+#endif
+	return u32NbClkCyc;
+}
+
 uint32_t BSP_LpTimer_Stop(const uint8_t u8TimerId)
 {
 	uint32_t u32NbClkCyc = 0;
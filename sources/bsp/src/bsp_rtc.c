@@ -51,6 +51,9 @@ __attribute__((weak)) __attribute__((used)) uint32_t _wakeup_period_ = 86400; //
 __attribute__((used)) static pfEventCB_t pfWakeUpTimerCallBack;
 __attribute__((used)) static pfEventCB_t pfUpdateTimeCallBack;
 
+static uint8_t _bWutShort_;  /*!< The wake-up timer is borrowed for a short delay */
+static uint8_t _bWutWasOn_;  /*!< The periodic wake-up was on before the short delay */
+
 /*!
  * @}
  * @endcond
@@ -215,6 +218,31 @@ void BSP_Rtc_Time_ReadMicro(struct timeval * tp)
     }
 }
 
+/*!
+  * @brief This function get the time of the day in sub-second (1/(RTC_PREDIV_S+1) second)
+  *
+  * @param [in] bSync Wait for the shadow registers synchronization first (i.e. after a STOP mode)
+  *
+  * @return the number of sub-seconds since midnight
+  *
+  */
+uint32_t BSP_Rtc_Time_GetDayTicks(uint8_t bSync)
+{
+	RTC_DateTypeDef sDate;
+	RTC_TimeTypeDef sTime;
+	if (bSync)
+	{
+		__HAL_RTC_WRITEPROTECTION_DISABLE(&hrtc);
+		HAL_RTC_WaitForSynchro(&hrtc);
+		__HAL_RTC_WRITEPROTECTION_ENABLE(&hrtc);
+	}
+	// Warning: the time must be read first!
+	HAL_RTC_GetTime(&hrtc, &sTime, FORMAT_BIN);
+	HAL_RTC_GetDate(&hrtc, &sDate, FORMAT_BIN);
+	return ( ( (sTime.Hours)*60 + sTime.Minutes )*60  + sTime.Seconds ) * (sTime.SecondFraction + 1)
+			+ (sTime.SecondFraction - sTime.SubSeconds);
+}
+
 /*!
   * @brief This function get the millisecond epoch time 
   *
@@ -388,6 +416,75 @@ void BSP_Rtc_WakeUpTimer_SetHandler (pfHandlerCB_t const pfCb)
 		pfWakeUpTimerEvent = _rtc_wakeUptimer_handler_;
 	}
 }
+
+/*!
+  * @brief This function borrow the RTC wake-up timer for a short delay (i.e. to end a low power idle time)
+  *
+  * @details The periodic wake-up (see BSP_Rtc_WakeUptimer_Reload) is suspended until
+  * BSP_Rtc_WakeUpTimer_StopMs. The delay is refused when the periodic wake-up
+  * is due before its end or when a forced notify is on-going. The wake-up timer
+  * is clocked by RTCCLK/16 (2048 Hz with the LSE).
+  *
+  * @param [in] u32Ms The delay in millisecond (1 to RTC_WUT_SHORT_MAX_MS)
+  *
+  * @retval 0 if the delay is started
+  * @retval 1 otherwise
+  */
+uint8_t BSP_Rtc_WakeUpTimer_StartMs(uint32_t u32Ms)
+{
+	RTC_DateTypeDef sDate;
+	RTC_TimeTypeDef sTime;
+	uint32_t u32Now;
+
+	if ( _bWutShort_ || (u32Ms == 0) || (u32Ms > RTC_WUT_SHORT_MAX_MS) )
+	{
+		return 1;
+	}
+	_bWutWasOn_ = (READ_BIT(hrtc.Instance->CR, RTC_CR_WUTE) != 0);
+	if (_bWutWasOn_)
+	{
+		if ( READ_BIT(hrtc.Instance->CR, RTC_CR_WUCKSEL) < RTC_WAKEUPCLOCK_CK_SPRE_16BITS )
+		{
+			// forced notify is on-going
+			return 1;
+		}
+		// Warning: the time must be read first!
+		HAL_RTC_GetTime(&hrtc, &sTime, FORMAT_BIN);
+		HAL_RTC_GetDate(&hrtc, &sDate, FORMAT_BIN);
+		u32Now = ( (sTime.Hours)*60 + sTime.Minutes )*60  + sTime.Seconds;
+		if ( (_wakeup_period_ - (u32Now % _wakeup_period_)) <= (u32Ms / 1000) + 2 )
+		{
+			// periodic wake-up is too close
+			return 1;
+		}
+	}
+	_bWutShort_ = 1;
+	HAL_RTCEx_SetWakeUpTimer_IT(&hrtc, ((u32Ms * 2048) / 1000) - 1, RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+	return 0;
+}
+
+/*!
+  * @brief This function end the short delay and restore the periodic wake-up
+  *
+  * @details The short delay expiration (if any) is cleared, so it is not seen
+  * as a periodic wake-up.
+  *
+  */
+void BSP_Rtc_WakeUpTimer_StopMs(void)
+{
+	if (_bWutShort_)
+	{
+		HAL_RTCEx_DeactivateWakeUpTimer(&hrtc);
+		__HAL_RTC_WAKEUPTIMER_CLEAR_FLAG(&hrtc, RTC_FLAG_WUTF);
+		__HAL_RTC_WAKEUPTIMER_EXTI_CLEAR_FLAG();
+		HAL_NVIC_ClearPendingIRQ(RTC_WKUP_IRQn);
+		_bWutShort_ = 0;
+		if (_bWutWasOn_)
+		{
+			BSP_Rtc_WakeUptimer_Reload();
+		}
+	}
+}
 /*******************************************************************************/
 
 /*!
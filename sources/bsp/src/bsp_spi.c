@@ -56,9 +56,28 @@
 
 extern SPI_HandleTypeDef *paSPI_BusHandle[SPI_ID_MAX];
 
+#if defined(USE_SPI_DMA)
+/*!
+  * @static
+  * @brief This hold the device owning the SPI bus during a DMA transfer
+  */
+static p_spi_dev_t volatile _pSpiDmaDev_[SPI_ID_MAX];
+#endif
+
+/*!
+  * @static
+  * @brief This hold the SPI bitrate currently applied on each bus
+  */
+static struct {
+	uint32_t u32_Hertz;     /*!< Requested bitrate (0 : unknown, full init required) */
+	uint32_t u32_CoreClock; /*!< SystemCoreClock the prescaler was computed with */
+	uint32_t u32_Cfgr;      /*!< RCC AHB/APB prescalers the prescaler was computed with */
+} _sSpiRate_[SPI_ID_MAX];
+
 static uint32_t _get_SPI_freq_(void);
 static uint8_t _get_APB_div_(void);
 static uint32_t _get_SPI_freq_(void);
+static inline void _spi_rate_invalidate_(const p_spi_dev_t p_Device);
 
 /*!
   * @static
@@ -177,6 +196,20 @@ static uint32_t _get_SPI_freq_(void){
 	return spi_freq;
 }
 
+/*!
+  * @static
+  * @brief Forget the bitrate applied on the device bus
+  *
+  * @details The next BSP_Spi_SetBitrate will fully re-initialize the bus.
+  *
+  * @param [in] p_Device Pointer on the spi device structure
+  *
+  */
+static inline void _spi_rate_invalidate_(const p_spi_dev_t p_Device)
+{
+	_sSpiRate_[p_Device->bus_id].u32_Hertz = 0;
+}
+
 /*!
   * @brief Initialize the SPI peripheral
   *
@@ -227,6 +260,7 @@ uint8_t BSP_Spi_SetDefault(const p_spi_dev_t p_Device)
     p_handle->Init.CLKPhase          = SPI_PHASE_1EDGE;
     p_handle->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2;
 
+    _spi_rate_invalidate_(p_Device);
     return DEV_SUCCESS;
 }
 
@@ -257,12 +291,17 @@ uint8_t BSP_Spi_Close (const p_spi_dev_t p_Device)
 {
 	HAL_SPI_MspDeInit(paSPI_BusHandle[p_Device->bus_id]);
 	BSP_Gpio_SetLow(p_Device->ss_port, p_Device->ss_pin);
+	_spi_rate_invalidate_(p_Device);
 	return DEV_SUCCESS;
 }
 
 /*!
   * @brief Set the SPI clock frequency
   *
+  * @details The applied bitrate is cached per bus : nothing is done if the
+  * same bitrate is requested again (and the bus clock didn't change). Once the
+  * bus is initialized, a bitrate change only updates the prescaler.
+  *
   * @param [in] p_Device  Pointer on the spi device structure
   * @param [in] u32_Hertz Frequency to set (in Hertz)
   *
@@ -276,6 +315,18 @@ uint8_t BSP_Spi_SetBitrate (const p_spi_dev_t p_Device, const uint32_t u32_Hertz
 	int spi_hz = 0;
 	uint8_t prescaler_rank = 0;
 	uint8_t last_index = (sizeof(prescaler_table) / sizeof(prescaler_table[0])) - 1;
+	SPI_HandleTypeDef *p_handle = paSPI_BusHandle[p_Device->bus_id];
+	uint32_t u32_Cfgr = RCC->CFGR & (RCC_CFGR_HPRE_Msk | RCC_CFGR_PPRE2_Msk);
+	uint8_t b_Valid;
+
+	b_Valid = (_sSpiRate_[p_Device->bus_id].u32_CoreClock == SystemCoreClock) &&
+	          (_sSpiRate_[p_Device->bus_id].u32_Cfgr == u32_Cfgr) &&
+	          (p_handle->State != HAL_SPI_STATE_RESET);
+	if ( b_Valid && (_sSpiRate_[p_Device->bus_id].u32_Hertz == u32_Hertz) )
+	{
+		/* Already applied */
+		return DEV_SUCCESS;
+	}
 
 	/* Calculate the spi clock for prescaler_rank 0: SPI_BAUDRATEPRESCALER_2 */
 	spi_hz = _get_SPI_freq_() / 2;
@@ -287,7 +338,7 @@ uint8_t BSP_Spi_SetBitrate (const p_spi_dev_t p_Device, const uint32_t u32_Hertz
 	}
 
 	/*  Use the best fit pre-scaler */
-	paSPI_BusHandle[p_Device->bus_id]->Init.BaudRatePrescaler = prescaler_table[prescaler_rank];
+	p_handle->Init.BaudRatePrescaler = prescaler_table[prescaler_rank];
 
 	/*  In case maximum pre-scaler still gives too high freq, raise an error */
 	if (spi_hz > u32_Hertz) {
@@ -296,7 +347,25 @@ uint8_t BSP_Spi_SetBitrate (const p_spi_dev_t p_Device, const uint32_t u32_Hertz
 
 	DBG_BSP("spi_frequency, request:%d, select:%d\r\n", (int)u32_Hertz, spi_hz);
 
-	return BSP_Spi_Init(p_Device);
+	if ( _sSpiRate_[p_Device->bus_id].u32_Hertz && (p_handle->State != HAL_SPI_STATE_RESET) )
+	{
+		/* Only the prescaler changed : update it (the SPI must be disabled) */
+		if (HAL_SPI_GetState(p_handle) != HAL_SPI_STATE_READY)
+		{
+			return DEV_BUSY;
+		}
+		__HAL_SPI_DISABLE(p_handle);
+		MODIFY_REG(p_handle->Instance->CR1, SPI_CR1_BR_Msk, p_handle->Init.BaudRatePrescaler);
+	}
+	else if (BSP_Spi_Init(p_Device) != DEV_SUCCESS)
+	{
+		_spi_rate_invalidate_(p_Device);
+		return DEV_FAILURE;
+	}
+	_sSpiRate_[p_Device->bus_id].u32_Hertz = u32_Hertz;
+	_sSpiRate_[p_Device->bus_id].u32_CoreClock = SystemCoreClock;
+	_sSpiRate_[p_Device->bus_id].u32_Cfgr = u32_Cfgr;
+	return DEV_SUCCESS;
 }
 
 /*!
@@ -318,6 +387,7 @@ uint8_t BSP_Spi_SetClockPhase (const p_spi_dev_t p_Device, const bool b_Flag)
         	paSPI_BusHandle[p_Device->bus_id]->Init.CLKPhase = SPI_PHASE_1EDGE;
             break;
     }
+	_spi_rate_invalidate_(p_Device);
 	return DEV_SUCCESS;
 }
 
@@ -340,6 +410,7 @@ uint8_t BSP_Spi_SetClockPol (const p_spi_dev_t p_Device, const bool b_Flag)
 			paSPI_BusHandle[p_Device->bus_id]->Init.CLKPolarity = SPI_POLARITY_LOW;
 			break;
 	}
+	_spi_rate_invalidate_(p_Device);
 	return DEV_SUCCESS;
 }
 
@@ -379,4 +450,184 @@ uint8_t BSP_Spi_ReadWrite (const p_spi_dev_t p_Device, spi_transceiver_s* const
 	return ret;
 }
 
+/*!
+  * @brief Set the SPI device event callback
+  *
+  * @param [in] p_Device Pointer on the spi device structure
+  * @param [in] pfEvtCb  Pointer on the callback function (called from ISR)
+  * @param [in] pCbParam Pointer on the callback parameter
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given device is NULL (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  *
+  */
+uint8_t BSP_Spi_SetCallback (const p_spi_dev_t p_Device, pfEvtCb_t const pfEvtCb, void *pCbParam)
+{
+	if (p_Device == NULL)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	p_Device->pfEvent = pfEvtCb;
+	p_Device->pCbParam = pCbParam;
+
+	return DEV_SUCCESS;
+}
+
+/*!
+  * @brief Start a DMA Read and Write on the SPI bus
+  *
+  * The chip select is released and the device event callback is called (with
+  * SPI_EVT_XFER_CPLT or SPI_EVT_XFER_ERR) from the DMA completion interrupt.
+  * Transmit and receive buffers must remain valid until that event.
+  *
+  * @param [in]     p_Device Pointer on the spi device structure
+  * @param [in,out] p_Xfr    Pointer on data structure
+  *
+  * @retval DEV_SUCCESS if the transfer is started (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_FAILURE if failed (see @link dev_res_e::DEV_FAILURE @endlink)
+  * @retval DEV_BUSY if the given device is busy (see @link dev_res_e::DEV_BUSY @endlink)
+  *
+  */
+uint8_t BSP_Spi_ReadWrite_DMA (const p_spi_dev_t p_Device, spi_transceiver_s* const p_Xfr)
+{
+#if defined(USE_SPI_DMA)
+	uint8_t ret = DEV_SUCCESS;
+	uint8_t u8_Status;
+	SPI_HandleTypeDef *p_handle = paSPI_BusHandle[p_Device->bus_id];
+	if (HAL_SPI_GetState(p_handle) == HAL_SPI_STATE_READY)
+	{
+		_pSpiDmaDev_[p_Device->bus_id] = p_Device;
+		BSP_Gpio_SetLow(p_Device->ss_port, p_Device->ss_pin);
+		u8_Status = HAL_SPI_TransmitReceive_DMA(
+				p_handle,
+				p_Xfr->pTransmitter,
+				p_Xfr->pReceiver,
+				p_Xfr->ReceiverBytes);
+		if ( u8_Status != HAL_OK )
+		{
+			DBG_BSP("SPI %x Transmit DMA: status %d\r\n", p_handle->Instance, u8_Status);
+			BSP_Gpio_SetHigh(p_Device->ss_port, p_Device->ss_pin);
+			_pSpiDmaDev_[p_Device->bus_id] = NULL;
+			ret = DEV_FAILURE;
+		}
+	}
+	else {
+		ret = DEV_BUSY;
+	}
+	return ret;
+#else
+	(void)p_Device;
+	(void)p_Xfr;
+	return DEV_FAILURE;
+#endif
+}
+
+/*!
+  * @brief Wait (polling) for the end of the on-going DMA transfer
+  *
+  * @param [in] p_Device   Pointer on the spi device structure
+  * @param [in] u32Timeout Timeout in milliseconds
+  *
+  * @retval DEV_SUCCESS if no transfer is on-going (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_TIMEOUT if the transfer is still on-going (see @link dev_res_e::DEV_TIMEOUT @endlink)
+  *
+  */
+uint8_t BSP_Spi_Wait (const p_spi_dev_t p_Device, uint32_t u32Timeout)
+{
+#if defined(USE_SPI_DMA)
+	uint32_t u32TickStart = HAL_GetTick();
+	while (_pSpiDmaDev_[p_Device->bus_id] != NULL)
+	{
+		if ( (HAL_GetTick() - u32TickStart) > u32Timeout)
+		{
+			return DEV_TIMEOUT;
+		}
+	}
+#else
+	(void)p_Device;
+	(void)u32Timeout;
+#endif
+	return DEV_SUCCESS;
+}
+
+/*!
+  * @brief Abort the on-going DMA transfer (no event is sent)
+  *
+  * @param [in] p_Device Pointer on the spi device structure
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_FAILURE if failed (see @link dev_res_e::DEV_FAILURE @endlink)
+  *
+  */
+uint8_t BSP_Spi_Abort (const p_spi_dev_t p_Device)
+{
+	uint8_t ret = DEV_SUCCESS;
+#if defined(USE_SPI_DMA)
+	_pSpiDmaDev_[p_Device->bus_id] = NULL;
+	if (HAL_SPI_Abort(paSPI_BusHandle[p_Device->bus_id]) != HAL_OK)
+	{
+		ret = DEV_FAILURE;
+	}
+	BSP_Gpio_SetHigh(p_Device->ss_port, p_Device->ss_pin);
+#else
+	(void)p_Device;
+#endif
+	return ret;
+}
+
+#if defined(USE_SPI_DMA)
+/*!
+  * @static
+  * @brief Release the chip select and notify the device owning the bus
+  *
+  * @param [in] hspi Pointer on the HAL SPI handle
+  * @param [in] evt  Event to notify (see @link spi_evt_e @endlink)
+  *
+  */
+static void _spi_dma_end_(SPI_HandleTypeDef *hspi, uint32_t evt)
+{
+	uint8_t bus_id;
+	p_spi_dev_t p_Device;
+	for (bus_id = 0; bus_id < SPI_ID_MAX; bus_id++)
+	{
+		if (paSPI_BusHandle[bus_id] == hspi)
+		{
+			p_Device = _pSpiDmaDev_[bus_id];
+			if (p_Device)
+			{
+				BSP_Gpio_SetHigh(p_Device->ss_port, p_Device->ss_pin);
+				_pSpiDmaDev_[bus_id] = NULL;
+				if (p_Device->pfEvent)
+				{
+					p_Device->pfEvent(p_Device->pCbParam, evt);
+				}
+			}
+			break;
+		}
+	}
+}
+
+/*!
+  * @brief Tx and Rx Transfer completed callback (override the HAL weak one)
+  *
+  * @param [in] hspi Pointer on the HAL SPI handle
+  *
+  */
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+	_spi_dma_end_(hspi, SPI_EVT_XFER_CPLT);
+}
+
+/*!
+  * @brief SPI error callback (override the HAL weak one)
+  *
+  * @param [in] hspi Pointer on the HAL SPI handle
+  *
+  */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+	_spi_dma_end_(hspi, SPI_EVT_XFER_ERR);
+}
+#endif
+
 /*! @} */
@@ -38,8 +38,10 @@ extern "C" {
 #endif
 
 #include "bsp_uart.h"
+#include "bsp_lp.h"
 #include "platform.h"
 #include <stm32l4xx_hal.h>
+#include <string.h>
 
 extern uart_dev_t aDevUart[UART_ID_MAX];
 
@@ -50,6 +52,41 @@ extern void HAL_UART_MspDeInit(UART_HandleTypeDef* huart);
 static void _bsp_com_TxISR_8BIT(UART_HandleTypeDef *huart);
 static void _bsp_com_RxISR_8BIT(UART_HandleTypeDef *huart);
 
+#ifdef USE_UART_RX_DMA
+/*!
+  * @static
+  * @brief This struct define the DMA circular RX ring of one uart
+  */
+typedef struct
+{
+	uint8_t *pBuf;           /*!< Ring buffer (written by the DMA, NULL : not started) */
+	uint16_t u16Size;        /*!< Ring size */
+	uint16_t u16Pos;         /*!< Last seen DMA write position */
+	uint16_t u16Rd;          /*!< Read position */
+	volatile uint32_t u32Wr; /*!< Number of written bytes (wraps) */
+	uint32_t u32Rd;          /*!< Number of released bytes (wraps) */
+	volatile uint8_t bOvfl;  /*!< Unread bytes have been overwritten */
+	volatile uint8_t bArmed; /*!< The next event is sent to the call-back */
+} uart_rx_ring_t;
+
+static uart_rx_ring_t _aRxRing_[UART_ID_MAX];
+
+static void _bsp_com_RxRingISR(UART_HandleTypeDef *huart);
+static void _bsp_com_RxRingDmaISR(DMA_HandleTypeDef *hdma);
+static uint8_t _rx_ring_dev_id_(UART_HandleTypeDef *huart);
+static void _rx_ring_update_(uint8_t u8DevId);
+static void _rx_ring_event_(uint8_t u8DevId, uint32_t evt);
+#endif
+
+#ifdef USE_UART_TX_QUEUE
+static void _bsp_com_TxQueueISR(UART_HandleTypeDef *huart);
+static uint16_t _tx_queue_put_(uart_tx_queue_t *pQueue, const uint8_t *pData, uint16_t u16Length);
+static void _tx_queue_drop_(uart_tx_queue_t *pQueue, uint16_t u16Need);
+static void _tx_queue_kick_(uint8_t u8DevId);
+static void _tx_queue_poll_(uint8_t u8DevId);
+#endif
+static void _uart_irq_disable_(uint8_t u8DevId);
+
 /*******************************************************************************/
 uint8_t BSP_Console_Init(void)
 {
@@ -63,7 +100,11 @@ uint8_t BSP_Console_Send(uint8_t *pData, uint16_t u16Length)
 {
 	dev_res_e eRet = DEV_INVALID_PARAM;
 
+#ifdef USE_UART_TX_QUEUE
+	eRet = BSP_Uart_TxQueue_Send(UART_ID_COM, pData, u16Length);
+#else
 	eRet = HAL_UART_Transmit(aDevUart[UART_ID_COM].hHandle, pData, u16Length, aDevUart[UART_ID_COM].u32TxTmo);
+#endif
 	//eRet = HAL_UART_Transmit(aDevUart[UART_ID_COM].hHandle, pData, u16Length, CONSOLE_TX_TIMEOUT);
 	//eRet = HAL_UART_Transmit_DMA(paUART_BusHandle[UART_ID_CONSOLE], pData, u16Length);
 	//eRet = HAL_UART_Transmit_IT(paUART_BusHandle[UART_ID_CONSOLE], pData, u16Length);
@@ -232,6 +273,14 @@ uint8_t BSP_Uart_Init(uint8_t u8DevId, uint8_t u8CharMatch, uint8_t u8Mode)
 	huart->RxISR = _bsp_com_RxISR_8BIT;
 	huart->TxISR = _bsp_com_TxISR_8BIT;
 
+#ifdef USE_TICKLESS_IDLE
+	if (IS_LPUART_INSTANCE(huart->Instance))
+	{
+		// Keep receiving in STOP2, the RXNE interrupt wakes-up (kernel clock HSI16)
+		SET_BIT(huart->Instance->CR1, USART_CR1_UESM);
+	}
+#endif
+
 	 __HAL_UART_ENABLE(huart);
 	return DEV_SUCCESS;
 }
@@ -418,7 +467,7 @@ uint8_t BSP_Uart_AbortReceive(uint8_t u8DevId)
 		/* Restore huart->RxState to Ready */
 	    huart->RxState = HAL_UART_STATE_READY;
 	}
-	HAL_NVIC_DisableIRQ(aDevUart[u8DevId].i8ItLine);
+	_uart_irq_disable_(u8DevId);
 	return DEV_SUCCESS;
 }
 
@@ -460,6 +509,514 @@ uint16_t BSP_Uart_GetNbTransmit(uint8_t u8DevId)
 	return (huart->TxXferSize - huart->TxXferCount);
 }
 
+#ifdef USE_UART_RX_DMA
+/*!
+  * @brief Start to receive on the given uart into a circular ring (DMA mode)
+  *
+  * @details The DMA fills the ring continuously, so nothing is lost between two
+  * commands and the CPU is only interrupted on the idle line, the character
+  * match (if the uart mode is UART_MODE_EOB) and each half of the ring. The
+  * received bytes are read in place (see BSP_Uart_RxRing_Peek), then released
+  * (see BSP_Uart_RxRing_Release). The uart must be opened, its RX DMA channel
+  * linked (circular mode) by the MSP.
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  * @param [in] pBuf    Pointer on the ring buffer
+  * @param [in] u16Size Size of the ring buffer
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given parameter is invalid (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  * @retval DEV_BUSY if the given device is busy (see @link dev_res_e::DEV_BUSY @endlink)
+  * @retval DEV_FAILURE if the DMA can't be started (see @link dev_res_e::DEV_FAILURE @endlink)
+  *
+  */
+uint8_t BSP_Uart_RxRing_Start(uint8_t u8DevId, uint8_t *pBuf, uint16_t u16Size)
+{
+	if ( (u8DevId >= UART_ID_MAX) || (pBuf == NULL) || (u16Size == 0U) )
+	{
+		return DEV_INVALID_PARAM;
+	}
+	UART_HandleTypeDef *huart = aDevUart[u8DevId].hHandle;
+	uart_rx_ring_t *pRing = &(_aRxRing_[u8DevId]);
+	uint32_t itflags = USART_CR1_IDLEIE;
+
+	if (huart->hdmarx == NULL)
+	{
+		return DEV_FAILURE;
+	}
+	/* Check that a Rx process is not already ongoing */
+	if (huart->RxState != HAL_UART_STATE_READY)
+	{
+		return DEV_BUSY;
+	}
+
+	__HAL_LOCK(huart);
+	pRing->pBuf = pBuf;
+	pRing->u16Size = u16Size;
+	pRing->u16Pos = 0;
+	pRing->u16Rd = 0;
+	pRing->u32Wr = 0;
+	pRing->u32Rd = 0;
+	pRing->bOvfl = 0;
+	pRing->bArmed = 0;
+
+	huart->RxState = HAL_UART_STATE_BUSY_RX;
+	huart->ErrorCode = HAL_UART_ERROR_NONE;
+	huart->RxISR = _bsp_com_RxRingISR;
+	huart->hdmarx->XferCpltCallback = _bsp_com_RxRingDmaISR;
+	huart->hdmarx->XferHalfCpltCallback = _bsp_com_RxRingDmaISR;
+	huart->hdmarx->XferErrorCallback = NULL;
+	huart->hdmarx->XferAbortCallback = NULL;
+
+	/* Discard the received data, clear the idle, character match and error flags */
+	__HAL_UART_SEND_REQ(huart, UART_RXDATA_FLUSH_REQUEST);
+	WRITE_REG(huart->Instance->ICR, (USART_ICR_IDLECF | USART_ICR_CMCF |
+			USART_ICR_ORECF | USART_ICR_NCF | USART_ICR_FECF | USART_ICR_PECF) );
+
+	if (HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&(huart->Instance->RDR), (uint32_t)pBuf, u16Size) != HAL_OK)
+	{
+		pRing->pBuf = NULL;
+		huart->RxState = HAL_UART_STATE_READY;
+		huart->RxISR = _bsp_com_RxISR_8BIT;
+		__HAL_UNLOCK(huart);
+		return DEV_FAILURE;
+	}
+
+	if(aDevUart[u8DevId].u8Mode == UART_MODE_EOB)
+	{
+		/* Enable Character Match interrupt*/
+		itflags |= USART_CR1_CMIE;
+	}
+	SET_BIT(huart->Instance->CR1, itflags);
+	/* Enable the DMA transfer for the receiver request */
+	SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+	__HAL_UNLOCK(huart);
+
+	HAL_NVIC_EnableIRQ(aDevUart[u8DevId].i8ItLine);
+	return DEV_SUCCESS;
+}
+
+/*!
+  * @brief Stop to receive in the circular ring (DMA mode)
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given parameter is invalid (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  *
+  */
+uint8_t BSP_Uart_RxRing_Stop(uint8_t u8DevId)
+{
+	if (u8DevId >= UART_ID_MAX)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	UART_HandleTypeDef *huart = aDevUart[u8DevId].hHandle;
+
+	if (_aRxRing_[u8DevId].pBuf)
+	{
+		CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE | USART_CR1_CMIE));
+		CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+		HAL_DMA_Abort(huart->hdmarx);
+
+		_aRxRing_[u8DevId].bArmed = 0;
+		_aRxRing_[u8DevId].pBuf = NULL;
+		huart->RxISR = _bsp_com_RxISR_8BIT;
+		huart->RxState = HAL_UART_STATE_READY;
+	}
+	_uart_irq_disable_(u8DevId);
+	return DEV_SUCCESS;
+}
+
+/*!
+  * @brief Get a view on the received bytes, in place in the circular ring
+  *
+  * @details The bytes are contiguous up to the end of the ring : the ones after
+  * the wrap are given with u16Offset equal to the previous length. They remain
+  * valid until released, as long as the ring doesn't overflow.
+  *
+  * @param [in]  u8DevId   Uart device id (see @link uart_id_e @endlink)
+  * @param [in]  u16Offset Offset from the oldest unreleased byte
+  * @param [out] ppData    Pointer on the first byte (NULL if none)
+  * @param [out] pu16Len   Number of contiguous bytes (0 if none)
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given parameter is invalid (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  * @retval DEV_FAILURE if the ring overflowed, the unreleased bytes are dropped (see @link dev_res_e::DEV_FAILURE @endlink)
+  *
+  */
+uint8_t BSP_Uart_RxRing_Peek(uint8_t u8DevId, uint16_t u16Offset, uint8_t **ppData, uint16_t *pu16Len)
+{
+	if ( (u8DevId >= UART_ID_MAX) || (ppData == NULL) || (pu16Len == NULL) )
+	{
+		return DEV_INVALID_PARAM;
+	}
+	uart_rx_ring_t *pRing = &(_aRxRing_[u8DevId]);
+	uint8_t eRet = DEV_SUCCESS;
+	uint32_t u32Primask;
+	uint32_t u32Avail;
+	uint16_t u16Idx;
+
+	*ppData = NULL;
+	*pu16Len = 0;
+	if (pRing->pBuf == NULL)
+	{
+		return DEV_INVALID_PARAM;
+	}
+
+	u32Primask = __get_PRIMASK();
+	__disable_irq();
+	_rx_ring_update_(u8DevId);
+	if (pRing->bOvfl)
+	{
+		// resynchronize on the DMA position
+		pRing->bOvfl = 0;
+		pRing->u32Rd = pRing->u32Wr;
+		pRing->u16Rd = pRing->u16Pos;
+		eRet = DEV_FAILURE;
+	}
+	u32Avail = pRing->u32Wr - pRing->u32Rd;
+	__set_PRIMASK(u32Primask);
+
+	if (u16Offset < u32Avail)
+	{
+		u16Idx = (uint16_t)( ((uint32_t)pRing->u16Rd + u16Offset) % pRing->u16Size );
+		u32Avail -= u16Offset;
+		*ppData = &(pRing->pBuf[u16Idx]);
+		*pu16Len = (uint16_t)( (u32Avail < (uint32_t)(pRing->u16Size - u16Idx))?(u32Avail):(pRing->u16Size - u16Idx) );
+	}
+	return eRet;
+}
+
+/*!
+  * @brief Release the oldest received bytes of the circular ring
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  * @param [in] u16Len  Number of bytes to release
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given parameter is invalid (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  * @retval DEV_FAILURE if the ring overflowed, the released bytes were overwritten (see @link dev_res_e::DEV_FAILURE @endlink)
+  *
+  */
+uint8_t BSP_Uart_RxRing_Release(uint8_t u8DevId, uint16_t u16Len)
+{
+	if (u8DevId >= UART_ID_MAX)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	uart_rx_ring_t *pRing = &(_aRxRing_[u8DevId]);
+	uint8_t eRet = DEV_SUCCESS;
+	uint32_t u32Primask;
+
+	if (pRing->pBuf == NULL)
+	{
+		return DEV_INVALID_PARAM;
+	}
+
+	u32Primask = __get_PRIMASK();
+	__disable_irq();
+	_rx_ring_update_(u8DevId);
+	if (pRing->bOvfl)
+	{
+		// resynchronize on the DMA position
+		pRing->bOvfl = 0;
+		pRing->u32Rd = pRing->u32Wr;
+		pRing->u16Rd = pRing->u16Pos;
+		eRet = DEV_FAILURE;
+	}
+	else if (u16Len > (pRing->u32Wr - pRing->u32Rd))
+	{
+		eRet = DEV_INVALID_PARAM;
+	}
+	else
+	{
+		pRing->u32Rd += u16Len;
+		pRing->u16Rd = (uint16_t)( ((uint32_t)pRing->u16Rd + u16Len) % pRing->u16Size );
+	}
+	__set_PRIMASK(u32Primask);
+	return eRet;
+}
+
+/*!
+  * @brief Request the next event of the circular ring (one shot)
+  *
+  * @details The event (UART_EVT_RX_CPLT on character match, UART_EVT_RX_IDLE on
+  * idle line, UART_EVT_RX_ABT on overflow) is sent to the call-back. It is not
+  * requested if bytes have been received since the caller looked at the ring,
+  * so that none is missed between the view and the wait.
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  * @param [in] u16Seen Number of unreleased bytes the caller has already seen
+  *
+  * @retval DEV_SUCCESS if the event is requested (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given parameter is invalid (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  * @retval DEV_BUSY if new bytes are already available (see @link dev_res_e::DEV_BUSY @endlink)
+  *
+  */
+uint8_t BSP_Uart_RxRing_Arm(uint8_t u8DevId, uint16_t u16Seen)
+{
+	if (u8DevId >= UART_ID_MAX)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	uart_rx_ring_t *pRing = &(_aRxRing_[u8DevId]);
+	uint8_t eRet = DEV_SUCCESS;
+	uint32_t u32Primask;
+
+	if (pRing->pBuf == NULL)
+	{
+		return DEV_INVALID_PARAM;
+	}
+
+	u32Primask = __get_PRIMASK();
+	__disable_irq();
+	_rx_ring_update_(u8DevId);
+	if ( pRing->bOvfl || ( (pRing->u32Wr - pRing->u32Rd) > u16Seen) )
+	{
+		eRet = DEV_BUSY;
+	}
+	else
+	{
+		pRing->bArmed = 1;
+	}
+	__set_PRIMASK(u32Primask);
+	return eRet;
+}
+
+/*!
+  * @brief Cancel the request of the next event of the circular ring
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given parameter is invalid (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  *
+  */
+uint8_t BSP_Uart_RxRing_Disarm(uint8_t u8DevId)
+{
+	if (u8DevId >= UART_ID_MAX)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	_aRxRing_[u8DevId].bArmed = 0;
+	return DEV_SUCCESS;
+}
+#endif
+
+#ifdef USE_UART_TX_QUEUE
+/*!
+  * @brief Queue bytes to transmit on the given uart (interrupt mode)
+  *
+  * @details The bytes are copied into the TX queue of the uart and sent by the
+  * TXE interrupt, so the caller doesn't wait the wire time. When the queue is
+  * full, the device policy apply (see @link uart_txq_policy_e @endlink) :
+  * - UART_TXQ_BLOCK : wait for room (back-pressure), up to the device TX
+  * timeout, yielding the CPU meanwhile (see BSP_Uart_TxQueue_Yield). These
+  * bytes can't be dropped by the other policy.
+  * - UART_TXQ_DROP_OLDEST : the oldest lines are discarded to make room, or all
+  * the new bytes if the oldest ones can't be dropped.
+  *
+  * Called from an interrupt or with the interrupts masked (PRIMASK or BASEPRI,
+  * e.g. fault handler or RTOS critical section), the queue and the bytes are
+  * sent by polling instead.
+  *
+  * @param [in] u8DevId   Uart device id (see @link uart_id_e @endlink)
+  * @param [in] pData     Pointer on the buffer to send
+  * @param [in] u16Length Size of the message
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given parameter is invalid (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  * @retval DEV_BUSY if some of the bytes have been dropped (see @link dev_res_e::DEV_BUSY @endlink)
+  * @retval DEV_TIMEOUT if the bytes can't be all queued in time (see @link dev_res_e::DEV_TIMEOUT @endlink)
+  *
+  */
+uint8_t BSP_Uart_TxQueue_Send(uint8_t u8DevId, const uint8_t *pData, uint16_t u16Length)
+{
+	if ( (u8DevId >= UART_ID_MAX) || (pData == NULL) || (aDevUart[u8DevId].pTxQueue == NULL) )
+	{
+		return DEV_INVALID_PARAM;
+	}
+	uart_tx_queue_t *pQueue = aDevUart[u8DevId].pTxQueue;
+	uint8_t bBlock = (aDevUart[u8DevId].u8TxPolicy == UART_TXQ_BLOCK);
+	uint8_t eRet = DEV_SUCCESS;
+	uint32_t u32TickStart = HAL_GetTick();
+	uint32_t u32Primask;
+	uint16_t u16Lost = 0;
+	uint16_t u16Nb;
+
+	if ( __get_PRIMASK() || __get_BASEPRI() || __get_IPSR() )
+	{
+		// Nothing would drain the queue
+		_tx_queue_poll_(u8DevId);
+		HAL_UART_Transmit(aDevUart[u8DevId].hHandle, (uint8_t *)pData, u16Length, aDevUart[u8DevId].u32TxTmo);
+		return DEV_SUCCESS;
+	}
+
+	if ( !bBlock && (u16Length > pQueue->u16Size) )
+	{
+		// Only the end could remain
+		u16Lost = u16Length - pQueue->u16Size;
+		pData += u16Lost;
+		u16Length = pQueue->u16Size;
+	}
+
+	while (u16Length)
+	{
+		u32Primask = __get_PRIMASK();
+		__disable_irq();
+		if (bBlock)
+		{
+			u16Nb = _tx_queue_put_(pQueue, pData, u16Length);
+			pQueue->u16Keep = pQueue->u16Count;
+		}
+		else
+		{
+			if ( (pQueue->u16Size - pQueue->u16Count) < u16Length )
+			{
+				_tx_queue_drop_(pQueue, u16Length);
+			}
+			if ( (pQueue->u16Size - pQueue->u16Count) < u16Length )
+			{
+				// Still no room : drop the new bytes, not a part of them
+				u16Lost += u16Length;
+			}
+			else
+			{
+				_tx_queue_put_(pQueue, pData, u16Length);
+			}
+			u16Nb = u16Length;
+			pQueue->u32Drop += u16Lost;
+		}
+		if (pQueue->u16Count)
+		{
+			_tx_queue_kick_(u8DevId);
+		}
+		__set_PRIMASK(u32Primask);
+
+		pData += u16Nb;
+		u16Length -= u16Nb;
+		if (u16Length)
+		{
+			if ( (HAL_GetTick() - u32TickStart) > aDevUart[u8DevId].u32TxTmo )
+			{
+				return DEV_TIMEOUT;
+			}
+			// The queue is full : let the other tasks run while it drains
+			BSP_Uart_TxQueue_Yield();
+		}
+	}
+	if (u16Lost)
+	{
+		eRet = DEV_BUSY;
+	}
+	return eRet;
+}
+
+/*!
+  * @brief Give the CPU while waiting for room in a TX queue
+  *
+  * @details Default one, does nothing (busy wait). Overridden by the RTOS
+  * (app/sys/rtos.c) to delay the calling task by one tick.
+  *
+  * @return None
+  */
+__attribute__((weak)) void BSP_Uart_TxQueue_Yield(void)
+{
+	return;
+}
+
+/*!
+  * @brief Wait until the TX queue of the given uart is empty and the last byte sent
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  * @param [in] u32Tmo  Timeout (ms)
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given parameter is invalid (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  * @retval DEV_TIMEOUT if the queue is not empty in time (see @link dev_res_e::DEV_TIMEOUT @endlink)
+  *
+  */
+uint8_t BSP_Uart_TxQueue_Flush(uint8_t u8DevId, uint32_t u32Tmo)
+{
+	if ( (u8DevId >= UART_ID_MAX) || (aDevUart[u8DevId].pTxQueue == NULL) )
+	{
+		return DEV_INVALID_PARAM;
+	}
+	UART_HandleTypeDef *huart = aDevUart[u8DevId].hHandle;
+	uart_tx_queue_t *pQueue = aDevUart[u8DevId].pTxQueue;
+	uint32_t u32TickStart = HAL_GetTick();
+
+	while ( pQueue->u16Count || !(READ_REG(huart->Instance->ISR) & USART_ISR_TC) )
+	{
+		if ( (HAL_GetTick() - u32TickStart) > u32Tmo )
+		{
+			return DEV_TIMEOUT;
+		}
+	}
+	return DEV_SUCCESS;
+}
+
+/*!
+  * @brief Set the TX queue policy of the given uart device
+  *
+  * @param [in] u8DevId  Uart device id (see @link uart_id_e @endlink)
+  * @param [in] u8Policy The policy (see @link uart_txq_policy_e @endlink)
+  *
+  * @retval DEV_SUCCESS if everything is fine (see @link dev_res_e::DEV_SUCCESS @endlink)
+  * @retval DEV_INVALID_PARAM if the given parameter is invalid (see @link dev_res_e::DEV_INVALID_PARAM @endlink)
+  *
+  */
+uint8_t BSP_Uart_TxQueue_SetPolicy(uint8_t u8DevId, uint8_t u8Policy)
+{
+	if ( (u8DevId >= UART_ID_MAX) || (u8Policy > UART_TXQ_DROP_OLDEST) )
+	{
+		return DEV_INVALID_PARAM;
+	}
+	aDevUart[u8DevId].u8TxPolicy = u8Policy;
+	return DEV_SUCCESS;
+}
+
+/*!
+  * @brief Get the number of bytes dropped by the TX queue of the given uart
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  *
+  * @retval the number of dropped bytes
+  * @retval 0 if the given u8DevId is invalid
+  *
+  */
+uint32_t BSP_Uart_TxQueue_GetDropped(uint8_t u8DevId)
+{
+	if ( (u8DevId >= UART_ID_MAX) || (aDevUart[u8DevId].pTxQueue == NULL) )
+	{
+		return 0;
+	}
+	return aDevUart[u8DevId].pTxQueue->u32Drop;
+}
+#endif
+
+/*******************************************************************************/
+/*!
+  * @static
+  * @brief Disable the interrupt line of the given uart, unless it is transmitting
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  *
+  */
+static void _uart_irq_disable_(uint8_t u8DevId)
+{
+	UART_HandleTypeDef *huart = aDevUart[u8DevId].hHandle;
+	uint32_t u32Primask = __get_PRIMASK();
+
+	__disable_irq();
+	if ( !(READ_REG(huart->Instance->CR1) & (USART_CR1_TXEIE | USART_CR1_TCIE)) )
+	{
+		HAL_NVIC_DisableIRQ(aDevUart[u8DevId].i8ItLine);
+	}
+	__set_PRIMASK(u32Primask);
+}
+
 /*******************************************************************************/
 /*!
   * @static
@@ -602,6 +1159,330 @@ static void _bsp_com_RxISR_8BIT(UART_HandleTypeDef *huart)
 	}
 }
 
+#ifdef USE_UART_RX_DMA
+/*!
+  * @static
+  * @brief RX ring uart interrupt handler (idle line, character match)
+  *
+  * @param [in] huart Pointer on the uart handle
+  *
+  */
+static void _bsp_com_RxRingISR(UART_HandleTypeDef *huart)
+{
+	uint32_t isrflags = READ_REG(huart->Instance->ISR);
+	uint32_t cr1its   = READ_REG(huart->Instance->CR1);
+	uint32_t evt = UART_EVT_NONE;
+	uint8_t u8DevId;
+
+	if ( (isrflags & USART_ISR_IDLE) && (cr1its & USART_CR1_IDLEIE) )
+	{
+		evt = UART_EVT_RX_IDLE;
+	}
+	if ( (isrflags & USART_ISR_CMF) && (cr1its & USART_CR1_CMIE) )
+	{
+		// EOB
+		evt = UART_EVT_RX_CPLT;
+	}
+	/* Clear the idle, character match and error flags (the data are moved by the DMA) */
+	WRITE_REG(huart->Instance->ICR, (USART_ICR_IDLECF | USART_ICR_CMCF |
+			USART_ICR_ORECF | USART_ICR_NCF | USART_ICR_FECF | USART_ICR_PECF) );
+
+	u8DevId = _rx_ring_dev_id_(huart);
+	if (u8DevId < UART_ID_MAX)
+	{
+		_rx_ring_update_(u8DevId);
+		if (_aRxRing_[u8DevId].bOvfl)
+		{
+			evt = UART_EVT_RX_ABT;
+		}
+		if (evt != UART_EVT_NONE)
+		{
+			_rx_ring_event_(u8DevId, evt);
+		}
+	}
+}
+
+/*!
+  * @static
+  * @brief RX ring DMA half and full transfer handler
+  *
+  * @details Called at least twice per ring turn, so the DMA position is never
+  * more than a turn ahead of the last one seen.
+  *
+  * @param [in] hdma Pointer on the DMA handle
+  *
+  */
+static void _bsp_com_RxRingDmaISR(DMA_HandleTypeDef *hdma)
+{
+	uint8_t u8DevId = _rx_ring_dev_id_((UART_HandleTypeDef *)hdma->Parent);
+	if (u8DevId < UART_ID_MAX)
+	{
+		_rx_ring_update_(u8DevId);
+		if (_aRxRing_[u8DevId].bOvfl)
+		{
+			_rx_ring_event_(u8DevId, UART_EVT_RX_ABT);
+		}
+	}
+}
+
+/*!
+  * @static
+  * @brief Get the device id owning the started RX ring of a uart handle
+  *
+  * @param [in] huart Pointer on the uart handle
+  *
+  * @return The device id (UART_ID_MAX if none)
+  */
+static uint8_t _rx_ring_dev_id_(UART_HandleTypeDef *huart)
+{
+	register uint8_t id;
+	for (id = 0; id < UART_ID_MAX; id++)
+	{
+		if ( (aDevUart[id].hHandle == huart) && (_aRxRing_[id].pBuf != NULL) )
+		{
+			break;
+		}
+	}
+	return id;
+}
+
+/*!
+  * @static
+  * @brief Account the bytes written by the DMA since the last call
+  *
+  * @details Called from the uart and DMA interrupts, or with them masked.
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  *
+  */
+static void _rx_ring_update_(uint8_t u8DevId)
+{
+	UART_HandleTypeDef *huart = aDevUart[u8DevId].hHandle;
+	uart_rx_ring_t *pRing = &(_aRxRing_[u8DevId]);
+	uint16_t u16Pos = pRing->u16Size - (uint16_t)__HAL_DMA_GET_COUNTER(huart->hdmarx);
+
+	if (u16Pos >= pRing->u16Size)
+	{
+		u16Pos = 0;
+	}
+	pRing->u32Wr += (u16Pos >= pRing->u16Pos)?(u16Pos - pRing->u16Pos):(pRing->u16Size - pRing->u16Pos + u16Pos);
+	pRing->u16Pos = u16Pos;
+	if ( (pRing->u32Wr - pRing->u32Rd) > pRing->u16Size )
+	{
+		pRing->bOvfl = 1;
+	}
+}
+
+/*!
+  * @static
+  * @brief Send an RX ring event to the call-back, if requested
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  * @param [in] evt     The event (see @link uart_evt_e @endlink)
+  *
+  */
+static void _rx_ring_event_(uint8_t u8DevId, uint32_t evt)
+{
+	if (_aRxRing_[u8DevId].bArmed)
+	{
+		_aRxRing_[u8DevId].bArmed = 0;
+		if (aDevUart[u8DevId].pfEvent != NULL)
+		{
+			aDevUart[u8DevId].pfEvent(aDevUart[u8DevId].pCbParam, evt);
+		}
+	}
+}
+#endif
+
+#ifdef USE_UART_TX_QUEUE
+/*!
+  * @static
+  * @brief TX queue interrupt handler (TXE)
+  *
+  * @param [in] huart Pointer on the uart handle
+  *
+  */
+static void _bsp_com_TxQueueISR(UART_HandleTypeDef *huart)
+{
+	uart_tx_queue_t *pQueue = NULL;
+	register uint8_t id;
+
+	for (id = 0; id < UART_ID_MAX; id++)
+	{
+		if (aDevUart[id].hHandle == huart)
+		{
+			pQueue = aDevUart[id].pTxQueue;
+			break;
+		}
+	}
+
+	if ( pQueue && pQueue->u16Count )
+	{
+		huart->Instance->TDR = pQueue->pBuf[pQueue->u16Rd];
+		if (++(pQueue->u16Rd) >= pQueue->u16Size)
+		{
+			pQueue->u16Rd = 0;
+		}
+		pQueue->u16Count--;
+		if (pQueue->u16Keep)
+		{
+			pQueue->u16Keep--;
+		}
+	}
+	else
+	{
+		// Queue is empty, wait for the last byte to be out (see HAL_UART_TxCpltCallback)
+		CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE);
+		SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+	}
+}
+
+/*!
+  * @static
+  * @brief Copy the bytes that fit into the TX queue
+  *
+  * @details Called with the interrupts masked.
+  *
+  * @param [in] pQueue    Pointer on the TX queue
+  * @param [in] pData     Pointer on the bytes
+  * @param [in] u16Length Number of bytes
+  *
+  * @return The number of copied bytes
+  */
+static uint16_t _tx_queue_put_(uart_tx_queue_t *pQueue, const uint8_t *pData, uint16_t u16Length)
+{
+	uint16_t u16Free = pQueue->u16Size - pQueue->u16Count;
+	uint16_t u16Nb;
+
+	if (u16Length > u16Free)
+	{
+		u16Length = u16Free;
+	}
+	// Up to the end of the buffer, then from its beginning
+	u16Nb = pQueue->u16Size - pQueue->u16Wr;
+	if (u16Nb > u16Length)
+	{
+		u16Nb = u16Length;
+	}
+	memcpy(&(pQueue->pBuf[pQueue->u16Wr]), pData, u16Nb);
+	memcpy(pQueue->pBuf, &(pData[u16Nb]), u16Length - u16Nb);
+	pQueue->u16Wr += u16Length;
+	if (pQueue->u16Wr >= pQueue->u16Size)
+	{
+		pQueue->u16Wr -= pQueue->u16Size;
+	}
+	pQueue->u16Count += u16Length;
+	return u16Length;
+}
+
+/*!
+  * @static
+  * @brief Drop the oldest lines of the TX queue to make room
+  *
+  * @details Called with the interrupts masked. Nothing is dropped if the oldest
+  * bytes can't be (queued with UART_TXQ_BLOCK). Otherwise, the drop goes on to
+  * the end of the line, if any, so that the next sent line is complete.
+  *
+  * @param [in] pQueue  Pointer on the TX queue
+  * @param [in] u16Need Number of free bytes required
+  *
+  */
+static void _tx_queue_drop_(uart_tx_queue_t *pQueue, uint16_t u16Need)
+{
+	uint16_t u16Nb = u16Need - (pQueue->u16Size - pQueue->u16Count);
+	uint16_t u16Idx;
+	uint16_t i;
+
+	if ( pQueue->u16Keep || (u16Nb > pQueue->u16Count) )
+	{
+		return;
+	}
+	for (i = u16Nb; i <= pQueue->u16Count; i++)
+	{
+		u16Idx = pQueue->u16Rd + i - 1;
+		if (u16Idx >= pQueue->u16Size)
+		{
+			u16Idx -= pQueue->u16Size;
+		}
+		if (pQueue->pBuf[u16Idx] == '\n')
+		{
+			u16Nb = i;
+			break;
+		}
+	}
+	pQueue->u16Rd += u16Nb;
+	if (pQueue->u16Rd >= pQueue->u16Size)
+	{
+		pQueue->u16Rd -= pQueue->u16Size;
+	}
+	pQueue->u16Count -= u16Nb;
+	pQueue->u32Drop += u16Nb;
+}
+
+/*!
+  * @static
+  * @brief Start the TX queue drain, if not already on-going
+  *
+  * @details Called with the interrupts masked.
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  *
+  */
+static void _tx_queue_kick_(uint8_t u8DevId)
+{
+	UART_HandleTypeDef *huart = aDevUart[u8DevId].hHandle;
+
+	if ( !(READ_REG(huart->Instance->CR1) & USART_CR1_TXEIE) )
+	{
+		// The UART doesn't run in STOP mode
+		BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_UART, 1);
+		huart->gState = HAL_UART_STATE_BUSY_TX;
+		huart->TxISR = _bsp_com_TxQueueISR;
+		CLEAR_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+		/* Enable the Transmit Data Register Empty interrupt */
+		SET_BIT(huart->Instance->CR1, USART_CR1_TXEIE);
+	}
+	HAL_NVIC_EnableIRQ(aDevUart[u8DevId].i8ItLine);
+}
+
+/*!
+  * @static
+  * @brief Send the TX queue content by polling
+  *
+  * @details Called from an interrupt or with the interrupts masked.
+  *
+  * @param [in] u8DevId Uart device id (see @link uart_id_e @endlink)
+  *
+  */
+static void _tx_queue_poll_(uint8_t u8DevId)
+{
+	UART_HandleTypeDef *huart = aDevUart[u8DevId].hHandle;
+	uart_tx_queue_t *pQueue = aDevUart[u8DevId].pTxQueue;
+	uint16_t u16Nb;
+
+	CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE | USART_CR1_TCIE);
+	huart->gState = HAL_UART_STATE_READY;
+	while (pQueue->u16Count)
+	{
+		u16Nb = pQueue->u16Size - pQueue->u16Rd;
+		if (u16Nb > pQueue->u16Count)
+		{
+			u16Nb = pQueue->u16Count;
+		}
+		HAL_UART_Transmit(huart, &(pQueue->pBuf[pQueue->u16Rd]), u16Nb, aDevUart[u8DevId].u32TxTmo);
+		pQueue->u16Rd += u16Nb;
+		if (pQueue->u16Rd >= pQueue->u16Size)
+		{
+			pQueue->u16Rd = 0;
+		}
+		pQueue->u16Count -= u16Nb;
+	}
+	pQueue->u16Keep = 0;
+	// HAL_UART_Transmit wait for the last byte to be out
+	BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_UART, 0);
+}
+#endif
+
 /*******************************************************************************/
 
 #ifdef __cplusplus
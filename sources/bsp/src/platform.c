@@ -78,6 +78,31 @@ extern "C" {
 	UART_HandleTypeDef huart4 = { .Instance = UART4};
 #endif
 
+#ifdef USE_UART_RX_DMA
+#if USE_UART_COM_ID == 0
+	DMA_HandleTypeDef hdma_com_rx = {.Instance = DMA2_Channel5};
+#else
+	DMA_HandleTypeDef hdma_com_rx = {.Instance = DMA2_Channel7};
+#endif
+#endif
+
+#ifdef USE_UART_TX_QUEUE
+	static uint8_t _au8ComTxBuf_[UART_TX_QUEUE_LEN];
+	static uart_tx_queue_t _sComTxQueue_ = { .pBuf = _au8ComTxBuf_, .u16Size = UART_TX_QUEUE_LEN };
+	#define UART_COM_TX_QUEUE &_sComTxQueue_
+#if USE_UART_LOG_ID == USE_UART_COM_ID
+	// Same uart : the logger and the console share the queue
+	#define UART_LOG_TX_QUEUE &_sComTxQueue_
+#else
+	static uint8_t _au8LogTxBuf_[UART_TX_QUEUE_LEN];
+	static uart_tx_queue_t _sLogTxQueue_ = { .pBuf = _au8LogTxBuf_, .u16Size = UART_TX_QUEUE_LEN };
+	#define UART_LOG_TX_QUEUE &_sLogTxQueue_
+#endif
+#else
+	#define UART_COM_TX_QUEUE NULL
+	#define UART_LOG_TX_QUEUE NULL
+#endif
+
 uart_dev_t aDevUart[UART_ID_MAX] =
 {
 	[UART_ID_LOG] = {
@@ -87,6 +112,8 @@ uart_dev_t aDevUart[UART_ID_MAX] =
 			.u32RxTmo = LOGGER_RX_TIMEOUT,
 			.u32TxTmo = LOGGER_TX_TIMEOUT,
 			.i8ItLine = UART_LOG_IT_LINE,
+			.pTxQueue = UART_LOG_TX_QUEUE,
+			.u8TxPolicy = UART_TXQ_DROP_OLDEST,
 	},
 	[UART_ID_COM]     = {
 			.hHandle = &UART_COM_ID,
@@ -94,6 +121,8 @@ uart_dev_t aDevUart[UART_ID_MAX] =
 			.u32RxTmo = CONSOLE_RX_TIMEOUT,
 			.u32TxTmo = CONSOLE_TX_TIMEOUT,
 			.i8ItLine = UART_COM_IT_LINE,
+			.pTxQueue = UART_COM_TX_QUEUE,
+			.u8TxPolicy = UART_TXQ_BLOCK,
 	},
 };
 
@@ -101,6 +130,21 @@ static void _send_event_to_cb_(UART_HandleTypeDef *huart, uint32_t evt);
 
 __weak void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
 {
+#ifdef USE_UART_TX_QUEUE
+	register uint8_t id;
+	for (id = 0; id < UART_ID_MAX; id++)
+	{
+		if ( aDevUart[id].pTxQueue && (aDevUart[id].hHandle->gState == HAL_UART_STATE_BUSY_TX) )
+		{
+			break;
+		}
+	}
+	if (id == UART_ID_MAX)
+	{
+		// All TX queues are drained, the last byte is out
+		BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_UART, 0);
+	}
+#endif
 	_send_event_to_cb_(huart, UART_EVT_TX_CPLT);
 }
 
@@ -238,7 +282,12 @@ void BSP_LowPower_OnStopEnter(lp_mode_e eLpMode)
 
     // Disable all clock
 	RCC->APB1ENR1 = 0;
+#if defined(USE_LPUART1) && defined(USE_TICKLESS_IDLE)
+	// but the LPUART1 (receiving in STOP2, if enabled)
+	RCC->APB1ENR2 = _rcc_clk_state_.apb1r2_clk & RCC_APB1ENR2_LPUART1EN;
+#else
 	RCC->APB1ENR2 = 0;
+#endif
 	RCC->APB2ENR = 0;
 	RCC->AHB2ENR = 0;
 	// Disable the FLASH => require run code and remap vector in SRAM
@@ -253,6 +302,10 @@ void BSP_LowPower_OnStopExit(lp_mode_e eLpMode)
 	RCC->APB1ENR1 = _rcc_clk_state_.apb1r1_clk;
 	RCC->APB1ENR2 = _rcc_clk_state_.apb1r2_clk;
 	RCC->APB2ENR = _rcc_clk_state_.apb2_clk;
+#if defined(USE_LPUART1) && defined(USE_TICKLESS_IDLE)
+	// The HSI16 is switched off on STOP entry, restore the LPUART1 kernel clock
+	__HAL_RCC_HSI_ENABLE();
+#endif
 
 	BSP_GpioIt_SetLine( LINE_INIT(WKUP_PIN_NAME), 0);
 }
@@ -274,6 +327,10 @@ void BSP_LowPower_OnStopExit(lp_mode_e eLpMode)
 #if defined(HAL_SPI_MODULE_ENABLED)
 
 SPI_HandleTypeDef hspi1 = {.Instance = SPI1};
+#ifdef USE_SPI_DMA
+DMA_HandleTypeDef hdma_spi1_rx = {.Instance = DMA1_Channel2};
+DMA_HandleTypeDef hdma_spi1_tx = {.Instance = DMA1_Channel3};
+#endif
 
 SPI_HandleTypeDef *paSPI_BusHandle[SPI_ID_MAX] =
 {
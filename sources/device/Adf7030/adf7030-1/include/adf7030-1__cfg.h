@@ -56,6 +56,13 @@ uint8_t adf7030_1__SendConfiguration(
     uint32_t              Size
 );
 
+/* ADI Radio Configuration image (pre-formatted SPI frames) streaming function */
+uint8_t adf7030_1__SendConfigImage(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    const uint8_t*        pIMAGE,
+    uint32_t              Size
+);
+
 
 /** @} */ /* End of group adf7030-1__cfg Configuration */
 /** @} */ /* End of group adf7030-1 adf7030-1 Driver */
@@ -109,12 +109,33 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #define ADF7030_1_SPI_MAX_TRX_SIZE (ADF7030_1_SPI_BUFFER_SIZE - 8u)
 
+/*!
+ *  Defines the worst case transaction list buffer usage of one queued 32bits
+ *  write (3 bytes length, 1 byte command, 4 bytes address and 4 bytes data).
+ */
+#define ADF7030_1_TRX_LIST_WORD_SIZE 12u
+
 /*!
  *  Defines the maximum numbers of byte transfert for which "Fast SPI mode" will
  *  be used. Above this number, standart SPI API is used.
  */
 #define ADF7030_1_SPI_FAST_SIZE_THRESHOLD 20
 
+/*!
+ *  Defines the minimum numbers of byte transfert for which the DMA will be
+ *  used (when available, see pfXferWaitCb). Below, the SPI is polled.
+ */
+#ifndef ADF7030_1_SPI_DMA_SIZE_THRESHOLD
+#define ADF7030_1_SPI_DMA_SIZE_THRESHOLD 64
+#endif
+
+/*!
+ *  Defines the maximum time (in ms) to wait for the end of a DMA SPI transfer.
+ */
+#ifndef ADF7030_1_SPI_DMA_TMO
+#define ADF7030_1_SPI_DMA_TMO 10
+#endif
+
 /*!
  *  Defines the numbers of SPI pointers address the driver will keep to schedule
  *  SPI transactions.
@@ -402,6 +423,31 @@ typedef struct mem_desc_s       mem_desc_t;
 typedef struct mem_cfg_desc_s   mem_cfg_desc_t;
 typedef struct patch_desc_s     patch_desc_t;
 
+/*! Function pointer to block until the PHY signals a state machine event.
+ *  A zero timeout only (re)arms the event source and discards pending events.
+ *  Return 0 if the event occurred, 1 on timeout.
+ */
+typedef uint8_t (*pf_wait_cb_t)(void *p_WaitParam, uint32_t u32Timeout);
+
+/*! Enumeration of the driver events given to the trace function */
+typedef enum
+{
+    /*! A radio command has been sent (argument : the command byte) */
+    ADF7030_1_TRACE_CMD = 0,
+    /*! The radio command wait is over (argument : the expected state, 0 if
+     *  only the status is polled) */
+    ADF7030_1_TRACE_CMD_DONE,
+    /*! A SPI frame has been transferred (argument : its size in bytes) */
+    ADF7030_1_TRACE_XFER,
+
+    ADF7030_1_NUM_TRACE_EVT
+} adf7030_1_trace_evt_e;
+
+/*! Function pointer to trace a driver event (see adf7030_1_trace_evt_e).
+ *  Called from the caller context, it must be short.
+ */
+typedef void (*pf_trace_cb_t)(void *p_TraceParam, uint8_t u8Evt, uint32_t u32Arg);
+
 /*! Structure to hold the information regarding the SPI PHY Status */
 typedef struct adf7030_1_spi_status_s
 {
@@ -470,6 +516,10 @@ typedef struct adf7030_1_spi_info_s
     uint32_t                nClkFreq_Fast;
     /*! Currently used SPI clock frequency */
     uint32_t                nClkFreq_Current;
+    /*! SPI clock frequency for the wake-up and reset handshake */
+    uint32_t                nClkFreq_Slow;
+    /*! Wake-up or reset handshake on-going (the slow SPI clock is forced) */
+    uint8_t                 bHandshake;
     /*! SPI PHY pointer */
     adf7030_1_spi_pntr      PHY_PNTR;
     /*! SPI Driver communication result */
@@ -488,6 +538,21 @@ typedef struct adf7030_1_spi_info_s
     uint8_t                 bPhyErrorCheck;
     /*! PHY radio error code */
     adf7030_1_radio_error_e ePhyError;
+
+    /*! PHY state change wait function pointer (NULL : SPI polling only) */
+    pf_wait_cb_t            pfPhyWaitCb;
+    /*! PHY state change wait function parameter pointer */
+    void*                   pPhyWaitParam;
+
+    /*! DMA SPI transfer end wait function pointer (NULL : no DMA transfer) */
+    pf_wait_cb_t            pfXferWaitCb;
+    /*! DMA SPI transfer end wait function parameter pointer */
+    void*                   pXferWaitParam;
+
+    /*! Driver event trace function pointer (NULL : no trace) */
+    pf_trace_cb_t           pfTraceCb;
+    /*! Driver event trace function parameter pointer */
+    void*                   pTraceParam;
 }adf7030_1_spi_info_t;
 
 /*! Structure to hold mapping between ADF7030_1 interrupt pin and host processor
@@ -569,6 +634,53 @@ typedef enum
 
 } adf7030_1_state_e;
 
+/*! Enumeration of the PHY registers kept in the host shadow cache
+ */
+typedef enum
+{
+    /*! GENERIC_PKT_FRAME_CFG0 */
+    ADF7030_1_SHADOW_FRAME_CFG0 = 0,
+    /*! GENERIC_PKT_FRAME_CFG1 */
+    ADF7030_1_SHADOW_FRAME_CFG1,
+    /*! PROFILE_RADIO_DIG_TX_CFG0 */
+    ADF7030_1_SHADOW_TX_CFG0,
+    /*! PROFILE_RADIO_DIG_TX_CFG1 */
+    ADF7030_1_SHADOW_TX_CFG1,
+    /*! PROFILE_CH_FREQ */
+    ADF7030_1_SHADOW_CH_FREQ,
+    /*! PROFILE_CCA_CFG */
+    ADF7030_1_SHADOW_CCA_CFG,
+
+    ADF7030_1_NUM_SHADOW_REG
+} adf7030_1_shadow_reg_e;
+
+/*! Write-through host shadow of PHY registers */
+typedef struct adf7030_1_shadow_s
+{
+    /*! Bit mask of the valid entries (bit n for adf7030_1_shadow_reg_e n) */
+    uint32_t nValid;
+    /*! Last value read from or written to the PHY */
+    uint32_t nValue[ADF7030_1_NUM_SHADOW_REG];
+} adf7030_1_shadow_t;
+
+/*! SPI transaction list : queued 32bits writes, merged in as few SPI frames as
+ *  possible and kept as a configuration image (see adf7030_1__SendConfigImage) */
+typedef struct adf7030_1_trx_list_s
+{
+    /*! Image buffer */
+    uint8_t *pBuff;
+    /*! Image buffer size */
+    uint16_t nSize;
+    /*! Current image length */
+    uint16_t nLen;
+    /*! Offset of the last SPI frame in the image */
+    uint16_t nLast;
+    /*! Number of queued SPI frames */
+    uint16_t nFrames;
+    /*! PHY address following the last queued word */
+    uint32_t nNextAddr;
+} adf7030_1_trx_list_t;
+
 /*! ADF7030_1 device instance data */
 typedef struct adf7030_1_device_s
 {
@@ -593,12 +705,26 @@ typedef struct adf7030_1_device_s
 	uint8_t                     bCrcOn;
     /*! Internal : Configuration is completed */
 	uint8_t                     bCfgDone;
-	/*! Internal : TX power is configured */
-	uint8_t                     bTxPwrDone;
+	/*! Internal : Modulation configuration currently loaded in the PHY (0xFF : none or altered) */
+	uint8_t                     u8CfgMod;
+	/*! Internal : PHY_SLEEP without SRAM retention (lowest current, full configuration on wake-up) */
+	uint8_t                     bColdSleep;
+	/*! Internal : Continuous RX, the PHY is set back to RX on each received frame */
+	uint8_t                     bRxCont;
+	/*! Internal : Pre-staged RX (0 : none, 1 : requested, 2 : written in the PHY) */
+	uint8_t                     u8RxStage;
+	/*! Internal : Pre-staged RX channel */
+	uint8_t                     u8RxStageCh;
+	/*! Internal : Pre-staged RX modulation */
+	uint8_t                     u8RxStageMod;
+	/*! Internal : Left in CCA after a free LBT, the next TX starts from there */
+	uint8_t                     bLbtTx;
 	/*! Internal : Pending TX size */
 	uint8_t                     u8PendTXBuffSize;
     /*! Internal : Set calibration parts */
 	radio_cal_cfg0_t            CalCfg;
+    /*! Internal : Shadow of the frequently accessed PHY registers */
+	adf7030_1_shadow_t          Shadow;
 
 } adf7030_1_device_t ;
 
@@ -158,6 +158,13 @@ uint8_t adf7030_1__IRQ_SetMap(
     uint32_t           nIntMap
 );
 
+uint8_t adf7030_1__IRQ_QueueMap(
+	adf7030_1_device_t* const pDevice,
+    adf7030_1_trx_list_t* pList,
+    adf7030_1_intpin_e eIntPin,
+    uint32_t           nIntMap
+);
+
 uint8_t adf7030_1__IRQ_GetMap(
 	adf7030_1_device_t* const pDevice,
     adf7030_1_intpin_e eIntPin
@@ -174,6 +181,13 @@ uint8_t adf7030_1__IRQ_ClrStatus(
     uint32_t           nIntSource
 );
 
+uint8_t adf7030_1__IRQ_QueueClrStatus(
+	adf7030_1_device_t* const pDevice,
+    adf7030_1_trx_list_t* pList,
+    adf7030_1_intpin_e eIntPin,
+    uint32_t           nIntClear
+);
+
 #define adf7030_1__IRQ_ClrAllStatus(pDevice, eIntPin) adf7030_1__IRQ_ClrStatus( pDevice, eIntPin, 0xFFFFFFFF )
 
 uint8_t adf7030_1__IRQ_GetClrStatus(
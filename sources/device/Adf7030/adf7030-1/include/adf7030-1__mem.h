@@ -119,6 +119,14 @@ struct mem_cfg_desc_s {
 #define PHY_MEM_READ 1
 #define PHY_MEM_WRITE 0
 
+/** Verification mode of a memory transfer (0 and 1 are the former bCHECK values).
+*/
+typedef enum {
+    ADF7030_1_VERIFY_NONE     = 0, //!< No verification
+    ADF7030_1_VERIFY_READBACK = 1, //!< Full read-back and compare (diagnostic, doubles the SPI traffic)
+    ADF7030_1_VERIFY_CRC      = 2, //!< On-chip CRC compared with the reference one (only the result is read back)
+} adf7030_1_verify_e;
+
 uint8_t adf7030_1__ConvConfig(
     const uint8_t*    pCONFIG,
     uint32_t          Size,
@@ -298,6 +306,52 @@ uint32_t adf7030_1__SPI_GetField(
     uint32_t              Size
 );
 
+/* Read a shadowed 32bits register, from the host cache if valid */
+uint32_t adf7030_1__SHADOW_Get(
+    adf7030_1_device_t*    pDevice,
+    adf7030_1_shadow_reg_e eReg
+);
+
+/* Write a shadowed 32bits register, skip the SPI if unchanged */
+void adf7030_1__SHADOW_Set(
+    adf7030_1_device_t*    pDevice,
+    adf7030_1_shadow_reg_e eReg,
+    uint32_t               Value
+);
+
+/* Invalidate the whole shadow cache */
+void adf7030_1__SHADOW_Invalidate(
+    adf7030_1_device_t*    pDevice
+);
+
+/* Queue a shadowed 32bits register write, skip it if unchanged */
+uint8_t adf7030_1__SHADOW_Queue(
+    adf7030_1_device_t*    pDevice,
+    adf7030_1_trx_list_t*  pList,
+    adf7030_1_shadow_reg_e eReg,
+    uint32_t               Value
+);
+
+/* Initialize (or reset) a transaction list */
+void adf7030_1__TRX_Init(
+    adf7030_1_trx_list_t* pList,
+    uint8_t*              pBuff,
+    uint16_t              nSize
+);
+
+/* Queue a 32bits write into a transaction list */
+uint8_t adf7030_1__TRX_AddWord(
+    adf7030_1_trx_list_t* pList,
+    uint32_t              Addr,
+    uint32_t              Value
+);
+
+/* Execute then reset a transaction list */
+uint8_t adf7030_1__TRX_Exec(
+    adf7030_1_device_t*   pDevice,
+    adf7030_1_trx_list_t* pList
+);
+
 /* Generic Function to check if byte rw operation is permitted */
 uint8_t adf7030_1__MEM_CheckByteAccess(
     uint32_t nAddr
@@ -139,6 +139,23 @@ uint8_t adf7030_1__SelfCheckPatch(
     patch_checksum_desc_t*  pCHECKSUM_CFG
 );
 
+/* Write patch data to Radio PHY, then verify it */
+uint8_t adf7030_1__LoadPatch(
+    adf7030_1_spi_info_t*   pSPIDevInfo,
+    patch_desc_t*           pPATCH,
+    adf7030_1_verify_e      eVerify,
+    adf7030_1_radio_state_e eCmd,
+    adf7030_1_radio_state_e retState
+);
+
+/* Verify patch integrity with the PHY Radio CRC */
+uint8_t adf7030_1__VerifyPatchCrc(
+    adf7030_1_spi_info_t*   pSPIDevInfo,
+    patch_desc_t*           pPATCH,
+    adf7030_1_radio_state_e eCmd,
+    adf7030_1_radio_state_e retState
+);
+
 /* Setup Patch sequence */
 uint8_t adf7030_1__SetupPatch(
     adf7030_1_spi_info_t* pSPIDevInfo,
@@ -203,7 +220,7 @@ uint8_t adf7030_1__XferChecksum(
                                                                                                          (patch_desc_t*)pPATCH, \
                                                                                                          (patch_checksum_desc_t*)pPATCH_CHECKSUM, \
                                                                                                          (uint8_t)PHY_MEM_READ, \
-                                                                                                         0 )
+                                                                                                         1 )
 /** @} */ /* End of group adf7030-1__patch Patch Interface */
 /** @} */ /* End of group adf7030-1 adf7030-1 Driver */
 
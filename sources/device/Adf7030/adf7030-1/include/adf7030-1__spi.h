@@ -66,10 +66,11 @@ typedef enum {
     SPI_READ  = 1
 } adf7030_1_spi_trx_t;
 
-/*! Enumeration of Host SPI Rate*/
+/*! Enumeration of Host SPI Rate (per operation speed profile)*/
 typedef enum {
-    DEFAULT_SPI_RATE = 0,
-    FAST_SPI_RATE    = 1
+    DEFAULT_SPI_RATE = 0, /*!< Default (at SPI initialization) and bulk memory transfers */
+    FAST_SPI_RATE    = 1, /*!< Register accesses (and bulk memory transfers if USE_SPI_FAST_BULK) */
+    SLOW_SPI_RATE    = 2  /*!< Wake-up and reset handshake */
 } adf7030_1_spi_rate_t;
 
 typedef adf7030_1_res_e (* ADF7030_1_SPI_Xfer)(
@@ -237,6 +238,26 @@ void adf7030_1__SPI_ReadWrite_Fast(
     uint32_t              nSize
 );
 
+uint8_t adf7030_1__SPI_Xfer_Frame(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    uint8_t*              pTX_DATA,
+    uint32_t              nSize
+);
+
+uint8_t adf7030_1__SPI_ReadWrite_Async(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    uint8_t*              pTX_DATA,
+    uint8_t*              pRX_DATA,
+    uint32_t              nSize
+);
+
+uint8_t adf7030_1__SPI_ReadWrite_Dma(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    uint8_t*              pTX_DATA,
+    uint8_t*              pRX_DATA,
+    uint32_t              nSize
+);
+
 void adf7030_1__SPI_Xfer_WriteBuff(
     void*    pDest,
     void*    pSrc,
@@ -140,6 +140,13 @@ uint8_t adf7030_1__STATE_PhyCMD_WaitReady(
     adf7030_1_radio_state_e retState
 );
 
+uint8_t adf7030_1__STATE_PhyCMD_WaitIrq(
+    adf7030_1_spi_info_t*   pSPIDevInfo, 
+    adf7030_1_radio_state_e goState,
+    adf7030_1_radio_state_e retState,
+    uint32_t                u32Timeout
+);
+
 uint8_t adf7030_1__STATE_WaitIdle(
     adf7030_1_spi_info_t* pSPIDevInfo,
     uint8_t               nRetry
@@ -166,6 +173,13 @@ uint8_t adf7030_1__STATE_WaitStateReady(
     uint8_t                 nRetry
 );
 
+uint8_t adf7030_1__STATE_WaitStateIrq(
+    adf7030_1_spi_info_t*   pSPIDevInfo,
+    adf7030_1_radio_state_e nState,
+    uint8_t                 nRetry,
+    uint32_t                u32Timeout
+);
+
 uint8_t adf7030_1__STATE_Poll_SpiStatus(
     adf7030_1_spi_info_t*  pSPIDevInfo, 
     adf7030_1_spi_status_t nSPIStatus,
@@ -187,6 +201,15 @@ uint8_t adf7030_1__XferCmdPoll(
     uint8_t                 nRetry
 );
 
+uint8_t adf7030_1__XferCmdWait(
+    adf7030_1_spi_info_t*   pSPIDevInfo,
+    uint8_t                 nPhyCmd,
+    uint32_t                nStatusPoll,
+    adf7030_1_radio_state_e nStatePoll,
+    uint8_t                 nRetry,
+    uint32_t                u32Timeout
+);
+
 #if (ADF7030_1_PHY_ERROR_REPORT_ENABLE == 1)
 
 uint8_t adf7030_1__STATE_ClearPhyError(
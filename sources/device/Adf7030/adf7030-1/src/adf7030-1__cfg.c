@@ -158,6 +158,75 @@ uint8_t adf7030_1__SendConfiguration(
 }
 
 
+/**
+ * @brief       ADI Radio Configuration image streaming function
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ * @param [in]  pIMAGE          Pointer to the image (see tools/scripts/cfg_img.py)
+ * @param [in]  Size            Size of the image
+ *
+ * @note                        The image keeps the "Cfg" framing, but each 32bits
+ *                              address block write sequence is already a SPI frame
+ *                              (wire order) that fits in the SPI buffer. It is sent
+ *                              as is, straight from flash, without copy nor
+ *                              word reversing. Any other sequence falls back to
+ *                              the adf7030_1__SendConfiguration transfer.
+ *
+ * @return      Status
+ *  - #0    If the configuration was written transfered to the Host.
+ *  - #1    [D] If the configuration transfert failed.
+ */
+
+uint8_t adf7030_1__SendConfigImage(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    const uint8_t*        pIMAGE,
+    uint32_t              Size
+)
+{
+    uint32_t array_position = 0;
+    if ( (pSPIDevInfo == NULL) || (pIMAGE ==NULL) ) {
+    	return 1;
+    }
+    do
+    {
+      // Calculate the number of bytes of this sequence
+      uint32_t length =  (*(pIMAGE + array_position ) << 16) |
+                         (*(pIMAGE + array_position + 1) << 8) |
+                         (*(pIMAGE + array_position + 2));
+
+      if( (length < 4) || (length > 0xFFFF) )
+      {
+         return 1;
+      }
+
+      // The SPI frame starts just after the length
+      uint8_t * pFrame = (uint8_t *)(pIMAGE + array_position + 3);
+
+      if( ( (*pFrame & 0xF8) == ( ADF703x_SPI_MEM_WRITE | ADF703x_SPI_MEM_BLOCK | ADF703x_SPI_MEM_ADDRESS | ADF703x_SPI_MEM_LONG ) ) &&
+          ( (length - 3) <= ADF7030_1_SPI_BUFFER_SIZE ) )
+      {
+          // Stream the frame as is
+          if(adf7030_1__SPI_Xfer_Frame( pSPIDevInfo, pFrame, length - 3) )
+          {
+              return 1;
+          }
+      }
+      else if(adf7030_1__XferCfgSeq( pSPIDevInfo, pFrame, length - 4) )
+      {
+          return 1;
+      }
+
+      // Update the array position to point to the next block
+      array_position += length;
+
+    }while(array_position < Size); // Continue operation until full image has been written
+
+    return 0;
+}
+
+
 /**
  * @brief       ADI Radio SPI sequence configuration transfer
  *
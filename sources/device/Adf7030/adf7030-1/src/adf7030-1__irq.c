@@ -78,38 +78,84 @@ uint8_t adf7030_1__IRQ_SetMap(
     adf7030_1_intpin_e eIntPin,
     uint32_t           nIntMap
 )
+{
+    adf7030_1_trx_list_t sList;
+    uint8_t aBuff[2 * ADF7030_1_TRX_LIST_WORD_SIZE];
+
+    adf7030_1__TRX_Init(&sList, aBuff, sizeof(aBuff));
+    if(adf7030_1__IRQ_QueueMap( pDevice, &sList, eIntPin, nIntMap))
+    {
+        return 1;
+    }
+    return(adf7030_1__TRX_Exec( pDevice, &sList));
+}
+
+
+/**
+ * @brief       Queue the PHY interrupt source mask setup into a transaction list
+ *
+ * @note        Same as adf7030_1__IRQ_SetMap, but the SPI writes are only queued
+ *              (see adf7030_1__TRX_Exec). The packet interrupt location [7:0] is
+ *              part of the shadowed GENERIC_PKT_FRAME_CFG1, so it is only queued
+ *              when changed.
+ *              
+ * @param [in]  pDevice         Pointer to the ADF7030-1 instance information structure.
+ *   
+ * @param [in]  pList           Pointer to the transaction list.
+ *   
+ * @param [in]  eIntPin         Interrupt id (adf7030_1_intpin_e) to configure.
+ *             
+ * @param [in]  nIntMap         Interrupt events which will be triggering PHY irq line.         
+ *             
+ * @return      Status
+ *  - #0    If PHY intance irq mask setup was succesfully queued
+ *  - #1    [D] If the transaction list is full or the SPI read failed
+ */
+
+uint8_t adf7030_1__IRQ_QueueMap(
+    adf7030_1_device_t* const pDevice,
+    adf7030_1_trx_list_t* pList,
+    adf7030_1_intpin_e eIntPin,
+    uint32_t           nIntMap
+)
 {
     /* Pointer to IRQ GPIO Pin info */
     adf7030_1_gpio_int_info_t * pIntGPIOInfo = &pDevice->IntGPIOInfo[eIntPin];
 
     uint32_t irq_msk;
+    // frame_irq
+    irq_msk = nIntMap & 0xFF;
+    if(irq_msk || !(nIntMap)) {
+        /* Setup bit [7:0] of nIntMap into GENERIC_PKT_FRAME_CFG1_TRX_IRQ0_TYPE or GENERIC_PKT_FRAME_CFG1_TRX_IRQ1_TYPE */
+        uint32_t nShift = (GENERIC_PKT_FRAME_CFG1_TRX_IRQ0_TYPE_Pos + ((uint32_t)eIntPin << 3));
+        uint32_t frame_cfg1 = adf7030_1__SHADOW_Get( pDevice, ADF7030_1_SHADOW_FRAME_CFG1);
+        if( !(pDevice->Shadow.nValid & (1UL << ADF7030_1_SHADOW_FRAME_CFG1)) )
+        {
+            /* SPI read failed */
+            return 1;
+        }
+        frame_cfg1 &= ~(0xFFUL << nShift);
+        frame_cfg1 |= (irq_msk << nShift);
+        if(adf7030_1__SHADOW_Queue( pDevice, pList, ADF7030_1_SHADOW_FRAME_CFG1, frame_cfg1))
+        {
+            return 1;
+        }
+    }
     // non_frame_irq
     irq_msk = nIntMap & 0xFFFFFF00;
-
     if(irq_msk || !(nIntMap)) {
         /* Setup bit [31:8] of nIntMap into IRQ_CTRL_MASK0_Addr or IRQ_CTRL_MASK1_Addr */
-        if(adf7030_1__SPI_wr_word_b_a( &pDevice->SPIInfo,
-                                       IRQ_CTRL_MASK0_Addr + (eIntPin << 2),
-                                       1,
-                                       &irq_msk) )
+        if(adf7030_1__TRX_AddWord( pList,
+                                   IRQ_CTRL_MASK0_Addr + (eIntPin << 2),
+                                   irq_msk) )
         {
             return 1;
         }
     }
-    // frame_irq
-    irq_msk = nIntMap & 0xFF;
-    if(irq_msk || !(nIntMap)) {
-        /* Setup bit [7:0] of nIntMap into GENERIC_PKT_FRAME_CFG1_TRX_IRQ0_TYPE or GENERIC_PKT_FRAME_CFG1_TRX_IRQ1_TYPE */
-        adf7030_1__SPI_SetBytes( &pDevice->SPIInfo,
-                                GENERIC_PKT_FRAME_CFG1_Addr + 2 + (uint32_t)eIntPin,
-                                irq_msk,
-                                1,
-                                NULL);
-    }
     /* Save the current Radio PHY interrupt mask into the current instance GPIO Pin info structure */
     pIntGPIOInfo->nIntMap = nIntMap;
 
-    return ( (pDevice->SPIInfo.eXferResult)?(1):(0) );
+    return 0;
 }
 
 
@@ -229,6 +275,48 @@ uint8_t adf7030_1__IRQ_ClrStatus(
     return 0;
 }
 
+
+/**
+ * @brief       Queue the PHY eIntPin interrupt clear into a transaction list
+ *
+ * @note        Same as adf7030_1__IRQ_ClrStatus, but the SPI write is only
+ *              queued (see adf7030_1__TRX_Exec).
+ *              
+ * @param [in]  pDevice         Pointer to the ADF7030-1 instance information structure.
+ *   
+ * @param [in]  pList           Pointer to the transaction list.
+ *   
+ * @param [in]  eIntPin         Interrupt id (adf7030_1_intpin_e) to configure.
+ *             
+ * @param [in]  nIntClear       Interrupt events to clear.         
+ *             
+ * @return      Status
+ *  - #0    If PHY intance irq status clear was succesfully queued
+ *  - #1    [D] If the transaction list is full
+ */
+
+uint8_t adf7030_1__IRQ_QueueClrStatus(
+    adf7030_1_device_t* const pDevice,
+    adf7030_1_trx_list_t* pList,
+    adf7030_1_intpin_e eIntPin,
+    uint32_t           nIntClear
+)
+{
+    /* Pointer to IRQ GPIO Pin info */
+    adf7030_1_gpio_int_info_t * pIntGPIOInfo = &pDevice->IntGPIOInfo[eIntPin];
+
+    /* Clear Radio PHY interrupt status */
+    if( adf7030_1__TRX_AddWord( pList,
+                                IRQ_CTRL_STATUS0_Addr + (eIntPin << 2),
+                                nIntClear) )
+    {
+        return 1;
+    }
+
+    pIntGPIOInfo->nIntStatus &= ~nIntClear;
+    return 0;
+}
+
 /**
  * @brief       Readback and Clear the PHY eIntPin interrupt pin
  *
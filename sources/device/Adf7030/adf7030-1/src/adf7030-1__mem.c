@@ -63,6 +63,7 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "adf7030-1__common.h"
 #include "adf7030-1__spi.h"
+#include "adf7030-1__cfg.h"
 
 #ifdef __ICCARM__
 /*
@@ -78,6 +79,16 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma diag_suppress=Pm073,Pm143
 #endif /* __ICCARM__ */
 
+/* PHY address of the shadowed registers (see adf7030_1_shadow_reg_e) */
+static const uint32_t aShadowAddr[ADF7030_1_NUM_SHADOW_REG] = {
+    [ADF7030_1_SHADOW_FRAME_CFG0] = GENERIC_PKT_FRAME_CFG0_Addr,
+    [ADF7030_1_SHADOW_FRAME_CFG1] = GENERIC_PKT_FRAME_CFG1_Addr,
+    [ADF7030_1_SHADOW_TX_CFG0]    = PROFILE_RADIO_DIG_TX_CFG0_Addr,
+    [ADF7030_1_SHADOW_TX_CFG1]    = PROFILE_RADIO_DIG_TX_CFG1_Addr,
+    [ADF7030_1_SHADOW_CH_FREQ]    = PROFILE_CH_FREQ_Addr,
+    [ADF7030_1_SHADOW_CCA_CFG]    = PROFILE_CCA_CFG_Addr,
+};
+
 /*! \endcond */
 
 /**
@@ -1448,6 +1459,286 @@ inline uint8_t adf7030_1__MEM_CheckByteAccess(
 }
 
 
+/**
+ * @brief       Read a shadowed 32bits register
+ *
+ * @param [in]  pDevice         Pointer to the ADF7030-1 instance information.
+ *
+ * @param [in]  eReg            Shadowed register to read.
+ *
+ * @note                        The value is served from the host cache when it
+ *                              is valid, otherwise it is read via the SPI and
+ *                              cached (if the SPI transfer succeeds).
+ *
+ * @return      Value           32bits register value.
+ */
+uint32_t adf7030_1__SHADOW_Get(
+    adf7030_1_device_t*    pDevice,
+    adf7030_1_shadow_reg_e eReg
+)
+{
+    adf7030_1_shadow_t *pShadow = &pDevice->Shadow;
+    adf7030_1_spi_info_t *pSPIDevInfo = &pDevice->SPIInfo;
+
+    if( !(pShadow->nValid & (1UL << eReg)) )
+    {
+        pShadow->nValue[eReg] = adf7030_1__SPI_GetMem32( pSPIDevInfo, aShadowAddr[eReg]);
+        if(pSPIDevInfo->eXferResult == ADF7030_1_SUCCESS)
+        {
+            pShadow->nValid |= (1UL << eReg);
+        }
+    }
+    return(pShadow->nValue[eReg]);
+}
+
+/**
+ * @brief       Write a shadowed 32bits register
+ *
+ * @param [in]  pDevice         Pointer to the ADF7030-1 instance information.
+ *
+ * @param [in]  eReg            Shadowed register to write.
+ *
+ * @param [in]  Value           32bits Value to write.
+ *
+ * @note                        Write-through : the SPI write is skipped when the
+ *                              cached value is valid and equal to Value. If the
+ *                              SPI transfer failed, the entry is invalidated.
+ *
+ * @return      None
+ */
+void adf7030_1__SHADOW_Set(
+    adf7030_1_device_t*    pDevice,
+    adf7030_1_shadow_reg_e eReg,
+    uint32_t               Value
+)
+{
+    adf7030_1_shadow_t *pShadow = &pDevice->Shadow;
+    adf7030_1_spi_info_t *pSPIDevInfo = &pDevice->SPIInfo;
+
+    if( (pShadow->nValid & (1UL << eReg)) && (pShadow->nValue[eReg] == Value) )
+    {
+        return;
+    }
+    adf7030_1__SPI_SetMem32( pSPIDevInfo, aShadowAddr[eReg], Value);
+    pShadow->nValue[eReg] = Value;
+    if(pSPIDevInfo->eXferResult == ADF7030_1_SUCCESS)
+    {
+        pShadow->nValid |= (1UL << eReg);
+    }
+    else
+    {
+        pShadow->nValid &= ~(1UL << eReg);
+    }
+}
+
+/**
+ * @brief       Invalidate the whole shadow cache
+ *
+ * @param [in]  pDevice         Pointer to the ADF7030-1 instance information.
+ *
+ * @note                        Must be called each time the PHY memory could have
+ *                              been changed behind the cache (reset, sleep,
+ *                              configuration). Next accesses go to the SPI.
+ *
+ * @return      None
+ */
+void adf7030_1__SHADOW_Invalidate(
+    adf7030_1_device_t*    pDevice
+)
+{
+    if(pDevice)
+    {
+        pDevice->Shadow.nValid = 0;
+    }
+}
+
+
+/**
+ * @brief       Queue a shadowed 32bits register write into a transaction list
+ *
+ * @param [in]  pDevice         Pointer to the ADF7030-1 instance information.
+ *
+ * @param [in]  pList           Pointer to the transaction list.
+ *
+ * @param [in]  eReg            Shadowed register to write.
+ *
+ * @param [in]  Value           32bits Value to write.
+ *
+ * @note                        Nothing is queued when the cached value is valid
+ *                              and equal to Value. The shadow is updated right
+ *                              now, adf7030_1__TRX_Exec invalidates it on failure.
+ *
+ * @return      Status
+ *  - #0    If the write is queued (or not required).
+ *  - #1    [D] If the transaction list is full.
+ */
+uint8_t adf7030_1__SHADOW_Queue(
+    adf7030_1_device_t*    pDevice,
+    adf7030_1_trx_list_t*  pList,
+    adf7030_1_shadow_reg_e eReg,
+    uint32_t               Value
+)
+{
+    adf7030_1_shadow_t *pShadow = &pDevice->Shadow;
+
+    if( (pShadow->nValid & (1UL << eReg)) && (pShadow->nValue[eReg] == Value) )
+    {
+        return 0;
+    }
+    if(adf7030_1__TRX_AddWord(pList, aShadowAddr[eReg], Value))
+    {
+        pShadow->nValid &= ~(1UL << eReg);
+        return 1;
+    }
+    pShadow->nValue[eReg] = Value;
+    pShadow->nValid |= (1UL << eReg);
+    return 0;
+}
+
+/**
+ * @brief       Initialize (or reset) a transaction list
+ *
+ * @param [in]  pList           Pointer to the transaction list.
+ *
+ * @param [in]  pBuff           Pointer to the image buffer. Its size should be
+ *                              at least ADF7030_1_TRX_LIST_WORD_SIZE times the
+ *                              number of words to queue.
+ *
+ * @param [in]  nSize           Image buffer size.
+ *
+ * @return      None
+ */
+void adf7030_1__TRX_Init(
+    adf7030_1_trx_list_t* pList,
+    uint8_t*              pBuff,
+    uint16_t              nSize
+)
+{
+    pList->pBuff = pBuff;
+    pList->nSize = nSize;
+    pList->nLen = 0;
+    pList->nLast = 0;
+    pList->nFrames = 0;
+    pList->nNextAddr = 0;
+}
+
+/**
+ * @brief       Queue a 32bits write into a transaction list
+ *
+ * @param [in]  pList           Pointer to the transaction list.
+ *
+ * @param [in]  Addr            PHY Address location (32bits aligned).
+ *
+ * @param [in]  Value           32bits Value to write.
+ *
+ * @note                        A write to the address following the last queued
+ *                              one is appended to the same SPI frame (32bits
+ *                              address block write), otherwise a new frame is
+ *                              started. A new write to the last queued address
+ *                              replaces it. Data are stored in wire order.
+ *
+ * @return      Status
+ *  - #0    If the write is queued.
+ *  - #1    [D] If the transaction list is full.
+ */
+uint8_t adf7030_1__TRX_AddWord(
+    adf7030_1_trx_list_t* pList,
+    uint32_t              Addr,
+    uint32_t              Value
+)
+{
+    uint8_t *pFrame = pList->pBuff + pList->nLast;
+    uint32_t nFrameLen = 0;
+
+    if(pList->nLen)
+    {
+        nFrameLen = (*(pFrame + 1) << 8) | *(pFrame + 2);
+        if(Addr == (pList->nNextAddr - 4))
+        {
+            /* Same word as the last queued one : just replace its value */
+            pList->nLen -= 4;
+            pList->nNextAddr -= 4;
+            nFrameLen -= 4;
+        }
+    }
+    if( pList->nLen && (Addr == pList->nNextAddr) &&
+        ( (nFrameLen - 3 + 4) <= ADF7030_1_SPI_MAX_TRX_SIZE ) &&
+        ( (pList->nLen + 4) <= pList->nSize ) )
+    {
+        /* Append to the last frame */
+        nFrameLen += 4;
+        *(pFrame + 1) = (uint8_t)(nFrameLen >> 8);
+        *(pFrame + 2) = (uint8_t)(nFrameLen);
+    }
+    else
+    {
+        if( (pList->nLen + ADF7030_1_TRX_LIST_WORD_SIZE) > pList->nSize )
+        {
+            return 1;
+        }
+        /* Start a new frame : 3 bytes length, command and address */
+        pList->nLast = pList->nLen;
+        pFrame = pList->pBuff + pList->nLast;
+        *(pFrame + 0) = 0;
+        *(pFrame + 1) = 0;
+        *(pFrame + 2) = ADF7030_1_TRX_LIST_WORD_SIZE;
+        *(pFrame + 3) = ADF703x_SPI_MEM_WRITE |
+                        ADF703x_SPI_MEM_BLOCK |
+                        ADF703x_SPI_MEM_ADDRESS |
+                        ADF703x_SPI_MEM_LONG;
+        *(pFrame + 4) = (uint8_t)(Addr >> 24);
+        *(pFrame + 5) = (uint8_t)(Addr >> 16);
+        *(pFrame + 6) = (uint8_t)(Addr >> 8);
+        *(pFrame + 7) = (uint8_t)(Addr);
+        pList->nLen += 8;
+        pList->nFrames++;
+    }
+    /* Data word */
+    pFrame = pList->pBuff + pList->nLen;
+    *(pFrame + 0) = (uint8_t)(Value >> 24);
+    *(pFrame + 1) = (uint8_t)(Value >> 16);
+    *(pFrame + 2) = (uint8_t)(Value >> 8);
+    *(pFrame + 3) = (uint8_t)(Value);
+    pList->nLen += 4;
+    pList->nNextAddr = Addr + 4;
+    return 0;
+}
+
+/**
+ * @brief       Execute then reset a transaction list
+ *
+ * @param [in]  pDevice         Pointer to the ADF7030-1 instance information.
+ *
+ * @param [in]  pList           Pointer to the transaction list.
+ *
+ * @note                        Frames are streamed back to back, straight from
+ *                              the list buffer (see adf7030_1__SendConfigImage).
+ *                              On failure, the shadow cache is invalidated as
+ *                              the queued writes may be partially done.
+ *
+ * @return      Status
+ *  - #0    If the transaction list was transfered to the PHY (or empty).
+ *  - #1    [D] If the transfer failed.
+ */
+uint8_t adf7030_1__TRX_Exec(
+    adf7030_1_device_t*   pDevice,
+    adf7030_1_trx_list_t* pList
+)
+{
+    uint8_t eRet = 0;
+    if(pList->nLen)
+    {
+        eRet = adf7030_1__SendConfigImage( &pDevice->SPIInfo, pList->pBuff, pList->nLen);
+        if(eRet)
+        {
+            adf7030_1__SHADOW_Invalidate(pDevice);
+        }
+    }
+    adf7030_1__TRX_Init(pList, pList->pBuff, pList->nSize);
+    return eRet;
+}
+
+
 #endif /* _ADF7030_1__MEM_C_ */
 
 /** @} */ /* End of group adf7030-1__mem Memory Interface */
@@ -236,6 +236,116 @@ uint8_t adf7030_1__SelfCheckPatch(
     return adf7030_1__STATE_PhyCMD( pSPIDevInfo, eCmd );
 }
 
+/**
+ * @brief       Function call to write the patch, then verify it
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the 
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ *
+ * @param [in]  pPATCH          Pointer to Host "patch" descriptor.
+ *
+ * @param [in]  eVerify         Verification mode :
+ *                               - ADF7030_1_VERIFY_NONE
+ *                               - ADF7030_1_VERIFY_READBACK (diagnostic)
+ *                               - ADF7030_1_VERIFY_CRC, see adf7030_1__VerifyPatchCrc()
+ *
+ * @param [in]  eCmd            PHY Radio Command to trigger the selfcheck (CRC mode only).
+ *
+ * @param [in]  retState        PHY Radio state once the selfcheck is done (CRC mode only).
+ *
+ * @return      Status
+ *  - #0    If the patch was written and verified successfully.
+ *  - #1    [D] If the patch transfert or the verification failed.
+ */
+uint8_t adf7030_1__LoadPatch(
+    adf7030_1_spi_info_t*   pSPIDevInfo,
+    patch_desc_t*           pPATCH,
+    adf7030_1_verify_e      eVerify,
+    adf7030_1_radio_state_e eCmd,
+    adf7030_1_radio_state_e retState
+)
+{
+    if( adf7030_1__WritePatch( pSPIDevInfo, pPATCH ) )
+    {
+        return 1;
+    }
+
+    switch(eVerify)
+    {
+        case ADF7030_1_VERIFY_NONE:
+            return 0;
+        case ADF7030_1_VERIFY_READBACK:
+            return adf7030_1__VerifyPatch( pSPIDevInfo, pPATCH );
+        case ADF7030_1_VERIFY_CRC:
+            return adf7030_1__VerifyPatchCrc( pSPIDevInfo, pPATCH, eCmd, retState );
+        default:
+            return 1;
+    }
+}
+
+/**
+ * @brief       Function call to verify the patch with the PHY Radio CRC
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the 
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ *
+ * @param [in]  pPATCH          Pointer to Host "patch" descriptor.
+ *
+ * @param [in]  eCmd            PHY Radio Command to trigger the selfcheck.
+ *
+ * @param [in]  retState        PHY Radio state once the selfcheck is done.
+ *
+ * @note                        The PHY compares the CRC of the patch sections
+ *                              with the GoldenCRC of the default checksum
+ *                              descriptor, which must have inject_ok set : the
+ *                              patch is injected only on valid CRC. So, only the
+ *                              Setup patch sequence word is read back, instead
+ *                              of the whole patch.
+ *                              This function modifies pSPIDevInfo->PHY_PNTR[PNTR_CUSTOM0_ADDR].
+ *
+ * @return      Status
+ *  - #0    If the patch CRC is valid (the patch is injected).
+ *  - #1    [D] If the CRC is invalid or if the selfcheck failed.
+ */
+uint8_t adf7030_1__VerifyPatchCrc(
+    adf7030_1_spi_info_t*   pSPIDevInfo,
+    patch_desc_t*           pPATCH,
+    adf7030_1_radio_state_e eCmd,
+    adf7030_1_radio_state_e retState
+)
+{
+    patch_checksum_desc_t* pCHECKSUM_CFG = pPATCH->pChecksum;
+    uint32_t Seq_rb;
+
+    /* Without automatic Inject, the CRC result is not observable */
+    if( (pCHECKSUM_CFG == NULL) || (pCHECKSUM_CFG->crc_config.inject_ok == 0) )
+    {
+        return 1;
+    }
+
+    /* Run the selfcheck */
+    if( adf7030_1__SelfCheckPatch( pSPIDevInfo, pPATCH, ADF7030_1_VERIFY_NONE, eCmd, NULL ) )
+    {
+        return 1;
+    }
+    if( adf7030_1__STATE_WaitStateReady( pSPIDevInfo, retState, 255 ) )
+    {
+        return 1;
+    }
+
+    /* Injected ? */
+    if(( adf7030_1__SPI_rd_word_b_a( pSPIDevInfo,
+                                     SM_DATA_CALIBRATION_Addr,
+                                     1,
+                                     &Seq_rb )) )
+    {
+        return 1;
+    }
+    return (Seq_rb == (uint32_t)(BRAM_BASE + pPATCH->InjectSeq))?(0):(1);
+}
+
 /**
  * @brief       Function call to setup the patch
  *
@@ -248,8 +358,9 @@ uint8_t adf7030_1__SelfCheckPatch(
  *                               - EjectSeq to disable the patch
  *                               - CheckSeq to enable patch selfcheck and auto inject
  *
- * @param [in]  bCHECK          Boolean  -TRUE to verify the Inject sequence in the PHY
- *                                       -FALSE to discard any verifications
+ * @param [in]  bCHECK          Verification mode (see adf7030_1_verify_e), the
+ *                              Inject sequence is read back in any mode but
+ *                              ADF7030_1_VERIFY_NONE
  *
  * @note                        This function assume the following the patch has
  *                              already been transfered and that its integrity is
@@ -283,7 +394,7 @@ uint8_t adf7030_1__SetupPatch(
     }
     
     /* Readback Inject Sequence number if requested */
-    if(bCHECK == 1)
+    if(bCHECK != ADF7030_1_VERIFY_NONE)
     {
         uint32_t Seq_rb;
         
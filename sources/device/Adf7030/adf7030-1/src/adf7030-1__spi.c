@@ -63,6 +63,13 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "adf7030-1_reg.h"
 #include "adf7030-1__common.h"
 #include "adf7030-1__state.h"
+
+/*! SPI clock rate of the bulk memory transfers (block, frame, configuration) */
+#ifdef USE_SPI_FAST_BULK
+#define ADF7030_1_SPI_BULK_RATE FAST_SPI_RATE
+#else
+#define ADF7030_1_SPI_BULK_RATE DEFAULT_SPI_RATE
+#endif
    
 
 #ifdef __ICCARM__
@@ -87,6 +94,10 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
  * @note        Default speed is set to 3.5MBps, anything faster should really
  *              used DMA operation mode which is corrently not supported
  *
+ * @note        While pSPIDevInfo->bHandshake is set (from the wake-up or reset
+ *              pulse up to the first PHY answer), the slow rate is forced.
+ *              The SPI peripheral is only reconfigured when the rate changes.
+ *
  * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the
  *                              ADI RF Driver used to communicate with the
  *                              adf7030-1 PHY.
@@ -105,8 +116,25 @@ uint8_t adf7030_1__SPI_SetSpeed(
     adf7030_1_spi_rate_t  eSPIRate
 )
 {
+    uint32_t RateHz;
+
+    if(pSPIDevInfo->bHandshake)
+    {
+        eSPIRate = SLOW_SPI_RATE;
+    }
     /* Get the desired SPI clock frequency from pSPIDevInfo structure */
-    uint32_t RateHz = (eSPIRate == DEFAULT_SPI_RATE) ? pSPIDevInfo->nClkFreq : pSPIDevInfo->nClkFreq_Fast;
+    switch(eSPIRate)
+    {
+        case FAST_SPI_RATE:
+            RateHz = pSPIDevInfo->nClkFreq_Fast;
+            break;
+        case SLOW_SPI_RATE:
+            RateHz = pSPIDevInfo->nClkFreq_Slow;
+            break;
+        default:
+            RateHz = pSPIDevInfo->nClkFreq;
+            break;
+    }
     /* Update the SPI datarate only if different from the current datarate */
     if(pSPIDevInfo->nClkFreq_Current != RateHz)
     {
@@ -170,10 +198,16 @@ uint8_t adf7030_1__SPI_GetMMapPointers(
     /* Pointer to user defined PHY mmap SPI pointers */ 
     uint32_t * pPNTR = (uint32_t *)&pSPIDevInfo->PHY_PNTR[PNTR_CUSTOM0_ADDR];
     
-    return(adf7030_1__SPI_rd_word_b_p( pSPIDevInfo,
-                                       PNTR_SETUP_ADDR,
-                                       3,
-                                       pPNTR));
+    if(adf7030_1__SPI_rd_word_b_p( pSPIDevInfo,
+                                   PNTR_SETUP_ADDR,
+                                   3,
+                                   pPNTR))
+    {
+        return 1;
+    }
+    /* The PHY answered, so the wake-up or reset handshake is over */
+    pSPIDevInfo->bHandshake = 0;
+    return 0;
 }
 
 /**
@@ -977,7 +1011,7 @@ uint8_t adf7030_1__SPI_Block_Xfer__fast(
     void*                 pDataRef
 )
 {
-    /* FIXME : Set the default SPI clock rate */
+    /* Register access : set the fast SPI clock rate */
     if(adf7030_1__SPI_SetSpeed(pSPIDevInfo, FAST_SPI_RATE) != ADF7030_1_SUCCESS)
     {
     	pSPIDevInfo->eXferResult = ADF7030_1_SPI_DEV_FAILED;
@@ -1217,6 +1251,7 @@ uint8_t adf7030_1__SPI_Block_Xfer(
 
                     /* Recall original pSPIDevInfo->nClkFreq_Fast setting */
                     pSPIDevInfo->nClkFreq_Fast = tmp_nClkFreq_Fast;
+
                     /* Recall current SPI prolog */
                     *(uint32_t *)pSPI_TX_BUFF = tmp_SPI_Prolog;
             
@@ -1265,7 +1300,9 @@ uint8_t adf7030_1__SPI_Block_Xfer(
 /**
  * @brief       Generic SPI Block Read/Write a number of words(s) to the adf7030-1
  *                          
- * @note        Blocking SPI transfer without DMA.
+ * @note        Blocking SPI transfer. The DMA is used above
+ *              ADF7030_1_SPI_DMA_SIZE_THRESHOLD bytes when a DMA transfer wait
+ *              function is registered (see pfXferWaitCb).
  *                          
  * @param [in]  pSPIDevInfo     Handle to Glue SPI peripheral device used to
  *                              communicate with the adf7030-1.
@@ -1295,8 +1332,8 @@ uint8_t adf7030_1__SPI_block_transaction(
     void*                 pDataRef
 )
 {
-    /* FIXME : Set the default SPI clock rate */
-    if(adf7030_1__SPI_SetSpeed(pSPIDevInfo, DEFAULT_SPI_RATE) != ADF7030_1_SUCCESS)
+    /* Bulk memory transfer : set the bulk SPI clock rate */
+    if(adf7030_1__SPI_SetSpeed(pSPIDevInfo, ADF7030_1_SPI_BULK_RATE) != ADF7030_1_SUCCESS)
     {
     	pSPIDevInfo->eXferResult = ADF7030_1_SPI_DEV_FAILED;
     	return 1;
@@ -1345,11 +1382,26 @@ uint8_t adf7030_1__SPI_block_transaction(
     Transceiver.nRxIncrement     =      1u;
 
     /* Transmit the sequence */
-    if(BSP_Spi_ReadWrite(pSPIDevInfo->hSPIDevice, &Transceiver) != DEV_SUCCESS)
+    if( (pSPIDevInfo->pfXferWaitCb != NULL) && (txlen >= ADF7030_1_SPI_DMA_SIZE_THRESHOLD) )
+    {
+        /* Large transfer : let the caller task sleep until the DMA completes */
+        if(adf7030_1__SPI_ReadWrite_Dma( pSPIDevInfo,
+                                         Transceiver.pTransmitter,
+                                         Transceiver.pReceiver,
+                                         txlen))
+        {
+            return 1;
+        }
+    }
+    else if(BSP_Spi_ReadWrite(pSPIDevInfo->hSPIDevice, &Transceiver) != DEV_SUCCESS)
     {
     	pSPIDevInfo->eXferResult = ADF7030_1_SPI_COMM_FAILED;
     	return 1;
     }
+    else if(pSPIDevInfo->pfTraceCb != NULL)
+    {
+        pSPIDevInfo->pfTraceCb(pSPIDevInfo->pTraceParam, ADF7030_1_TRACE_XFER, txlen);
+    }
     /* ------------ Readback SPI RX buffer ------------- */
  
     /* Set Block address to 2nd unit32_t */   
@@ -1428,7 +1480,179 @@ void adf7030_1__SPI_ReadWrite_Fast(
   }
   else {
 	  pSPIDevInfo->eXferResult = ADF7030_1_SUCCESS;
+	  if(pSPIDevInfo->pfTraceCb != NULL)
+	  {
+		  pSPIDevInfo->pfTraceCb(pSPIDevInfo->pTraceParam, ADF7030_1_TRACE_XFER, nSize);
+	  }
+  }
+}
+
+
+/**
+ * @brief       Write a pre-formatted SPI frame (command, address and data
+ *              already in wire order) to the adf7030-1
+ *
+ * @note        Blocking SPI transfer, straight from pTX_DATA (no copy). The DMA
+ *              is used above ADF7030_1_SPI_DMA_SIZE_THRESHOLD bytes when a DMA
+ *              transfer wait function is registered (see pfXferWaitCb).
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ *
+ * @param [in]  pTX_DATA        Pointer to the SPI frame (could be in flash).
+ *
+ * @param [in]  nSize           Frame size in bytes (up to ADF7030_1_SPI_BUFFER_SIZE).
+ *
+ * @return      Status
+ *  - #0    If the transfer was successful to the adf7030-1.
+ *  - #1    [D] If the transfer failed.
+ */
+
+uint8_t adf7030_1__SPI_Xfer_Frame(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    uint8_t*              pTX_DATA,
+    uint32_t              nSize
+)
+{
+    /* Setup SPI rx buffer address */
+    uint8_t * pSPI_RX_BUFF = pSPIDevInfo->pSPI_RX_BUFF;
+
+    if( (nSize == 0) || (nSize > ADF7030_1_SPI_BUFFER_SIZE) )
+    {
+        pSPIDevInfo->eXferResult = ADF7030_1_INVALID_OPERATION;
+        return 1;
+    }
+
+    /* Bulk memory transfer : set the bulk SPI clock rate */
+    if(adf7030_1__SPI_SetSpeed(pSPIDevInfo, ADF7030_1_SPI_BULK_RATE) != ADF7030_1_SUCCESS)
+    {
+        pSPIDevInfo->eXferResult = ADF7030_1_SPI_DEV_FAILED;
+        return 1;
+    }
+
+    if( (pSPIDevInfo->pfXferWaitCb != NULL) && (nSize >= ADF7030_1_SPI_DMA_SIZE_THRESHOLD) )
+    {
+        if(adf7030_1__SPI_ReadWrite_Dma(pSPIDevInfo, pTX_DATA, pSPI_RX_BUFF, nSize))
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        adf7030_1__SPI_ReadWrite_Fast(pSPIDevInfo, pTX_DATA, pSPI_RX_BUFF, nSize);
+        if(pSPIDevInfo->eXferResult != ADF7030_1_SUCCESS)
+        {
+            return 1;
+        }
+    }
+
+    /* Return SPI status */
+    pSPIDevInfo->nStatus.VALUE = *(pSPI_RX_BUFF + nSize - 1);
+    return 0;
+}
+
+
+/**
+ * @brief       Start an asynchronous (DMA) Read/Write of a number of byte(s) to
+ *              the adf7030-1
+ *
+ * @note        Non blocking SPI transfer. The chip select is released from the
+ *              DMA completion interrupt, then the SPI device event callback is
+ *              called (see BSP_Spi_SetCallback). pTX_DATA and pRX_DATA must
+ *              remain valid until the completion event.
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ *
+ * @param [in]  pTX_DATA        Pointer to data to be transmitted.
+ *
+ * @param [out]  pRX_DATA       Pointer where readback data is to be received.
+ *
+ * @param [in]  nSize           Number of bytes to be transfered.
+ *
+ * @return      Status
+ *  - #0    If the transfer was successfully started.
+ *  - #1    [D] If the transfer failed to start.
+ */
+
+uint8_t adf7030_1__SPI_ReadWrite_Async(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    uint8_t*              pTX_DATA,
+    uint8_t*              pRX_DATA,
+    uint32_t              nSize
+)
+{
+  /* SPI transceiver instance */
+  spi_transceiver_s Transceiver;
+
+  /* Initialize the transceiver */
+  Transceiver.TransmitterBytes = nSize;
+  Transceiver.ReceiverBytes    = nSize;
+  Transceiver.pTransmitter     = pTX_DATA;
+  Transceiver.pReceiver        = pRX_DATA;
+  Transceiver.nTxIncrement     = 1u;
+  Transceiver.nRxIncrement     = 1u;
+  /* Start the sequence */
+  if(BSP_Spi_ReadWrite_DMA(pSPIDevInfo->hSPIDevice, &Transceiver) != DEV_SUCCESS)
+  {
+      pSPIDevInfo->eXferResult = ADF7030_1_DMA_NOT_SUPPORTED;
+      return 1;
+  }
+  pSPIDevInfo->eXferResult = ADF7030_1_SUCCESS;
+  if(pSPIDevInfo->pfTraceCb != NULL)
+  {
+      pSPIDevInfo->pfTraceCb(pSPIDevInfo->pTraceParam, ADF7030_1_TRACE_XFER, nSize);
+  }
+  return 0;
+}
+
+
+/**
+ * @brief       DMA Read/Write a number of byte(s) to the adf7030-1, waiting for
+ *              its completion through the pfXferWaitCb function.
+ *
+ * @note        Blocking for the caller only, the CPU is released during the
+ *              transfer. On timeout, the DMA transfer is aborted.
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ *
+ * @param [in]  pTX_DATA        Pointer to data to be transmitted.
+ *
+ * @param [out]  pRX_DATA       Pointer where readback data is to be received.
+ *
+ * @param [in]  nSize           Number of bytes to be transfered.
+ *
+ * @return      Status
+ *  - #0    If the transfer was successful to the adf7030-1.
+ *  - #1    [D] If the transfer failed.
+ */
+
+uint8_t adf7030_1__SPI_ReadWrite_Dma(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    uint8_t*              pTX_DATA,
+    uint8_t*              pRX_DATA,
+    uint32_t              nSize
+)
+{
+  /* Discard any previous completion event */
+  pSPIDevInfo->pfXferWaitCb(pSPIDevInfo->pXferWaitParam, 0);
+
+  if(adf7030_1__SPI_ReadWrite_Async(pSPIDevInfo, pTX_DATA, pRX_DATA, nSize))
+  {
+      return 1;
+  }
+  if(pSPIDevInfo->pfXferWaitCb(pSPIDevInfo->pXferWaitParam, ADF7030_1_SPI_DMA_TMO))
+  {
+      BSP_Spi_Abort(pSPIDevInfo->hSPIDevice);
+      pSPIDevInfo->eXferResult = ADF7030_1_SPI_COMM_FAILED;
+      return 1;
   }
+  pSPIDevInfo->eXferResult = ADF7030_1_SUCCESS;
+  return 0;
 }
 
 
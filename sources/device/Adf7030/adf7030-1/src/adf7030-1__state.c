@@ -85,6 +85,33 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 #define PMU_CLOCKS_Addr                                              0x40000C20UL
 #define PMU_CLOCKS_Rst                                               0x00000001UL
 
+/**
+ * @brief       Invalidate the host shadow registers on commands that could
+ *              change the PHY memory (reset, sleep without retention, CFG_DEV)
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the 
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ *
+ * @param [in]  nPhyCmd         PHY Command about to be issued.
+ *
+ * @return      None
+ */
+static void adf7030_1__STATE_ShadowDrop(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    uint8_t               nPhyCmd
+)
+{
+    adf7030_1_device_t* pDevice = (adf7030_1_device_t*)pSPIDevInfo->hDevInfo;
+
+    if( (nPhyCmd == CMD_RESET) ||
+        ((nPhyCmd == (RADIO_CMD | (uint8_t)PHY_SLEEP)) && (!pDevice || pDevice->bColdSleep)) ||
+        (nPhyCmd == (RADIO_CMD | (uint8_t)CFG_DEV)) )
+    {
+        adf7030_1__SHADOW_Invalidate(pDevice);
+    }
+}
+
 /**
  * @brief       Powering off sequence for the PHY Radio
  *
@@ -240,6 +267,53 @@ uint8_t adf7030_1__STATE_PhyCMD_WaitReady(
 }
 
 
+/**
+ * @brief       Send Radio PHY Command and sleep util PHY has transition to new state.
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the 
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ *
+ * @param [in]  goState         PHY Radio State to execute. See adf7030_1_radio_state_e
+ *                              enum for available States.
+ *
+ * @param [in]  retState        PHY Radio State expected to be in before returning.
+ *
+ * @param [in]  u32Timeout      Maximum time to wait for the state change event
+ *                              (unit is given by the pSPIDevInfo->pfPhyWaitCb).
+ *
+ * @note                        Same as adf7030_1__STATE_PhyCMD_WaitReady, except
+ *                              that the caller is blocked on the PHY state machine
+ *                              event (see pSPIDevInfo->pfPhyWaitCb) instead of
+ *                              polling the SPI status with NOPs. On timeout, or
+ *                              if no wait function is set, it falls back to the
+ *                              NOPs polling (up to 255 retries).
+ *
+ * @return      Status
+ *  - #0  If the Radio PHY transition to new state.
+ *  - #1  [D] If the Radio PHY failed to transition to new state or if the
+ *            communication with Radio PHY failed.
+ */
+uint8_t adf7030_1__STATE_PhyCMD_WaitIrq(
+    adf7030_1_spi_info_t*   pSPIDevInfo, 
+    adf7030_1_radio_state_e goState,
+    adf7030_1_radio_state_e retState,
+    uint32_t                u32Timeout
+)
+{
+    uint32_t StatusPoll = ( ((SPI_HOST_STATUS_FW_STATUS_Msk | SPI_HOST_STATUS_CMD_READY_Msk) << 16 ) |  //Mask
+                            (((STATE << 1)                  | SPI_HOST_STATUS_CMD_READY_Msk) << 8  ) |  //Status Condition 2
+                             ((IDLE  << 1)                  | SPI_HOST_STATUS_CMD_READY_Msk) );         //Status Condition 1
+
+    return(adf7030_1__XferCmdWait( pSPIDevInfo,
+                                   RADIO_CMD | (uint8_t)goState,
+                                   StatusPoll,
+                                   retState,
+                                   255,
+                                   u32Timeout));
+}
+
+
 /**
  * @brief       Polls Radio PHY SPI Status with NOPs until in Idle mode.
  *
@@ -435,6 +509,52 @@ uint8_t adf7030_1__STATE_WaitStateReady(
 }
 
 
+/**
+ * @brief       Sleep until the Radio PHY is ready in the given state.
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the 
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ *
+ * @param [in]  nState          PHY Radio State expected expected to match.
+ *
+ * @param [in]  nRetry          Number of polling retry, once the wait is over.
+ *                              Set to Zero, for continuous polling the SPI Status.
+ *
+ * @param [in]  u32Timeout      Maximum time to wait for the state change event
+ *                              (unit is given by the pSPIDevInfo->pfPhyWaitCb).
+ *
+ * @note                        Same as adf7030_1__STATE_WaitStateReady, except
+ *                              that the caller is first blocked on the PHY state
+ *                              machine event (see pSPIDevInfo->pfPhyWaitCb).
+ *                              The event source must have been armed before the
+ *                              command that trigger the transition is issued.
+ *
+ * @return      Status
+ *  - #0  If the Radio PHY transition to new state.
+ *  - #1  [D] If the Radio PHY failed to transition to new state or if the
+ *            communication with Radio PHY failed.
+ */
+uint8_t adf7030_1__STATE_WaitStateIrq(
+    adf7030_1_spi_info_t*   pSPIDevInfo,
+    adf7030_1_radio_state_e nState,
+    uint8_t                 nRetry,
+    uint32_t                u32Timeout
+)
+{
+    uint32_t StatusPoll = ( ((SPI_HOST_STATUS_FW_STATUS_Msk | SPI_HOST_STATUS_CMD_READY_Msk) << 16 ) |  //Mask
+                            (((STATE << 1)                  | SPI_HOST_STATUS_CMD_READY_Msk) << 8  ) |  //Status Condition 2
+                             ((IDLE  << 1)                  | SPI_HOST_STATUS_CMD_READY_Msk) );         //Status Condition 1
+    
+    return(adf7030_1__XferCmdWait( pSPIDevInfo,
+                                   0,
+                                   StatusPoll,
+                                   nState,
+                                   nRetry,
+                                   u32Timeout));
+}
+
+
 /**
  * @brief       Polls Radio PHY SPI Status with NOPs until match is found.
  *
@@ -554,11 +674,18 @@ uint8_t adf7030_1__XferCmdPoll(
 {
     if(nPhyCmd)
     {        
+        /* PHY memory could change behind the host shadow */
+        adf7030_1__STATE_ShadowDrop( pSPIDevInfo, nPhyCmd);
+
         /* Transmit the sequence */
         adf7030_1__SPI_ReadWrite_Fast( pSPIDevInfo,
                                        &nPhyCmd,
                                        &pSPIDevInfo->nStatus.VALUE,
                                        1 );
+        if(pSPIDevInfo->pfTraceCb != NULL)
+        {
+            pSPIDevInfo->pfTraceCb(pSPIDevInfo->pTraceParam, ADF7030_1_TRACE_CMD, nPhyCmd);
+        }
     }
     
     /* Get the SPI status polling mask, assume*/
@@ -704,6 +831,17 @@ uint8_t adf7030_1__XferCmdPoll(
         }while(EXIT == 0);
     }
 
+    if(nStatusPoll || nStatePoll)
+    {
+        /* The PHY answered, so the wake-up or reset handshake is over */
+        pSPIDevInfo->bHandshake = 0;
+    }
+
+    if(pSPIDevInfo->pfTraceCb != NULL)
+    {
+        pSPIDevInfo->pfTraceCb(pSPIDevInfo->pTraceParam, ADF7030_1_TRACE_CMD_DONE, nStatePoll);
+    }
+
 #if (ADF7030_1_PHY_ERROR_REPORT_ENABLE == 1) && ( ADF7030_1_PHY_ERROR_REPORT_SCHEME == 0)
 
     if((nPhyCmd != CMD_RESET) && (nPhyCmd != RADIO_CMD) && (pSPIDevInfo->bPhyErrorCheck == 1))
@@ -744,6 +882,74 @@ uint8_t adf7030_1__XferCmdPoll(
 }
 
 
+/**
+ * @brief       Generic Radio PHY Command Transfers, waiting on PHY event
+ *
+ * @param [in]  pSPIDevInfo     Pointer to the SPI device info structure of the 
+ *                              ADI RF Driver used to communicate with the
+ *                              adf7030-1 PHY.
+ *
+ * @param [in]  nPhyCmd         PHY Command from adf7030_1_radio_state_e. Set
+ *                              to Zero to only wait (event must be armed).
+ * @param [in]  nStatusPoll     Polling status
+ * @param [in]  nStatePoll      Polling state (expected state)
+ * @param [in]  nRetry          Number of polling retries once the wait is over.
+ *                              Set to Zero, for continuously polling the SPI Status.
+ * @param [in]  u32Timeout      Maximum time to wait for the PHY event.
+ *
+ * @note                        The caller is blocked in pSPIDevInfo->pfPhyWaitCb
+ *                              until the PHY signals the end of the transition
+ *                              (or timeout), then the status is checked with 
+ *                              adf7030_1__XferCmdPoll, which usually match on
+ *                              the first SPI transfer. Without wait function,
+ *                              this is strictly equivalent to adf7030_1__XferCmdPoll.
+ *
+ * @return      Status
+ *  - #0  If the Radio PHY Command transfers was successful.
+ *  - #1  [D] If the Radio PHY Command failed or if the communication with Radio
+ *        PHY failed or if critical Radio PHY Error has occurred.
+ */
+uint8_t adf7030_1__XferCmdWait(
+    adf7030_1_spi_info_t*   pSPIDevInfo,
+    uint8_t                 nPhyCmd,
+    uint32_t                nStatusPoll,
+    adf7030_1_radio_state_e nStatePoll,
+    uint8_t                 nRetry,
+    uint32_t                u32Timeout
+)
+{
+    if( (pSPIDevInfo->pfPhyWaitCb == NULL) || (u32Timeout == 0) )
+    {
+        return(adf7030_1__XferCmdPoll( pSPIDevInfo, nPhyCmd, nStatusPoll, nStatePoll, nRetry));
+    }
+
+    if(nPhyCmd)
+    {
+        /* PHY memory could change behind the host shadow */
+        adf7030_1__STATE_ShadowDrop( pSPIDevInfo, nPhyCmd);
+
+        /* Arm the event source, discard the previous event (if any) */
+        pSPIDevInfo->pfPhyWaitCb(pSPIDevInfo->pPhyWaitParam, 0);
+
+        /* Transmit the sequence */
+        adf7030_1__SPI_ReadWrite_Fast( pSPIDevInfo,
+                                       &nPhyCmd,
+                                       &pSPIDevInfo->nStatus.VALUE,
+                                       1 );
+        if(pSPIDevInfo->pfTraceCb != NULL)
+        {
+            pSPIDevInfo->pfTraceCb(pSPIDevInfo->pTraceParam, ADF7030_1_TRACE_CMD, nPhyCmd);
+        }
+    }
+
+    /* Sleep until the PHY state machine event. On timeout, just go on polling */
+    pSPIDevInfo->pfPhyWaitCb(pSPIDevInfo->pPhyWaitParam, u32Timeout);
+
+    /* Check the status (and error) */
+    return(adf7030_1__XferCmdPoll( pSPIDevInfo, 0, nStatusPoll, nStatePoll, nRetry));
+}
+
+
 #if (ADF7030_1_PHY_ERROR_REPORT_ENABLE == 1)
 
 /**
@@ -48,6 +48,11 @@ extern "C" {
 #define NOISE_MEAS_AVG_NB (10u)
 #endif
 
+#ifndef NOISE_SAMPLE_RETRY_NB
+/*! Define the maximum number of read-back to get one valid noise sample */
+#define NOISE_SAMPLE_RETRY_NB (10u)
+#endif
+
 typedef enum {
     FW_MODULE_NAME,
     FW_MODULE_VERSION,
@@ -81,10 +86,19 @@ uint16_t adf7030_1__GetRawNoise(
 	uint8_t               u8NbMeas
 );
 
+uint8_t adf7030_1__GetRawNoiseSample(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    uint16_t              *pu16Noise
+);
+
 int16_t adf7030_1__GetRawAfcFreqErr(
     adf7030_1_spi_info_t* pSPIDevInfo
 );
 
+int16_t adf7030_1__GetRawTemperature(
+    adf7030_1_spi_info_t* pSPIDevInfo
+);
+
 uint32_t adf7030_1__GetRawFrequency(
     adf7030_1_spi_info_t* pSPIDevInfo
 );
@@ -39,30 +39,36 @@
 extern "C" {
 #endif
 
-extern inline
+extern
 void PHY_CONV_IhmToRssi( uint8_t u8_IntPart,
                            uint8_t u8_DecPart,
                            uint8_t *u8_Rssi );
 
-extern inline
+extern
 void PHY_CONV_RssiToIhm( uint8_t u8_Rssi,
                            int16_t *i16_IntPart,
                            uint8_t *u8_DecPart );
 
-extern inline
+extern
 void PHY_CONV_Signed11ToIhm( uint16_t u16_Signed11,
                                int16_t *i16_IntPart,
                                uint8_t *u8_DecPart ) ;
 
-extern inline
+extern
 uint8_t PHY_CONV_Signed11ToRssi(uint16_t u16_Signed11);
 
-extern inline
+extern
 float PHY_CONV_Signed11ToFloat(uint16_t u16_Signed11);
 
-extern inline
+extern
 float PHY_CONV_AfcFreqErrToFloat(int16_t i16AfcFreqErr);
 
+extern
+int16_t PHY_CONV_Signed11ToQdBm(uint16_t u16_Signed11);
+
+extern
+int32_t PHY_CONV_AfcFreqErrToHz(int32_t i32AfcFreqErr);
+
 #ifdef __cplusplus
 }
 #endif
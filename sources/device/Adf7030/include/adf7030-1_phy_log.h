@@ -43,19 +43,32 @@ extern "C" {
 #include "adf7030-1_phy.h"
 
 /*!
-   Define max number of logged Host Radio driver instance error.\n
+   Define the number of errors kept in the last error codes ring.\n
 */
-#define NUM_INSTANCE_ERROR 19
+#ifndef PHY_LOG_ERR_RING_NB
+#define PHY_LOG_ERR_RING_NB 8
+#endif
 
 /*!
-   Define max number of logged PHY Radio error.\n
+   Last error codes ring entry.\n
 */
-#define NUM_PHY_ERROR 30
-
+typedef struct
+{
+    uint32_t u32Time; /*!< Epoch (s) */
+    uint16_t u16Ms;   /*!< Milliseconds */
+    uint8_t  u8Inst;  /*!< Instance error (adf7030_1_res_e) */
+    uint8_t  u8Phy;   /*!< PHY Radio error (MISC_FW ERR_CODE), if u8Inst is ADF7030_1_HW_ERROR */
+} phy_log_err_t;
 
 void CheckReturn(adf7030_1_device_t* const pDevice);
 const char* getErrMsg(adf7030_1_device_t* const pDevice );
 
+void PhyLog_ErrPush(adf7030_1_device_t* const pDevice);
+uint8_t PhyLog_ErrGet(uint8_t u8Idx, phy_log_err_t *pErr);
+uint32_t PhyLog_ErrTotal(void);
+void PhyLog_ErrClear(void);
+void PhyLog_ErrDump(void);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,101 @@
+/**
+  * @file adf7030-1_phy_log_tbl.h
+  * @brief This file list the ADF7030 instance and PHY error codes
+  *
+  * @details This is the single source of the error descriptions. It is
+  * expanded by adf7030-1_phy_log.c (X-macro : define PHY_LOG_INST_ERR and
+  * PHY_LOG_PHY_ERR before including it) and parsed by the host decoder
+  * (tools/scripts/phy_err_decode.py), so keep one entry per line :
+  *
+  *     PHY_LOG_xxx_ERR(code, name, "description")
+  *
+  * The code is the numerical value of name (checked at compile time).
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/* No include guard : included several times with different definitions */
+
+#ifndef PHY_LOG_INST_ERR
+#define PHY_LOG_INST_ERR(code, name, desc)
+#endif
+
+#ifndef PHY_LOG_PHY_ERR
+#define PHY_LOG_PHY_ERR(code, name, desc)
+#endif
+
+/* Host Radio driver instance errors (adf7030_1_res_e) */
+PHY_LOG_INST_ERR(0x00, ADF7030_1_SUCCESS, "The API is successful.")
+PHY_LOG_INST_ERR(0x01, ADF7030_1_FAILURE, "The API failed to complete the operation.")
+PHY_LOG_INST_ERR(0x02, ADF7030_1_HW_ERROR, "A hardware error was detected.")
+PHY_LOG_INST_ERR(0x03, ADF7030_1_INVALID_DEVICE_NUM, "The given device number is outside the number of instances supported by the driver.")
+PHY_LOG_INST_ERR(0x04, ADF7030_1_INVALID_HANDLE, "The given device handle is invalid.")
+PHY_LOG_INST_ERR(0x05, ADF7030_1_INSUFFICIENT_MEMORY, "The given memory is not sufficient to operate the device.")
+PHY_LOG_INST_ERR(0x06, ADF7030_1_NULL_POINTER, "One of the given pointer parameter points to NULL.")
+PHY_LOG_INST_ERR(0x07, ADF7030_1_UNALIGNED_MEM_PTR, "The given pointer to the device memory is not aligned to word boundary.")
+PHY_LOG_INST_ERR(0x08, ADF7030_1_DEVICE_ALREADY_OPENED, "The given device instance is already opened.")
+PHY_LOG_INST_ERR(0x09, ADF7030_1_DEVICE_NOT_OPENED, "The given device instance is not opened.")
+PHY_LOG_INST_ERR(0x0A, ADF7030_1_INVALID_OPERATION, "The given operation is not permitted in the current state of the driver.")
+PHY_LOG_INST_ERR(0x0B, ADF7030_1_DEVICE_ACCESS_FAILED, "Failed to read or write the device registers.")
+PHY_LOG_INST_ERR(0x0C, ADF7030_1_GPIO_DEV_FAILED, "Failed to register or unregister callback with GPIO service.")
+PHY_LOG_INST_ERR(0x0D, ADF7030_1_SPI_DEV_FAILED, "SPI device driver failure.")
+PHY_LOG_INST_ERR(0x0E, ADF7030_1_SPI_DEV_POLL_EXPIRE, "SPI device driver polling timeout.")
+PHY_LOG_INST_ERR(0x0F, ADF7030_1_SPI_COMM_FAILED, "SPI Communication device related failure.")
+PHY_LOG_INST_ERR(0x10, ADF7030_1_INVALID_PHY_CONFIGURATION, "The given PHY Radio configuration is invalid.")
+PHY_LOG_INST_ERR(0x11, ADF7030_1_PENDING_IO, "If trying to perform a read when another read/write in progress.")
+PHY_LOG_INST_ERR(0x12, ADF7030_1_DMA_NOT_SUPPORTED, "If trying to enable the DMA mode when communication device is TWI.")
+
+/* PHY Radio hardware errors (adf7030_1_radio_error_e, MISC_FW ERR_CODE) */
+PHY_LOG_PHY_ERR(0x00, SM_NOERROR, "No error")
+PHY_LOG_PHY_ERR(0x01, SM_INVALID_STATE, "Requested state does not exist")
+PHY_LOG_PHY_ERR(0x02, SM_TRANS_BLOCKED, "State transition has been denied")
+PHY_LOG_PHY_ERR(0x03, SM_TIMEOUT, "State machine timeout")
+PHY_LOG_PHY_ERR(0x04, SM_ILLEGAL_SCRIPT_CMD, "Illegal script command")
+PHY_LOG_PHY_ERR(0x05, SM_UNKNOWN_SPECIAL_CMD, "Unknown state machine special command")
+PHY_LOG_PHY_ERR(0x06, SM_UNPOPULATED_CUSTOM_CMD, "Special command is not configured")
+PHY_LOG_PHY_ERR(0x07, SM_PROFILE_CRC_INCORRECT, "Backup up configuration is not valid")
+PHY_LOG_PHY_ERR(0x08, SM_LPM_CRC_INCORRECT, "Not available ")
+PHY_LOG_PHY_ERR(0x09, SM_INVALID_SCRIPT_DATA, "Not available")
+PHY_LOG_PHY_ERR(0x30, SM_ROM_CRC_INCORRECT, "Not available")
+PHY_LOG_PHY_ERR(0x31, SM_PROFILE_CRC_CALCULATING, "Startup CRC calculation running (not really an error code)")
+PHY_LOG_PHY_ERR(0x11, HW_MAIN_PLL_VCO_CAL_FAILURE_COARSE_CAL_FAILED, "PLL course calibration failure")
+PHY_LOG_PHY_ERR(0x12, HW_MAIN_PLL_VCO_CAL_FAILURE_AMP_CAL_FAILED, "PLL amplitude calibration failure")
+PHY_LOG_PHY_ERR(0x13, HW_MAIN_PLL_VCO_CAL_FAILURE_FINE_CAL_FAILED, "PLL fine calibration failure")
+PHY_LOG_PHY_ERR(0x14, HW_ANC_PLL_LOCK_FAILED, "Auxiliary PLL lock failure")
+PHY_LOG_PHY_ERR(0x15, HW_MAIN_PLL_VCO_CAL_MODE_INVALID, "PLL calibration mode invalid")
+PHY_LOG_PHY_ERR(0x20, HW_TCXO_NOT_READY, "Temperature Compensated Crystal Oscillator failure")
+PHY_LOG_PHY_ERR(0x21, HW_XTAL_NOT_READY, "Crystal Oscillator failure")
+PHY_LOG_PHY_ERR(0x23, HW_OCL_CAL_FAILED, "Offset calibration failure")
+PHY_LOG_PHY_ERR(0x24, HW_DIV_BY_ZERO, "Hardware divide by zero")
+PHY_LOG_PHY_ERR(0x25, HW_VCO_KV_CAL_SINGLE_SHOT_FAILED, "VCO KV calibration step failure")
+PHY_LOG_PHY_ERR(0x26, HW_VCO_KV_CAL_FINE_CAL_FAILED, "VCO KV fine calibration failure")
+PHY_LOG_PHY_ERR(0x27, HW_VCO_KV_CAL_AMP_CAL_FAILED, "VCO KV amplitude calibration failure")
+PHY_LOG_PHY_ERR(0x28, HW_VCO_KV_HFXTAL_INVALID, "VCO KV clock source invalid")
+PHY_LOG_PHY_ERR(0x29, HW_VCO_KV_CAL_COARSE_CAL_FAILED, "VCO KV coarse calibration failure")
+PHY_LOG_PHY_ERR(0x32, HW_TEMP_SENSE_FAILED, "Temperature sensor failure")
+PHY_LOG_PHY_ERR(0x33, HW_LFRC_CAL_FAILED, "Low frequency oscillator calibration failure")
+PHY_LOG_PHY_ERR(0x3F, HW_HARD_FAULT_FAIL, "Firmware hard fault ")
+/* Unused : 0x0A to 0x10, 0x16 to 0x1F, 0x22, 0x2A to 0x2F, 0x34 to 0x3E */
+
+#undef PHY_LOG_INST_ERR
+#undef PHY_LOG_PHY_ERR
@@ -58,6 +58,135 @@ extern "C" {
 
 #define CAL_RES_SZ (36+8+32+8)
 
+/*!
+ * @brief Number of entries in the calibration cache (temperature / voltage keyed)
+ */
+#ifndef PHY_CAL_CACHE_NB
+#define PHY_CAL_CACHE_NB 4
+#endif
+
+/*!
+ * @brief Maximum temperature difference (degree Celsius) to use a cached calibration
+ */
+#ifndef PHY_CAL_TEMP_TOL
+#define PHY_CAL_TEMP_TOL 10
+#endif
+
+/*!
+ * @brief Maximum supply voltage difference (20 mV unit) to use a cached calibration
+ */
+#ifndef PHY_CAL_VDD_TOL
+#define PHY_CAL_VDD_TOL 10
+#endif
+
+/*!
+ * @brief Size of the calibration cache (NVM storage)
+ */
+#define PHY_CAL_CACHE_SZ (PHY_CAL_CACHE_NB * sizeof(phy_cal_entry_t))
+
+/*!
+ * @brief Number of frame slots in the continuous RX pool (must be a power of 2)
+ */
+#ifndef PHY_RX_POOL_NB
+#define PHY_RX_POOL_NB 4
+#endif
+
+/*!
+ * @brief Maximum frame size in the continuous RX pool
+ */
+#define PHY_RX_FRM_SZ 255
+
+/*!
+ * @brief Minimum number of samples before the LBT declares the channel free
+ */
+#ifndef PHY_LBT_MIN_FREE_NB
+#define PHY_LBT_MIN_FREE_NB 2
+#endif
+
+/*!
+ * @brief Bound of the AFC frequency correction (Hz, about 15 ppm at 169 MHz)
+ */
+#ifndef PHY_AFC_CORR_MAX
+#define PHY_AFC_CORR_MAX 2500
+#endif
+
+/*!
+ * @brief AFC tracking EWMA smoothing factor is 1/2^PHY_AFC_TRACK_SHIFT
+ */
+#ifndef PHY_AFC_TRACK_SHIFT
+#define PHY_AFC_TRACK_SHIFT 2
+#endif
+
+/*!
+ * @brief AFC tracking minimum number of frames before the first correction step
+ */
+#ifndef PHY_AFC_TRACK_MIN_NB
+#define PHY_AFC_TRACK_MIN_NB 4
+#endif
+
+/*!
+ * @brief AFC tracking dead band (Hz), no correction under it
+ */
+#ifndef PHY_AFC_TRACK_DEADBAND_HZ
+#define PHY_AFC_TRACK_DEADBAND_HZ 50
+#endif
+
+/*!
+ * @brief AFC tracking maximum correction step (Hz)
+ */
+#ifndef PHY_AFC_TRACK_STEP_HZ
+#define PHY_AFC_TRACK_STEP_HZ 100
+#endif
+
+/*!
+ * @brief AFC tracking outlier rejection, larger frequency errors are ignored (Hz)
+ */
+#ifndef PHY_AFC_TRACK_ERR_MAX_HZ
+#define PHY_AFC_TRACK_ERR_MAX_HZ 3000
+#endif
+
+/*!
+ * @brief AFC tracking minimum RSSI, weaker frames are ignored (dBm)
+ */
+#ifndef PHY_AFC_TRACK_RSSI_MIN
+#define PHY_AFC_TRACK_RSSI_MIN (-115)
+#endif
+
+/*!
+ * @brief AFC frequency correction drift from the stored value that worth a store (Hz)
+ */
+#ifndef PHY_AFC_TRACK_STORE_HZ
+#define PHY_AFC_TRACK_STORE_HZ 200
+#endif
+
+/*!
+ * @brief LPTIM used to pulse the trigger pin of a scheduled TX/RX (see BSP_LpTimer_SetHandler)
+ */
+#ifndef PHY_SCHED_LPTIM_ID
+#define PHY_SCHED_LPTIM_ID 1
+#endif
+
+/*!
+ * @brief Scheduled TX/RX : the setup (wake-up, configuration, payload) starts this time (us) before
+ */
+#ifndef PHY_SCHED_LEAD_US
+#define PHY_SCHED_LEAD_US 20000
+#endif
+
+/*!
+ * @brief Scheduled TX/RX : minimum time (us) left to arm the LPTIM, otherwise it is too late
+ */
+#ifndef PHY_SCHED_MIN_US
+#define PHY_SCHED_MIN_US 100
+#endif
+
+/*!
+ * @brief Scheduled TX/RX : fixed latency (us) from the LPTIM start to the trigger pulse (interrupt entry)
+ */
+#ifndef PHY_SCHED_ADJ_US
+#define PHY_SCHED_ADJ_US 0
+#endif
+
 /*!
  * @}
  * @endcond
@@ -79,6 +208,16 @@ typedef enum {
 	PHY_CMD_TEST     , /*!< Test mode */
 	PHY_CMD_AUTO_CAL , /*!< Auto calibration */
 	PHY_CMD_RSSI_CAL , /*!< RSSI calibration ( plus auto-calibration) */
+	PHY_CMD_SLEEP_MODE, /*!< Select the sleep mode (0 : warm, fast wake-up; 1 : cold, lowest current) */
+	PHY_CMD_RX_CONT  , /*!< Continuous RX (1 : enable, 0 : disable). Received frames are queued in the RX pool. While enabled, the other state commands return PHY_STATUS_BUSY */
+	PHY_CMD_RX_POP   , /*!< Get the oldest frame from the RX pool (args : pointer on phy_rx_frame_t) */
+	PHY_CMD_RX_STAGE , /*!< Pre-stage the next RX (args : rx_stage_info_t), written at the TX end of frame */
+	PHY_CMD_LBT      , /*!< Listen before talk (args : pointer on phy_lbt_t) */
+	PHY_CMD_CAL_ENV  , /*!< Set the temperature and voltage (args : cal_env_info_t), select the nearest cached calibration */
+	PHY_CMD_SPI_BENCH, /*!< SPI micro-benchmark (args : pointer on phy_spi_bench_t) */
+	PHY_CMD_NOISE_SCAN, /*!< Noise scan of several channels and modulations (args : pointer on phy_scan_t) */
+	PHY_CMD_SCHED    , /*!< TX or RX started at a given time (args : pointer on phy_sched_t) */
+	PHY_CMD_SCHED_START, /*!< Get the time of the last scheduled trigger pulse (args : pointer on uint32_t, 0 : none) */
 
 } phy_cmd_e;
 
@@ -96,6 +235,28 @@ typedef struct {
 	phy_power_t sEntryValue;
 } phy_power_entry_t;
 
+/*!
+ * @brief This define one calibration cache entry
+ */
+typedef struct {
+	int8_t   i8Temp;                   /*!< Temperature at calibration time (degree Celsius) */
+	uint8_t  u8Vdd;                    /*!< Supply voltage at calibration time (20 mV unit, 0 : unknown) */
+	uint8_t  u8Seq;                    /*!< Calibration sequence number (0 : empty entry) */
+	uint8_t  ND;
+	uint8_t  aCalRes[CAL_RES_SZ];      /*!< Radio then VCO calibration results (see Phy_GetCal) */
+} phy_cal_entry_t;
+
+/*!
+ * @brief This define one received frame (continuous RX pool slot)
+ */
+typedef struct {
+	uint64_t u64Time;               /*!< Reception time (end of frame, epoch in ms) */
+	uint16_t u16Rssi;               /*!< RSSI (raw, see PHY_CONV_Signed11ToRssi) */
+	uint16_t u16Ferr;               /*!< AFC frequency error (raw, see PHY_CONV_AfcFreqErrToFloat) */
+	uint8_t  u8Len;                 /*!< Frame length */
+	uint8_t  aData[PHY_RX_FRM_SZ];  /*!< Frame data */
+} phy_rx_frame_t;
+
 
 /*!
  * @brief PHY device SPORT I/O selection
@@ -124,6 +285,106 @@ typedef union
 	};
 } test_mode_info_t;
 
+/*!
+ * @brief PHY device pre-staged RX info
+ */
+typedef union
+{
+	uint32_t rxStage;
+	struct {
+		phy_chan_e      eChannel;    /*!< Channel of the next RX */
+		phy_mod_e       eModulation; /*!< Modulation of the next RX */
+		uint8_t         bEnable;     /*!< Enable (1) or cancel (0) the pre-staged RX */
+	};
+} rx_stage_info_t;
+
+/*!
+ * @brief PHY device listen before talk request and result
+ *
+ * @details Noise samples are averaged until the mean is clearly above
+ * (threshold + margin : busy) or clearly below (threshold - margin, after
+ * PHY_LBT_MIN_FREE_NB samples : free) the threshold. Otherwise, the decision is
+ * taken on the mean of the u8NbSample samples.
+ */
+typedef struct
+{
+	phy_chan_e eChannel;     /*!< Channel to listen */
+	phy_mod_e  eModulation;  /*!< Modulation to listen */
+	int8_t     i8Threshold;  /*!< Busy threshold (dBm) */
+	uint8_t    u8Margin;     /*!< Early decision margin around the threshold (dB) */
+	uint8_t    u8NbSample;   /*!< Maximum number of samples (at least 1) */
+	uint8_t    bTxAfter;     /*!< If free, stay in CCA : the next TX on the same channel starts from there */
+	uint8_t    bBusy;        /*!< [out] Channel is busy (1) or free (0) */
+	uint8_t    u8Nb;         /*!< [out] Number of samples taken */
+	uint16_t   u16Noise;     /*!< [out] Average noise (raw, see PHY_CONV_Signed11ToRssi) */
+	uint16_t   *pSamples;    /*!< [out] Optional (NULL) : noise of each sample (raw), u8NbSample entries */
+} phy_lbt_t;
+
+/*!
+ * @brief PHY device calibration environment
+ */
+typedef union
+{
+	uint32_t calEnv;
+	struct {
+		int8_t  i8Temp;    /*!< Temperature (degree Celsius) */
+		uint8_t u8Vdd;     /*!< Supply voltage (20 mV unit, 0 : unknown) */
+		uint8_t bMeasTemp; /*!< Measure the temperature with the PHY, i8Temp is ignored */
+		uint8_t bAutoCal;  /*!< Auto-calibrate if no cached calibration is close enough */
+	};
+} cal_env_info_t;
+
+/*!
+ * @brief Size (in bytes) of one bulk memory read of the SPI micro-benchmark
+ */
+#define PHY_SPI_BENCH_BULK_SZ 240
+
+/*!
+ * @brief PHY device SPI micro-benchmark request and result
+ *
+ * @details The caller measures the elapsed time around the request to get the
+ * transactions per second.
+ */
+typedef struct
+{
+	uint8_t  bBulk;   /*!< 0 : 32 bits register reads; 1 : PHY_SPI_BENCH_BULK_SZ bytes memory reads */
+	uint16_t u16Nb;   /*!< Number of reads */
+	uint16_t u16Done; /*!< [out] Number of successful reads */
+} phy_spi_bench_t;
+
+/*!
+ * @brief PHY device noise scan request and result
+ *
+ * @details For each modulation, the PHY is configured and set in CCA once, then
+ * only the channel frequency is changed from one channel to the next.
+ */
+typedef struct
+{
+	uint8_t  u8ChMsk;    /*!< Channels to scan (bit n : phy_chan_e n) */
+	uint8_t  u8ModMsk;   /*!< Modulations to scan (bit n : phy_mod_e n) */
+	uint8_t  u8NbSample; /*!< Number of noise samples averaged on each channel (at least 1) */
+	uint8_t  u8Nb;       /*!< [out] Number of measured channels */
+	uint16_t aNoise[PHY_NB_MOD][PHY_NB_CH]; /*!< [out] Average noise (raw, see PHY_CONV_Signed11ToRssi), 0 if not measured */
+} phy_scan_t;
+
+/*!
+ * @brief PHY device scheduled TX or RX request
+ *
+ * @details The request blocks until PHY_SCHED_LEAD_US before u32Time, then
+ * the PHY is set up (configuration, channel, payload already given by
+ * pfSetSend) and left in PHY_ON with the trigger pin set on the command. The
+ * trigger pulse is given by the LPTIM interrupt at u32Time, the PHY state
+ * transition time (PHY_ON to PHY_TX or PHY_RX) follows. The end of frame is
+ * notified as usual. Another command before the pulse cancels it.
+ */
+typedef struct
+{
+	uint32_t   u32Time;     /*!< Start time (HiResTime, us) */
+	uint8_t    eCmd;        /*!< PHY_CMD_TX or PHY_CMD_RX */
+	phy_chan_e eChannel;    /*!< Channel */
+	phy_mod_e  eModulation; /*!< Modulation */
+} phy_sched_t;
+
 /******************************************************************************/
 
 int32_t Phy_adf7030_setup(
@@ -140,6 +401,11 @@ int32_t Phy_adf7030_setup(
 int32_t Phy_GetCal(uint8_t *pBuf);
 int32_t Phy_SetCal(uint8_t *pBuf);
 int32_t Phy_ClrCal(void);
+int32_t Phy_GetCalCache(uint8_t *pBuf);
+int32_t Phy_SetCalCache(uint8_t *pBuf);
+int32_t Phy_SetPower(const phy_power_t *pPwr);
+int16_t Phy_GetAfcCorr(void);
+int32_t Phy_SetAfcCorr(int16_t i16Corr);
 
 #ifdef PHY_USE_POWER_RAMP
 	extern pa_ramp_rate_e pa_ramp_rate;
@@ -0,0 +1,112 @@
+/**
+  * @file phy_stats.h
+  * @brief This file declares the PHY signal statistics (RSSI, noise and AFC
+  * frequency error per channel and modulation)
+  *
+  * @details
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup phy_layer
+ * @ingroup device
+ * @{
+ *
+ */
+#ifndef _PHY_STATS_H_
+#define _PHY_STATS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/*!
+ * @brief EWMA smoothing factor is 1/2^PHY_STATS_EWMA_SHIFT
+ */
+#ifndef PHY_STATS_EWMA_SHIFT
+#define PHY_STATS_EWMA_SHIFT 3
+#endif
+
+/*!
+ * @brief Lower bound of the level histogram (dBm)
+ */
+#define PHY_STATS_HIST_MIN (-140)
+
+/*!
+ * @brief Width of one level histogram bin (dBm)
+ */
+#define PHY_STATS_HIST_STEP 2
+
+/*!
+ * @brief Number of level histogram bins (levels out of range go in the end bins)
+ */
+#define PHY_STATS_HIST_NB 48
+
+/*!
+ * @brief This struct define the statistics of one level (all in 1/4 dBm)
+ */
+typedef struct
+{
+	uint16_t u16Count; /*!< Number of measures (saturated) */
+	int16_t  i16Ewma;  /*!< Exponentially weighted moving average (short term) */
+	int16_t  i16Min;   /*!< Minimum */
+	int16_t  i16Max;   /*!< Maximum */
+	int16_t  i16P10;   /*!< 10th percentile (histogram bin, within minimum and maximum) */
+	int16_t  i16P50;   /*!< Median (long term) */
+	int16_t  i16P90;   /*!< 90th percentile */
+} phy_stats_lvl_t;
+
+/*!
+ * @brief This struct define the statistics of one channel and modulation
+ */
+typedef struct
+{
+	phy_stats_lvl_t sRssi;  /*!< Received frames RSSI */
+	phy_stats_lvl_t sNoise; /*!< CCA / LBT noise level */
+	uint16_t u16FerrNb;     /*!< Number of AFC frequency error measures */
+	int32_t  i32FerrHz;     /*!< Mean AFC frequency error (Hz) */
+} phy_stats_t;
+
+void PhyStats_Clear(void);
+void PhyStats_Rx(uint8_t u8Ch, uint8_t u8Mod, uint16_t u16Rssi, uint16_t u16Ferr);
+void PhyStats_Noise(uint8_t u8Ch, uint8_t u8Mod, uint16_t u16Noise);
+uint8_t PhyStats_Get(uint8_t u8Ch, uint8_t u8Mod, phy_stats_t *pStats);
+uint8_t PhyStats_Quietest(uint8_t u8Mod, int16_t *pi16Noise);
+
+#if defined (USE_PHY_STATS)
+#define PHY_STATS_RX(ch, mod, rssi, ferr) PhyStats_Rx(ch, mod, rssi, ferr)
+#define PHY_STATS_NOISE(ch, mod, noise) PhyStats_Noise(ch, mod, noise)
+#else
+#define PHY_STATS_RX(ch, mod, rssi, ferr)
+#define PHY_STATS_NOISE(ch, mod, noise)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _PHY_STATS_H_ */
+
+/*! @} */
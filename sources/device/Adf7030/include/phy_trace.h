@@ -0,0 +1,138 @@
+/**
+  * @file phy_trace.h
+  * @brief This file declares the PHY timing trace (time-stamped event ring and
+  * per-transition latency statistics)
+  *
+  * @details
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup phy_layer
+ * @ingroup device
+ * @{
+ *
+ */
+#ifndef _PHY_TRACE_H_
+#define _PHY_TRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/*!
+ * @brief Number of entries in the trace ring (must be a power of 2)
+ */
+#ifndef PHY_TRACE_RING_SIZE
+#define PHY_TRACE_RING_SIZE 256
+#endif
+
+/*!
+ * @brief Number of latency histogram bins (4 bins per octave of us)
+ */
+#define PHY_TRACE_HIST_NB 72
+
+/*!
+ * @brief This enum define the traced events
+ *
+ * @details The three first ones are the driver events (see adf7030_1_trace_evt_e).
+ */
+typedef enum
+{
+	PHY_TRACE_CMD,         /*!< Radio command sent (arg : command byte) */
+	PHY_TRACE_CMD_DONE,    /*!< Radio command wait is over (arg : expected state) */
+	PHY_TRACE_XFER,        /*!< SPI frame (arg : size in bytes) */
+	// ---
+	PHY_TRACE_IRQ,         /*!< PHY interrupt (arg : interrupt pin) */
+	PHY_TRACE_FRM_PROCESS, /*!< Frame interrupt processing start (service task) */
+	PHY_TRACE_TX_EOF,      /*!< TX end of frame */
+	PHY_TRACE_RX_PREAMBLE, /*!< RX preamble detected */
+	PHY_TRACE_RX_EOF,      /*!< RX end of frame */
+	PHY_TRACE_WAKEUP,      /*!< Ready sequence start, from PHY_SLEEP */
+	PHY_TRACE_READY,       /*!< Ready sequence end (arg : 0 success, 1 failure) */
+	// ---
+	PHY_TRACE_NB_EVT
+} phy_trace_evt_e;
+
+/*!
+ * @brief This enum define the measured transitions (latencies)
+ */
+typedef enum
+{
+	PHY_TRACE_LAT_WAKEUP,    /*!< PHY_SLEEP to PHY_ON (full ready sequence) */
+	PHY_TRACE_LAT_OFF,       /*!< Command to PHY_OFF reached */
+	PHY_TRACE_LAT_ON,        /*!< Command to PHY_ON reached */
+	PHY_TRACE_LAT_CFG_DEV,   /*!< Command to CFG_DEV done (back to PHY_OFF) */
+	PHY_TRACE_LAT_TX,        /*!< Command to PHY_TX reached */
+	PHY_TRACE_LAT_RX,        /*!< Command to PHY_RX reached */
+	PHY_TRACE_LAT_CCA,       /*!< Command to CCA reached */
+	PHY_TRACE_LAT_FRM_IRQ,   /*!< Frame interrupt to its processing (service task) */
+	PHY_TRACE_LAT_TX_EOF_RX, /*!< TX end of frame to PHY_RX reached */
+	// ---
+	PHY_TRACE_NB_LAT
+} phy_trace_lat_e;
+
+/*!
+ * @brief This struct define one trace ring entry
+ */
+typedef struct
+{
+	uint32_t u32Time; /*!< Time-stamp (us, high resolution timer) */
+	uint8_t  u8Seq;   /*!< Sequence number (LSB), to detect the overwritten entries */
+	uint8_t  u8Evt;   /*!< Event (see phy_trace_evt_e) */
+	uint16_t u16Arg;  /*!< Event argument */
+} phy_trace_entry_t;
+
+/*!
+ * @brief This struct define the statistics of one transition (all in us)
+ */
+typedef struct
+{
+	uint32_t u32Count; /*!< Number of measures */
+	uint32_t u32Min;   /*!< Minimum */
+	uint32_t u32Avg;   /*!< Average */
+	uint32_t u32Max;   /*!< Maximum */
+	uint32_t u32P99;   /*!< 99th percentile (histogram bin upper bound, up to the maximum) */
+} phy_trace_lat_t;
+
+void PhyTrace_Init(void);
+void PhyTrace_Clear(void);
+void PhyTrace_Add(uint8_t u8Evt, uint16_t u16Arg);
+void PhyTrace_GetLat(uint8_t u8Lat, phy_trace_lat_t *pLat);
+uint16_t PhyTrace_GetLast(phy_trace_entry_t *pEntry, uint16_t u16Nb);
+
+#if defined (USE_PHY_TIME_TRACE)
+#define PHY_TIME_TRACE(evt, arg) PhyTrace_Add(evt, arg)
+#else
+#define PHY_TIME_TRACE(evt, arg)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _PHY_TRACE_H_ */
+
+/*! @} */
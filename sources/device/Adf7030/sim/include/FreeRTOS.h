@@ -0,0 +1,64 @@
+/**
+  * @file FreeRTOS.h
+  * @brief This file define the minimal FreeRTOS subset used by the PHY layer,
+  * for the host simulator
+  *
+  * @details One tick is one millisecond of modelled time. Only static
+  * allocation is provided, as on target.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+#ifndef _SIM_FREERTOS_H_
+#define _SIM_FREERTOS_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <assert.h>
+#include <stdint.h>
+#include <stddef.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define pdFALSE ( (BaseType_t) 0 )
+#define pdTRUE  ( (BaseType_t) 1 )
+#define pdPASS  pdTRUE
+#define pdFAIL  pdFALSE
+
+#define portMAX_DELAY ( (TickType_t) 0xFFFFFFFFUL )
+#define pdMS_TO_TICKS(xTimeInMs) ( (TickType_t) (xTimeInMs) )
+
+#ifndef configMAX_PRIORITIES
+#define configMAX_PRIORITIES 7
+#endif
+
+#define configASSERT(x) assert(x)
+#define portYIELD_FROM_ISR(x) ( (void)(x) )
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _SIM_FREERTOS_H_ */
@@ -0,0 +1,153 @@
+/**
+  * @file adf7030-1_sim.h
+  * @brief This file define the ADF7030-1 behavioural model (host simulator)
+  *
+  * @details The model sits behind the SPI BSP, so that the unchanged
+  * "phy_layer.c" and "adf7030-1__*.c" sources can run on a Linux host. It
+  * implements the SPI command protocol (pointer, block and random modes), the
+  * memory map, the state machine and the interrupt lines, on a virtual clock.
+  * Every SPI transaction, byte and modelled nanosecond is counted.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup adf7030_sim
+ * @ingroup device
+ * @{
+ *
+ */
+#ifndef _ADF7030_1_SIM_H_
+#define _ADF7030_1_SIM_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/*!
+ * @brief Maximum number of frames waiting to be received by the model
+ */
+#ifndef ADF7030_1_SIM_RX_QUEUE_SZ
+#define ADF7030_1_SIM_RX_QUEUE_SZ 4
+#endif
+
+/*!
+ * @brief Maximum number of channel frequencies with their own noise level
+ */
+#ifndef ADF7030_1_SIM_CH_NOISE_SZ
+#define ADF7030_1_SIM_CH_NOISE_SZ 8
+#endif
+
+/*!
+ * @brief This struct define the model timing (in ns)
+ *
+ * @details The default values are typical orders of magnitude taken from the
+ * ADF7030-1 datasheet. They are not measured on target : update them with
+ * measured values to compare absolute timings, relative comparisons between two
+ * driver versions stay valid anyway.
+ */
+typedef struct {
+	uint32_t u32SpiOverhead; /*!< Per SPI transaction host overhead (call, CS setup/hold) */
+	uint32_t u32SpiConfig;   /*!< Host SPI bitrate change (peripheral reconfiguration) */
+	uint32_t u32Boot;        /*!< Reset (or cold wake-up) to PHY_OFF */
+	uint32_t u32WarmWakeup;  /*!< Wake-up to PHY_OFF, with SRAM retention */
+	uint32_t u32Sleep;       /*!< Any state to PHY_SLEEP */
+	uint32_t u32CfgDev;      /*!< CFG_DEV (configuration apply), back to PHY_OFF */
+	uint32_t u32OffToOn;     /*!< PHY_OFF to PHY_ON (XTAL, synthesizer) */
+	uint32_t u32OnToOff;     /*!< PHY_ON to PHY_OFF */
+	uint32_t u32OnToTx;      /*!< PHY_ON to PHY_TX (PLL lock, PA ramp) */
+	uint32_t u32OnToRx;      /*!< PHY_ON to PHY_RX */
+	uint32_t u32OnToCca;     /*!< PHY_ON to CCA */
+	uint32_t u32ToOn;        /*!< PHY_TX, PHY_RX, CCA or MON to PHY_ON */
+	uint32_t u32Cal;         /*!< DO_CAL (offline calibration), back to PHY_ON */
+} adf7030_1_sim_timing_t;
+
+/*!
+ * @brief This struct define the model counters
+ */
+typedef struct {
+	uint32_t u32Xfer;      /*!< Number of SPI transactions (chip select frames) */
+	uint32_t u32Byte;      /*!< Number of SPI bytes */
+	uint32_t u32Cmd;       /*!< Number of radio commands (state change, reset) */
+	uint32_t u32Poll;      /*!< Number of status polling (NOP or MISC_FW short read) */
+	uint32_t u32MemRd;     /*!< Number of memory bytes read */
+	uint32_t u32MemWr;     /*!< Number of memory bytes written */
+	uint32_t u32CmdLost;   /*!< Number of radio commands sent while not CMD_READY */
+	uint32_t u32BadAccess; /*!< Number of accesses outside the memory map, or while the PHY doesn't answer */
+	uint32_t u32Irq;       /*!< Number of interrupt rising edges */
+	uint32_t u32SpiConfig; /*!< Number of host SPI bitrate changes */
+	uint64_t u64SpiTime;   /*!< Modelled SPI bus time (ns) */
+	uint64_t u64HoldTime;  /*!< Time the SPI frames were held by the PHY boot (ns) */
+	uint64_t u64Time;      /*!< Modelled wall-time (ns) */
+} adf7030_1_sim_stats_t;
+
+/*!
+ * @brief This define the interrupt line edge call-back
+ *
+ * @param [in] u8Pin PHY interrupt line (0 : IRQ_OUT0, 1 : IRQ_OUT1)
+ */
+typedef void (*pfSimIrqCb_t)(uint8_t u8Pin);
+
+/*!
+ * @brief This define the host timer call-back
+ */
+typedef void (*pfSimTimerCb_t)(void);
+
+void adf7030_1_Sim_Init(void);
+void adf7030_1_Sim_SetTiming(const adf7030_1_sim_timing_t *pTiming);
+void adf7030_1_Sim_SetIrqCallback(pfSimIrqCb_t pfCb);
+void adf7030_1_Sim_SetHostTimer(uint64_t u64Ns, pfSimTimerCb_t pfCb);
+
+uint64_t adf7030_1_Sim_Now(void);
+uint64_t adf7030_1_Sim_NextEvent(void);
+void adf7030_1_Sim_Advance(uint64_t u64Ns);
+
+void adf7030_1_Sim_Xfer(const uint8_t *pTx, uint8_t *pRx, uint32_t u32Len, uint32_t u32Bitrate);
+void adf7030_1_Sim_SpiConfig(void);
+void adf7030_1_Sim_SetCS(uint8_t bLevel);
+void adf7030_1_Sim_SetReset(uint8_t bLevel);
+void adf7030_1_Sim_SetPower(uint8_t bOn);
+void adf7030_1_Sim_SetTrig(uint8_t u8Pin, uint8_t bLevel);
+
+void adf7030_1_Sim_SetAirRate(uint32_t u32Bps);
+void adf7030_1_Sim_SetNoise(uint16_t u16Noise);
+void adf7030_1_Sim_SetChNoise(uint32_t u32Freq, uint16_t u16Noise);
+void adf7030_1_Sim_SetAfc(uint32_t u32Carrier, int32_t i32LoErr);
+void adf7030_1_Sim_SetTemperature(int16_t i16Temp);
+void adf7030_1_Sim_SetSelfCheck(uint32_t u32InfoAddr, uint16_t u16CheckSeq, uint16_t u16InjectSeq);
+uint32_t adf7030_1_Sim_Crc(const uint8_t *pData, uint32_t u32Len, uint32_t u32Poly, uint32_t u32Seed, uint8_t u8Len);
+uint8_t adf7030_1_Sim_QueueRxFrame(uint32_t u32DelayUs, const uint8_t *pData, uint8_t u8Len, uint16_t u16Rssi);
+
+uint8_t adf7030_1_Sim_GetState(void);
+uint32_t adf7030_1_Sim_ReadMem32(uint32_t u32Addr);
+
+void adf7030_1_Sim_GetStats(adf7030_1_sim_stats_t *pStats);
+void adf7030_1_Sim_ClrStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _ADF7030_1_SIM_H_ */
+
+/*! @} */
@@ -0,0 +1,54 @@
+/**
+  * @file bsp_sim.h
+  * @brief This file define the host simulator BSP wiring
+  *
+  * @details The BSP functions used by the PHY layer are implemented on top of
+  * the ADF7030-1 model. GPIO ports are plain numbers on the host.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+#ifndef _BSP_SIM_H_
+#define _BSP_SIM_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define SIM_GPIO_PORT       1  /*!< The only simulated GPIO port */
+#define SIM_GPIO_SS_PIN     0  /*!< ADF7030-1 SPI chip select */
+#define SIM_GPIO_RESET_PIN  1  /*!< ADF7030-1 reset (active low) */
+#define SIM_GPIO_INT0_PIN   2  /*!< ADF7030-1 IRQ_OUT0 */
+#define SIM_GPIO_INT1_PIN   3  /*!< ADF7030-1 IRQ_OUT1 */
+#define SIM_GPIO_TRIG0_PIN  4  /*!< ADF7030-1 trigger input 0 */
+#define SIM_GPIO_TRIG1_PIN  5  /*!< ADF7030-1 trigger input 1 */
+#define SIM_GPIO_NB_PIN     6
+
+#define SIM_SPI_BITRATE_DEFAULT 1000000 /*!< SPI bit rate until set by the driver */
+
+void BSP_Sim_Init(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _BSP_SIM_H_ */
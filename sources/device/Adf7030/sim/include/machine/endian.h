@@ -0,0 +1,57 @@
+/**
+  * @file endian.h
+  * @brief This file replace the newlib "machine/endian.h" on the host build
+  *
+  * @details The adf7030-1 driver uses the newlib byte order helpers, and the
+  * ARM CMSIS byte reverse intrinsics (__REV, __REV16). The host is assumed
+  * little-endian, as the target.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+#ifndef _SIM_MACHINE_ENDIAN_H_
+#define _SIM_MACHINE_ENDIAN_H_
+
+#include <endian.h>
+#include <stdint.h>
+
+#ifndef __htonl
+#define __htonl(x) htobe32((uint32_t)(x))
+#endif
+#ifndef __ntohl
+#define __ntohl(x) be32toh((uint32_t)(x))
+#endif
+#ifndef __htons
+#define __htons(x) htobe16((uint16_t)(x))
+#endif
+#ifndef __ntohs
+#define __ntohs(x) be16toh((uint16_t)(x))
+#endif
+
+#ifndef __REV
+#define __REV(x) __builtin_bswap32((uint32_t)(x))
+#endif
+#ifndef __REV16
+#define __REV16(x) ( (((uint32_t)(x) & 0xFF00FF00UL) >> 8) | (((uint32_t)(x) & 0x00FF00FFUL) << 8) )
+#endif
+
+#endif /* _SIM_MACHINE_ENDIAN_H_ */
@@ -0,0 +1,59 @@
+/**
+  * @file semphr.h
+  * @brief This file define the FreeRTOS binary semaphore and recursive mutex
+  * subset of the host simulator
+  *
+  * @details Blocking on a semaphore advances the modelled time, event by event,
+  * up to the timeout.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+#ifndef _SIM_SEMPHR_H_
+#define _SIM_SEMPHR_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "FreeRTOS.h"
+
+typedef struct {
+	volatile uint32_t u32Count;
+	uint8_t  u8Owner;   /*!< Recursive mutex owner (0 : none, 1 : main flow, 2 : task) */
+	uint32_t u32Depth;  /*!< Recursive mutex take count */
+} StaticSemaphore_t;
+
+typedef StaticSemaphore_t* SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *pxSemaphoreBuffer);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken);
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic(StaticSemaphore_t *pxMutexBuffer);
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t xMutex, TickType_t xBlockTime);
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t xMutex);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _SIM_SEMPHR_H_ */
@@ -0,0 +1,75 @@
+/**
+  * @file task.h
+  * @brief This file define the FreeRTOS task subset of the host simulator
+  *
+  * @details A single task is supported (the PHY service task). It runs as a
+  * coroutine, only when the main flow blocks (see xSemaphoreTake and
+  * SimRtos_Idle), never from an interrupt call-back.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+#ifndef _SIM_TASK_H_
+#define _SIM_TASK_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void *);
+
+typedef struct {
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	uint32_t ulNotifiedValue;
+} StaticTask_t;
+
+typedef StaticTask_t* TaskHandle_t;
+
+#define taskSCHEDULER_SUSPENDED   ( (BaseType_t) 0 )
+#define taskSCHEDULER_NOT_STARTED ( (BaseType_t) 1 )
+#define taskSCHEDULER_RUNNING     ( (BaseType_t) 2 )
+
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+#define taskENTER_CRITICAL_FROM_ISR() ( (UBaseType_t) 0 )
+#define taskEXIT_CRITICAL_FROM_ISR(x) ( (void)(x) )
+
+TaskHandle_t xTaskCreateStatic(
+		TaskFunction_t pxTaskCode, const char * const pcName,
+		const uint32_t ulStackDepth, void * const pvParameters,
+		UBaseType_t uxPriority, StackType_t * const puxStackBuffer,
+		StaticTask_t * const pxTaskBuffer);
+
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken);
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+BaseType_t xTaskGetSchedulerState(void);
+void vTaskDelay(const TickType_t xTicksToDelay);
+
+void SimRtos_Start(void);
+void SimRtos_Idle(uint32_t u32Us);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _SIM_TASK_H_ */
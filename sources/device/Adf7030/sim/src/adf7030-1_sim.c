@@ -0,0 +1,1451 @@
+/**
+  * @file adf7030-1_sim.c
+  * @brief This file implement the ADF7030-1 behavioural model (host simulator)
+  *
+  * @details The model is driven by the SPI frames, the chip select, the reset
+  * and the power line. Time only moves forward when a SPI frame is exchanged
+  * or when the host explicitly advance it (sleep, RTOS blocking call). State
+  * transitions and frame events are scheduled on this virtual clock.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup adf7030_sim
+ * @{
+ *
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+
+#include "adf7030-1_sim.h"
+
+#include "adf7030-1__common.h"
+#include "adf7030-1__irq.h"
+#include "adf7030-1__spi.h"
+#include "adf7030-1__state.h"
+#include "adf7030-1_reg.h"
+
+/******************************************************************************/
+#define SIM_SRAM_BASE   0x20000000UL
+#define SIM_SRAM_SZ     0x4000UL
+#define SIM_PERIPH_BASE 0x40000000UL
+#define SIM_PERIPH_SZ   0x6000UL
+
+#define SIM_MCR_HIGH    (MCR_BASE + 0x100UL)
+
+#define SIM_TRANSITION  0
+#define SIM_STATE       1
+#define SIM_IDLE        2
+
+#define SIM_NO_EVENT    UINT64_MAX
+
+// Patch checksum descriptor (see patch_checksum_desc_t)
+#define SIM_CHK_NB_OFFSET      1
+#define SIM_CHK_CFG_OFFSET     2
+#define SIM_CHK_POLY_OFFSET    4
+#define SIM_CHK_SEED_OFFSET    8
+#define SIM_CHK_OUTPUT_OFFSET 12
+#define SIM_CHK_GOLDEN_OFFSET 16
+#define SIM_CHK_SECT_OFFSET   20
+
+// crc_config_t bits (see adf7030-1__patch.h)
+#define SIM_CRC_ENABLE_Msk    0x0001
+#define SIM_CRC_INJECT_OK_Msk 0x0080
+#define SIM_CRC_LEN_Pos       9
+#define SIM_CRC_LEN_Msk       0xFE00
+
+/*!
+ * @brief Frame event step
+ */
+typedef enum {
+	SIM_FRM_NONE,
+	SIM_FRM_PREAMBLE,
+	SIM_FRM_SYNC,
+	SIM_FRM_EOF,
+} sim_frm_step_e;
+
+/*!
+ * @brief RX frame waiting in the queue
+ */
+typedef struct {
+	uint32_t u32DelayUs;
+	uint16_t u16Rssi;
+	uint8_t  u8Len;
+	uint8_t  aData[255];
+} sim_rx_frame_t;
+
+/*!
+ * @brief Model context
+ */
+typedef struct {
+	uint8_t  aSram[SIM_SRAM_SZ];
+	uint8_t  aPeriph[SIM_PERIPH_SZ];
+
+	uint64_t u64Now;
+	uint64_t u64StatsStart;
+
+	// pins
+	uint8_t  bPower;
+	uint8_t  bReset;
+	uint8_t  bCS;
+	uint8_t  bLine[2];
+	uint8_t  bTrig[2];
+	uint8_t  u8TrigEn;   /*!< Enabled trigger pins (bit 0 : TRIG_IN0, bit 1 : TRIG_IN1) */
+
+	// host timer
+	uint64_t u64HostTimer;
+	pfSimTimerCb_t pfHostTimerCb;
+
+	// state machine
+	uint8_t  bAwake;
+	uint8_t  eState;
+	uint8_t  eTrans;
+	uint64_t u64TransEnd;
+
+	// frame
+	uint8_t  eFrmStep;
+	uint8_t  bFrmRx;
+	uint64_t u64FrmNext;
+
+	// air
+	uint32_t u32AirRate;
+	uint16_t u16Noise;
+	uint32_t aChNoiseFreq[ADF7030_1_SIM_CH_NOISE_SZ];
+	uint16_t aChNoise[ADF7030_1_SIM_CH_NOISE_SZ];
+	uint32_t u32Carrier;
+	int32_t  i32LoErr;
+	int16_t  i16Temp;
+	uint8_t  u8RxHead;
+	uint8_t  u8RxCount;
+	sim_rx_frame_t aRxQueue[ADF7030_1_SIM_RX_QUEUE_SZ];
+
+	// patch selfcheck
+	uint32_t u32ChkInfo;
+	uint16_t u16ChkSeq;
+	uint16_t u16InjectSeq;
+
+	pfSimIrqCb_t pfIrqCb;
+	adf7030_1_sim_timing_t sTiming;
+	adf7030_1_sim_stats_t sStats;
+} sim_cxt_t;
+
+static sim_cxt_t sSim;
+
+static const adf7030_1_sim_timing_t sDefaultTiming = {
+	.u32SpiOverhead =    2000,
+	.u32SpiConfig   =    3000,
+	.u32Boot        = 1000000,
+	.u32WarmWakeup  =  300000,
+	.u32Sleep       =   50000,
+	.u32CfgDev      =  150000,
+	.u32OffToOn     =  300000,
+	.u32OnToOff     =   50000,
+	.u32OnToTx      =  130000,
+	.u32OnToRx      =  130000,
+	.u32OnToCca     =  130000,
+	.u32ToOn        =   50000,
+	.u32Cal         = 2500000,
+};
+
+/******************************************************************************/
+/* Memory map                                                                 */
+/******************************************************************************/
+
+/*!
+ * @static
+ * @brief Get the model storage of one byte address
+ *
+ * @param [in] u32Addr Address
+ *
+ * @return Pointer on the storage, NULL if outside the memory map
+ */
+static uint8_t *_mem(uint32_t u32Addr)
+{
+	if (u32Addr - SIM_SRAM_BASE < SIM_SRAM_SZ)
+	{
+		return &sSim.aSram[u32Addr - SIM_SRAM_BASE];
+	}
+	if (u32Addr - SIM_PERIPH_BASE < SIM_PERIPH_SZ)
+	{
+		return &sSim.aPeriph[u32Addr - SIM_PERIPH_BASE];
+	}
+	return NULL;
+}
+
+/*!
+ * @static
+ * @brief Read one byte
+ *
+ * @details The two lower bytes of MISC_FW give the state machine status.
+ *
+ * @param [in] u32Addr Address
+ *
+ * @return The byte value
+ */
+static uint8_t _rd8(uint32_t u32Addr)
+{
+	uint8_t *p;
+	if (u32Addr == MISC_FW_Addr)
+	{
+		return sSim.eTrans;
+	}
+	if (u32Addr == MISC_FW_Addr + 1)
+	{
+		return sSim.eState & 0x3F;
+	}
+	p = _mem(u32Addr);
+	if (!p)
+	{
+		sSim.sStats.u32BadAccess++;
+		return 0;
+	}
+	return *p;
+}
+
+/*!
+ * @static
+ * @brief Write one byte
+ *
+ * @details IRQ_CTRL STATUS0/1 are write one to clear, MISC_FW lower bytes are
+ * read-only.
+ *
+ * @param [in] u32Addr Address
+ * @param [in] u8Val   The value to write
+ *
+ */
+static void _wr8(uint32_t u32Addr, uint8_t u8Val)
+{
+	uint8_t *p;
+	if (u32Addr == MISC_FW_Addr || u32Addr == MISC_FW_Addr + 1)
+	{
+		return;
+	}
+	p = _mem(u32Addr);
+	if (!p)
+	{
+		sSim.sStats.u32BadAccess++;
+		return;
+	}
+	if (u32Addr - IRQ_CTRL_STATUS0_Addr < 8)
+	{
+		*p &= ~u8Val;
+	}
+	else
+	{
+		*p = u8Val;
+	}
+}
+
+static uint32_t _rd32(uint32_t u32Addr)
+{
+	uint32_t u32Val = 0;
+	uint8_t *p = _mem(u32Addr);
+	if (p)
+	{
+		memcpy(&u32Val, p, sizeof(u32Val));
+	}
+	return u32Val;
+}
+
+static void _wr32(uint32_t u32Addr, uint32_t u32Val)
+{
+	uint8_t *p = _mem(u32Addr);
+	if (p)
+	{
+		memcpy(p, &u32Val, sizeof(u32Val));
+	}
+}
+
+static uint32_t _field(uint32_t u32Addr, uint32_t u32Msk, uint8_t u8Pos)
+{
+	return (_rd32(u32Addr) & u32Msk) >> u8Pos;
+}
+
+/*!
+ * @static
+ * @brief Get the address of one memory pointer
+ *
+ * @param [in] u8Id Pointer id (see adf7030_1_spi_pntr_t)
+ *
+ * @return The pointer address
+ */
+static uint32_t _pntr(uint8_t u8Id)
+{
+	switch (u8Id)
+	{
+		case PNTR_SETUP_ADDR:    return SPI_HOST_BASE;
+		case PNTR_SRAM_ADDR:     return SIM_SRAM_BASE;
+		case PNTR_MCR_LOW:       return MCR_BASE;
+		case PNTR_MCR_HIGH:      return SIM_MCR_HIGH;
+		case PNTR_IRQ_CTRL_ADDR: return IRQ_CTRL_BASE;
+		default:                 return _rd32(SPI_HOST_BASE + 4*(u8Id - PNTR_CUSTOM0_ADDR));
+	}
+}
+
+/*!
+ * @static
+ * @brief Set the memory to its after boot content
+ *
+ * @param [in] bKeepSram Keep the SRAM content (warm wake-up)
+ *
+ */
+static void _mem_boot(uint8_t bKeepSram)
+{
+	if (!bKeepSram)
+	{
+		memset(sSim.aSram, 0, sizeof(sSim.aSram));
+		_wr32(GENERIC_PKT_BUFF_CFG0_Addr, 0x2BCUL | (0x2BCUL << 11));
+		_wr32(PROFILE_CCA_READBACK_Addr, PROFILE_CCA_READBACK_Rst);
+	}
+	memset(sSim.aPeriph, 0, sizeof(sSim.aPeriph));
+	_wr32(SPI_HOST_BASE + 0, SIM_SRAM_BASE);
+	_wr32(SPI_HOST_BASE + 4, SIM_SRAM_BASE);
+	_wr32(SPI_HOST_BASE + 8, SIM_SRAM_BASE);
+}
+
+/******************************************************************************/
+/* Interrupt lines                                                            */
+/******************************************************************************/
+
+/*!
+ * @static
+ * @brief Get the effective interrupt mask of one line
+ *
+ * @details Bits 0 to 7 (frame events) come from GENERIC_PKT_FRAME_CFG1, others
+ * from IRQ_CTRL MASK0/1.
+ *
+ * @param [in] u8Pin PHY interrupt line
+ *
+ * @return The mask
+ */
+static uint32_t _irq_mask(uint8_t u8Pin)
+{
+	uint32_t u32Frm = _rd32(GENERIC_PKT_FRAME_CFG1_Addr) >> ((u8Pin)?(24):(16));
+	uint32_t u32Msk = _rd32(IRQ_CTRL_BASE + 4*u8Pin) & 0xFFFFFF00UL;
+	return u32Msk | (u32Frm & 0xFF);
+}
+
+/*!
+ * @static
+ * @brief Update the interrupt lines level, call the call-back on rising edge
+ *
+ */
+static void _irq_update(void)
+{
+	uint8_t u8Pin;
+	uint8_t bLevel;
+	for (u8Pin = 0; u8Pin < 2; u8Pin++)
+	{
+		bLevel = (sSim.bAwake &&
+				(_rd32(IRQ_CTRL_STATUS0_Addr + 4*u8Pin) & _irq_mask(u8Pin)))?(1):(0);
+		if (bLevel && !sSim.bLine[u8Pin])
+		{
+			sSim.bLine[u8Pin] = 1;
+			sSim.sStats.u32Irq++;
+			if (sSim.pfIrqCb)
+			{
+				sSim.pfIrqCb(u8Pin);
+			}
+		}
+		sSim.bLine[u8Pin] = bLevel;
+	}
+}
+
+/*!
+ * @static
+ * @brief Raise interrupt sources
+ *
+ * @param [in] u32Src Interrupt sources bit field (see adf7030_1_irq_src_e)
+ *
+ */
+static void _irq_raise(uint32_t u32Src)
+{
+	uint8_t u8Pin;
+	uint32_t u32Addr;
+	for (u8Pin = 0; u8Pin < 2; u8Pin++)
+	{
+		u32Addr = IRQ_CTRL_STATUS0_Addr + 4*u8Pin;
+		_wr32(u32Addr, _rd32(u32Addr) | (u32Src & _irq_mask(u8Pin)));
+	}
+	_irq_update();
+}
+
+/******************************************************************************/
+/* State machine                                                              */
+/******************************************************************************/
+
+/*!
+ * @static
+ * @brief Get the time from one state to another
+ *
+ * @param [in] eFrom Current state
+ * @param [in] eTo   Target state
+ *
+ * @return The transition time (ns)
+ */
+static uint32_t _trans_time(uint8_t eFrom, uint8_t eTo)
+{
+	const adf7030_1_sim_timing_t *t = &sSim.sTiming;
+	uint32_t u32Up = (eFrom == PHY_OFF)?(t->u32OffToOn):(0);
+	switch (eTo)
+	{
+		case PHY_SLEEP: return t->u32Sleep;
+		case CFG_DEV:   return t->u32CfgDev;
+		case DO_CAL:    return u32Up + t->u32Cal;
+		case PHY_TX:    return u32Up + t->u32OnToTx;
+		case PHY_RX:    return u32Up + t->u32OnToRx;
+		case CCA:       return u32Up + t->u32OnToCca;
+		case PHY_OFF:   return (eFrom == PHY_OFF)?(0):(t->u32OnToOff);
+		case PHY_ON:    return (eFrom == PHY_OFF)?(t->u32OffToOn):(t->u32ToOn);
+		default:        return t->u32ToOn;
+	}
+}
+
+/*!
+ * @static
+ * @brief Start a transition
+ *
+ * @details During the transition, MISC_FW CURR_STATE already gives the target
+ * state and FW_STATUS is TRANSITION (CMD_READY low).
+ *
+ * @param [in] eTo    Target state
+ * @param [in] u32Ns  Transition time
+ *
+ */
+static void _goto(uint8_t eTo, uint32_t u32Ns)
+{
+	sSim.eState = eTo;
+	sSim.eTrans = SIM_TRANSITION;
+	sSim.u64TransEnd = sSim.u64Now + u32Ns;
+	sSim.eFrmStep = SIM_FRM_NONE;
+	sSim.u64FrmNext = SIM_NO_EVENT;
+}
+
+/*!
+ * @static
+ * @brief Get the air time of some bits
+ *
+ * @param [in] u32Bits Number of bits
+ *
+ * @return The time (ns)
+ */
+static uint64_t _air(uint32_t u32Bits)
+{
+	return ((uint64_t)u32Bits * 1000000000ULL) / sSim.u32AirRate;
+}
+
+static uint32_t _preamble_bits(void)
+{
+	return 8 * _field(GENERIC_PKT_FRAME_CFG0_Addr,
+			GENERIC_PKT_FRAME_CFG0_PREAMBLE_LEN_Msk, GENERIC_PKT_FRAME_CFG0_PREAMBLE_LEN_Pos);
+}
+
+static uint32_t _sync_bits(void)
+{
+	return _field(GENERIC_PKT_FRAME_CFG0_Addr,
+			GENERIC_PKT_FRAME_CFG0_SYNC0_LEN_Msk, GENERIC_PKT_FRAME_CFG0_SYNC0_LEN_Pos);
+}
+
+static uint32_t _tail_bits(uint32_t u32Len)
+{
+	return 8 * u32Len + _field(GENERIC_PKT_FRAME_CFG0_Addr,
+			GENERIC_PKT_FRAME_CFG0_CRC_LEN_Msk, GENERIC_PKT_FRAME_CFG0_CRC_LEN_Pos);
+}
+
+/*!
+ * @static
+ * @brief Get the AFC frequency error of a received frame
+ *
+ * @return The raw AFC read-back value (received carrier minus local oscillator)
+ */
+static uint32_t _afc_err(void)
+{
+	int64_t i64Err;
+	if (sSim.u32Carrier == 0)
+	{
+		return 0;
+	}
+	i64Err = (int64_t)sSim.u32Carrier - (int64_t)_rd32(PROFILE_CH_FREQ_Addr) - sSim.i32LoErr;
+	// 26000000 / 4194304 Hz unit, 16 bits
+	return (uint16_t)(int16_t)((i64Err * 32768) / 203125);
+}
+
+/*!
+ * @static
+ * @brief Back to PHY_ON after a frame (end of TX or RX)
+ *
+ */
+static void _frame_end(void)
+{
+	sSim.eFrmStep = SIM_FRM_NONE;
+	sSim.u64FrmNext = SIM_NO_EVENT;
+	_goto(PHY_ON, sSim.sTiming.u32ToOn);
+}
+
+/*!
+ * @static
+ * @brief Process the current frame event, schedule the next one
+ *
+ */
+static void _frame_event(void)
+{
+	sim_rx_frame_t *pFrm = &sSim.aRxQueue[sSim.u8RxHead];
+	uint32_t u32Len;
+	uint32_t u32Addr;
+	uint32_t i;
+
+	switch (sSim.eFrmStep)
+	{
+		case SIM_FRM_PREAMBLE:
+			_irq_raise(1UL << PREAMBLE_IRQn);
+			sSim.eFrmStep = SIM_FRM_SYNC;
+			sSim.u64FrmNext = sSim.u64Now + _air(_preamble_bits() + _sync_bits());
+			break;
+		case SIM_FRM_SYNC:
+			_irq_raise(1UL << SYNCWORD_IRQn);
+			if (sSim.bFrmRx)
+			{
+				u32Len = pFrm->u8Len;
+				_wr32(AFC_FREQUENCY_ERROR_READBACK_Addr, _afc_err());
+			}
+			else
+			{
+				u32Len = _field(GENERIC_PKT_FRAME_CFG1_Addr,
+					GENERIC_PKT_FRAME_CFG1_PAYLOAD_SIZE_Msk, GENERIC_PKT_FRAME_CFG1_PAYLOAD_SIZE_Pos);
+			}
+			sSim.eFrmStep = SIM_FRM_EOF;
+			sSim.u64FrmNext = sSim.u64Now + _air(_tail_bits(u32Len));
+			break;
+		case SIM_FRM_EOF:
+			if (sSim.bFrmRx)
+			{
+				u32Addr = SIM_SRAM_BASE + 4*_field(GENERIC_PKT_BUFF_CFG0_Addr,
+					GENERIC_PKT_BUFF_CFG0_PTR_RX_BASE_Msk, GENERIC_PKT_BUFF_CFG0_PTR_RX_BASE_Pos);
+				for (i = 0; i < pFrm->u8Len; i++)
+				{
+					_wr8(u32Addr + i, pFrm->aData[i]);
+				}
+				_wr32(GENERIC_PKT_FRAME_CFG3_Addr,
+					(_rd32(GENERIC_PKT_FRAME_CFG3_Addr) & ~GENERIC_PKT_FRAME_CFG3_RX_LENGTH_Msk) |
+					((uint32_t)pFrm->u8Len << GENERIC_PKT_FRAME_CFG3_RX_LENGTH_Pos) );
+				_wr32(GENERIC_PKT_LIVE_LINK_QUAL_Addr,
+					(_rd32(GENERIC_PKT_LIVE_LINK_QUAL_Addr) & ~GENERIC_PKT_LIVE_LINK_QUAL_RSSI_Msk) |
+					(((uint32_t)pFrm->u16Rssi << GENERIC_PKT_LIVE_LINK_QUAL_RSSI_Pos) & GENERIC_PKT_LIVE_LINK_QUAL_RSSI_Msk) );
+				sSim.u8RxHead = (sSim.u8RxHead + 1) % ADF7030_1_SIM_RX_QUEUE_SZ;
+				sSim.u8RxCount--;
+			}
+			_frame_end();
+			_irq_raise(1UL << EOF_IRQn);
+			break;
+		default:
+			sSim.u64FrmNext = SIM_NO_EVENT;
+			break;
+	}
+}
+
+/*!
+ * @static
+ * @brief Get the noise level of a channel
+ *
+ * @param [in] u32Freq The channel frequency (Hz)
+ *
+ * @return The raw noise level (the default one if the frequency has none)
+ */
+static uint16_t _noise(uint32_t u32Freq)
+{
+	uint8_t i;
+	for (i = 0; i < ADF7030_1_SIM_CH_NOISE_SZ; i++)
+	{
+		if (sSim.aChNoiseFreq[i] == u32Freq)
+		{
+			return sSim.aChNoise[i];
+		}
+	}
+	return sSim.u16Noise;
+}
+
+/*!
+ * @static
+ * @brief End of the current transition
+ *
+ */
+static void _trans_done(void)
+{
+	uint32_t u32Val;
+
+	sSim.u64TransEnd = SIM_NO_EVENT;
+	sSim.bAwake = 1;
+	sSim.eTrans = SIM_STATE;
+
+	switch (sSim.eState)
+	{
+		case PHY_SLEEP:
+			sSim.bAwake = 0;
+			sSim.bLine[0] = 0;
+			sSim.bLine[1] = 0;
+			return;
+		case CFG_DEV:
+			sSim.eState = PHY_OFF;
+			sSim.eTrans = SIM_IDLE;
+			break;
+		case DO_CAL:
+			u32Val = _rd32(PROFILE_RADIO_CAL_CFG1_Addr);
+			_wr32(PROFILE_RADIO_CAL_CFG1_Addr, u32Val | PROFILE_RADIO_CAL_CFG1_CAL_SUCCESS_Msk);
+			sSim.eState = PHY_ON;
+			sSim.eTrans = SIM_IDLE;
+			break;
+		case PHY_OFF:
+		case PHY_ON:
+			sSim.eTrans = SIM_IDLE;
+			break;
+		case PHY_TX:
+			sSim.bFrmRx = 0;
+			sSim.eFrmStep = SIM_FRM_PREAMBLE;
+			sSim.u64FrmNext = sSim.u64Now;
+			break;
+		case PHY_RX:
+			if (sSim.u8RxCount)
+			{
+				sSim.bFrmRx = 1;
+				sSim.eFrmStep = SIM_FRM_PREAMBLE;
+				sSim.u64FrmNext = sSim.u64Now + 1000ULL*sSim.aRxQueue[sSim.u8RxHead].u32DelayUs;
+			}
+			break;
+		case CCA:
+			u32Val = _rd32(PROFILE_CCA_READBACK_Addr) & ~(PROFILE_CCA_READBACK_VALUE_Msk | PROFILE_CCA_READBACK_LIVE_STATUS_Msk);
+			u32Val |= ((uint32_t)_noise(_rd32(PROFILE_CH_FREQ_Addr)) << PROFILE_CCA_READBACK_VALUE_Pos) & PROFILE_CCA_READBACK_VALUE_Msk;
+			_wr32(PROFILE_CCA_READBACK_Addr, u32Val);
+			break;
+		case MON:
+			u32Val = _rd32(PROFILE_MONITOR1_Addr) & ~PROFILE_MONITOR1_TEMP_OUTPUT_Msk;
+			u32Val |= ((uint32_t)sSim.i16Temp << PROFILE_MONITOR1_TEMP_OUTPUT_Pos) & PROFILE_MONITOR1_TEMP_OUTPUT_Msk;
+			_wr32(PROFILE_MONITOR1_Addr, u32Val);
+			break;
+		default:
+			break;
+	}
+	_irq_raise( (1UL << SM_READY_IRQn) | ((sSim.eTrans == SIM_IDLE)?(1UL << SM_IDLE_IRQn):(0)) );
+}
+
+/*!
+ * @static
+ * @brief Start the boot sequence (reset, power-up or wake-up)
+ *
+ * @param [in] bWarm Wake-up with SRAM retention
+ *
+ */
+static void _boot(uint8_t bWarm)
+{
+	_mem_boot(bWarm);
+	sSim.u8TrigEn = 0;
+	sSim.bAwake = 0;
+	sSim.bLine[0] = 0;
+	sSim.bLine[1] = 0;
+	_goto(PHY_OFF, (bWarm)?(sSim.sTiming.u32WarmWakeup):(sSim.sTiming.u32Boot));
+}
+
+/*!
+ * @static
+ * @brief Hold the PHY (reset asserted or no power)
+ *
+ */
+static void _halt(void)
+{
+	sSim.bAwake = 0;
+	sSim.bLine[0] = 0;
+	sSim.bLine[1] = 0;
+	sSim.eState = PHY_SLEEP;
+	sSim.eTrans = SIM_IDLE;
+	sSim.u64TransEnd = SIM_NO_EVENT;
+	sSim.eFrmStep = SIM_FRM_NONE;
+	sSim.u64FrmNext = SIM_NO_EVENT;
+}
+
+/*!
+ * @static
+ * @brief Check if the PHY is sleeping (waiting for a wake-up)
+ *
+ * @return 1 if sleeping, 0 otherwise
+ */
+static uint8_t _is_sleeping(void)
+{
+	return (sSim.bPower && sSim.bReset && !sSim.bAwake &&
+			sSim.eState == PHY_SLEEP && sSim.u64TransEnd == SIM_NO_EVENT);
+}
+
+/*!
+ * @static
+ * @brief Wake-up the PHY from PHY_SLEEP
+ *
+ */
+static void _wakeup(void)
+{
+	_boot( (_rd32(PROFILE_LPM_CFG0_Addr) & PROFILE_LPM_CFG0_RETAIN_SRAM_Msk)?(1):(0) );
+}
+
+/*!
+ * @static
+ * @brief CRC of one memory area, MSB first
+ *
+ * @param [in] u32Crc  Initial value
+ * @param [in] pData   The data
+ * @param [in] u32Len  The data length
+ * @param [in] u32Poly The polynomial
+ * @param [in] u8Len   The polynomial length (1 to 32 bits)
+ *
+ * @return The CRC
+ */
+static uint32_t _crc(uint32_t u32Crc, const uint8_t *pData, uint32_t u32Len, uint32_t u32Poly, uint8_t u8Len)
+{
+	uint32_t u32Top = 1UL << (u8Len - 1);
+	uint32_t u32Msk = (u32Top << 1) - 1;
+	uint32_t i;
+	uint8_t u8Bit;
+
+	for (i = 0; i < u32Len; i++)
+	{
+		for (u8Bit = 0x80; u8Bit; u8Bit >>= 1)
+		{
+			uint8_t bXor = ((u32Crc & u32Top)?(1):(0)) ^ ((pData[i] & u8Bit)?(1):(0));
+			u32Crc = (u32Crc << 1) & u32Msk;
+			if (bXor)
+			{
+				u32Crc ^= u32Poly & u32Msk;
+			}
+		}
+	}
+	return u32Crc;
+}
+
+/*!
+ * @static
+ * @brief Run the patch selfcheck, if enabled
+ *
+ * @details The selfcheck is enabled by its setup sequence in
+ * SM_DATA_CALIBRATION. The CRC of the descriptor sections is written in
+ * crc_output and, when it is equal to GoldenCRC and inject_ok is set, the
+ * inject sequence replaces the setup one. The CRC type and bit order are not
+ * modelled (see adf7030_1_Sim_Crc).
+ *
+ */
+static void _selfcheck(void)
+{
+	uint32_t u32Info = sSim.u32ChkInfo;
+	uint32_t u32Crc, u32Addr;
+	uint16_t u16Cfg, u16Size;
+	uint8_t u8Len, u8Nb, i;
+
+	if (!u32Info || _rd32(SM_DATA_CALIBRATION_Addr) != BRAM_BASE + sSim.u16ChkSeq)
+	{
+		return;
+	}
+	u16Cfg = _rd8(u32Info + SIM_CHK_CFG_OFFSET) | (_rd8(u32Info + SIM_CHK_CFG_OFFSET + 1) << 8);
+	if ( !(u16Cfg & SIM_CRC_ENABLE_Msk) )
+	{
+		return;
+	}
+	u8Len = (u16Cfg & SIM_CRC_LEN_Msk) >> SIM_CRC_LEN_Pos;
+	u8Len = (u8Len == 0 || u8Len > 32)?(32):(u8Len);
+	u8Nb = _rd8(u32Info + SIM_CHK_NB_OFFSET);
+	u32Crc = _rd32(u32Info + SIM_CHK_SEED_OFFSET);
+	for (i = 0; i < u8Nb; i++)
+	{
+		u16Size = _rd8(u32Info + SIM_CHK_SECT_OFFSET + 4*i) | (_rd8(u32Info + SIM_CHK_SECT_OFFSET + 4*i + 1) << 8);
+		u32Addr = SIM_SRAM_BASE + (_rd8(u32Info + SIM_CHK_SECT_OFFSET + 4*i + 2) | (_rd8(u32Info + SIM_CHK_SECT_OFFSET + 4*i + 3) << 8));
+		if (u32Addr + u16Size > SIM_SRAM_BASE + SIM_SRAM_SZ)
+		{
+			sSim.sStats.u32BadAccess++;
+			return;
+		}
+		u32Crc = _crc(u32Crc, _mem(u32Addr), u16Size, _rd32(u32Info + SIM_CHK_POLY_OFFSET), u8Len);
+	}
+	_wr32(u32Info + SIM_CHK_OUTPUT_OFFSET, u32Crc);
+	if ( (u16Cfg & SIM_CRC_INJECT_OK_Msk) && (u32Crc == _rd32(u32Info + SIM_CHK_GOLDEN_OFFSET)) )
+	{
+		_wr32(SM_DATA_CALIBRATION_Addr, BRAM_BASE + sSim.u16InjectSeq);
+	}
+}
+
+/*!
+ * @static
+ * @brief Execute a radio command
+ *
+ * @param [in] u8Cmd The command byte
+ *
+ */
+static void _command(uint8_t u8Cmd)
+{
+	uint8_t eTo;
+
+	sSim.sStats.u32Cmd++;
+	if (u8Cmd == CMD_RESET)
+	{
+		_boot(0);
+		return;
+	}
+	if (sSim.eTrans == SIM_TRANSITION)
+	{
+		sSim.sStats.u32CmdLost++;
+		return;
+	}
+	if ((u8Cmd & 0xC0) != RADIO_CMD)
+	{
+		// Special commands : only the trigger enable is modelled
+		if ( ((u8Cmd & 0x3F) & ~0x3) == TRIGPIN_NONE )
+		{
+			sSim.u8TrigEn = u8Cmd & 0x3;
+		}
+		return;
+	}
+	_selfcheck();
+	eTo = u8Cmd & 0x3F;
+	_goto(eTo, _trans_time(sSim.eState, eTo));
+}
+
+/******************************************************************************/
+/* SPI frame decoding                                                         */
+/******************************************************************************/
+
+/*!
+ * @static
+ * @brief Get the SPI status byte
+ *
+ * @return The status byte
+ */
+static uint8_t _status(void)
+{
+	uint8_t u8Status;
+	if (!sSim.bAwake)
+	{
+		return 0;
+	}
+	u8Status = SPI_HOST_STATUS_SPIS_READY_Msk | SPI_HOST_STATUS_MEM_ACC_STATUS_Msk;
+	u8Status |= (sSim.eTrans << SPI_HOST_STATUS_FW_STATUS_Pos) & SPI_HOST_STATUS_FW_STATUS_Msk;
+	if (sSim.eTrans != SIM_TRANSITION)
+	{
+		u8Status |= SPI_HOST_STATUS_CMD_READY_Msk;
+	}
+	if (sSim.bLine[0] || sSim.bLine[1])
+	{
+		u8Status |= SPI_HOST_STATUS_EXT_IRQ_STATUS_Msk;
+	}
+	return u8Status;
+}
+
+/*!
+ * @static
+ * @brief Decode and execute one memory access frame
+ *
+ * @param [in]  pTx      Frame sent by the host
+ * @param [out] pRx      Frame received by the host
+ * @param [in]  u32Len   Frame length
+ *
+ */
+static void _mem_access(const uint8_t *pTx, uint8_t *pRx, uint32_t u32Len)
+{
+	uint8_t u8Cmd = pTx[0];
+	uint8_t bRead = (u8Cmd & ADF703x_SPI_MEM_READ)?(1):(0);
+	uint8_t bBlock = (u8Cmd & ADF703x_SPI_MEM_BLOCK)?(1):(0);
+	uint8_t bAddr = (u8Cmd & ADF703x_SPI_MEM_ADDRESS)?(1):(0);
+	uint8_t bLong = (u8Cmd & ADF703x_SPI_MEM_LONG)?(1):(0);
+	uint32_t u32Pntr = _pntr(u8Cmd & 0x07);
+	uint32_t u32Unit = (bLong)?(4):(1);
+	uint32_t u32ALen = (bAddr)?(u32Unit):(0);
+	uint32_t u32Dummy = (bRead)?((bLong)?(2):(1)):(0);
+	uint32_t u32Pos = 1;
+	uint32_t u32Addr;
+	uint32_t i;
+
+	if (!bBlock && !bAddr)
+	{
+		// Random access needs an address per data
+		sSim.sStats.u32BadAccess++;
+		return;
+	}
+
+	do
+	{
+		// Address phase
+		if (u32Pos + u32ALen > u32Len)
+		{
+			break;
+		}
+		if (!bAddr)
+		{
+			u32Addr = u32Pntr;
+		}
+		else if (bLong)
+		{
+			u32Addr = ((uint32_t)pTx[u32Pos] << 24) | ((uint32_t)pTx[u32Pos+1] << 16) |
+					  ((uint32_t)pTx[u32Pos+2] << 8) | pTx[u32Pos+3];
+		}
+		else
+		{
+			u32Addr = u32Pntr + pTx[u32Pos];
+		}
+		u32Pos += u32ALen;
+
+		if (bRead && !bBlock)
+		{
+			// Random read : all the addresses, then all the data
+			uint32_t u32NbAddr = (u32Len - 1 - u32Dummy) / (u32ALen + u32Unit);
+			uint32_t u32Data = 1 + u32NbAddr * u32ALen + u32Dummy;
+			uint32_t j;
+			for (j = 0; j < u32NbAddr; j++)
+			{
+				const uint8_t *pA = &pTx[1 + j*u32ALen];
+				u32Addr = (bLong)?(((uint32_t)pA[0] << 24) | ((uint32_t)pA[1] << 16) | ((uint32_t)pA[2] << 8) | pA[3]):(u32Pntr + pA[0]);
+				for (i = 0; i < u32Unit; i++)
+				{
+					// Words are big-endian on the wire
+					pRx[u32Data + j*u32Unit + i] = _rd8(u32Addr + ((bLong)?(3 - i):(0)));
+				}
+				sSim.sStats.u32MemRd += u32Unit;
+			}
+			return;
+		}
+
+		u32Pos += u32Dummy;
+		if (bRead)
+		{
+			if (u32Addr == MISC_FW_Addr || u32Addr == MISC_FW_Addr + 1)
+			{
+				sSim.sStats.u32Poll++;
+			}
+			// Block read : sequential data up to the end of frame
+			for (i = 0; u32Pos < u32Len; u32Pos++, i++)
+			{
+				pRx[u32Pos] = _rd8( (bLong)?((u32Addr + i) ^ 3):(u32Addr + i) );
+			}
+			sSim.sStats.u32MemRd += i;
+			return;
+		}
+
+		// Write
+		if (bBlock)
+		{
+			for (i = 0; u32Pos < u32Len; u32Pos++, i++)
+			{
+				_wr8( (bLong)?((u32Addr + i) ^ 3):(u32Addr + i), pTx[u32Pos]);
+			}
+			sSim.sStats.u32MemWr += i;
+			return;
+		}
+		// Random write : (address, data) pairs
+		if (u32Pos + u32Unit > u32Len)
+		{
+			break;
+		}
+		for (i = 0; i < u32Unit; i++)
+		{
+			_wr8( (bLong)?(u32Addr + 3 - i):(u32Addr), pTx[u32Pos + i]);
+		}
+		sSim.sStats.u32MemWr += u32Unit;
+		u32Pos += u32Unit;
+	} while (u32Pos < u32Len);
+}
+
+/******************************************************************************/
+/* Public API                                                                 */
+/******************************************************************************/
+
+/*!
+ * @brief Initialize the model (PHY not powered, no pending event)
+ *
+ */
+void adf7030_1_Sim_Init(void)
+{
+	memset(&sSim, 0, sizeof(sSim));
+	sSim.sTiming = sDefaultTiming;
+	sSim.u32AirRate = 2400;
+	sSim.bCS = 1;
+	sSim.bReset = 1;
+	sSim.u64HostTimer = SIM_NO_EVENT;
+	_halt();
+}
+
+/*!
+ * @brief Set (or cancel) the host timer (e.g. the host LPTIM), sharing the
+ *        modelled time
+ *
+ * @param [in] u64Ns  Delay from now (ns)
+ * @param [in] pfCb   The call-back called at the time (NULL : cancel)
+ *
+ */
+void adf7030_1_Sim_SetHostTimer(uint64_t u64Ns, pfSimTimerCb_t pfCb)
+{
+	sSim.pfHostTimerCb = pfCb;
+	sSim.u64HostTimer = (pfCb)?(sSim.u64Now + u64Ns):(SIM_NO_EVENT);
+}
+
+/*!
+ * @brief Set the model timing
+ *
+ * @param [in] pTiming Pointer on the timing to use (NULL to restore the default)
+ *
+ */
+void adf7030_1_Sim_SetTiming(const adf7030_1_sim_timing_t *pTiming)
+{
+	sSim.sTiming = (pTiming)?(*pTiming):(sDefaultTiming);
+}
+
+/*!
+ * @brief Set the call-back called on interrupt line rising edge
+ *
+ * @param [in] pfCb The call-back
+ *
+ */
+void adf7030_1_Sim_SetIrqCallback(pfSimIrqCb_t pfCb)
+{
+	sSim.pfIrqCb = pfCb;
+}
+
+/*!
+ * @brief Get the current modelled time
+ *
+ * @return The time (ns)
+ */
+uint64_t adf7030_1_Sim_Now(void)
+{
+	return sSim.u64Now;
+}
+
+/*!
+ * @brief Get the time of the next scheduled event
+ *
+ * @return The time (ns), UINT64_MAX if nothing is scheduled
+ */
+uint64_t adf7030_1_Sim_NextEvent(void)
+{
+	uint64_t u64Next = (sSim.u64TransEnd < sSim.u64FrmNext)?(sSim.u64TransEnd):(sSim.u64FrmNext);
+	return (sSim.u64HostTimer < u64Next)?(sSim.u64HostTimer):(u64Next);
+}
+
+/*!
+ * @static
+ * @brief Process all the events up to the given time
+ *
+ * @details Interrupt call-backs may be called from here, and may themselves
+ * exchange SPI frames (so advance the time).
+ *
+ * @param [in] u64Target The time to reach (ns)
+ *
+ */
+static void _process_until(uint64_t u64Target)
+{
+	uint64_t u64Next;
+	while ( (u64Next = adf7030_1_Sim_NextEvent()) <= u64Target )
+	{
+		if (u64Next > sSim.u64Now)
+		{
+			sSim.u64Now = u64Next;
+		}
+		if (sSim.u64HostTimer <= u64Next)
+		{
+			// Host timer first, as an interrupt taken at this time
+			sSim.u64HostTimer = SIM_NO_EVENT;
+			if (sSim.pfHostTimerCb)
+			{
+				sSim.pfHostTimerCb();
+			}
+		}
+		else if (sSim.u64TransEnd <= u64Next)
+		{
+			_trans_done();
+		}
+		else
+		{
+			_frame_event();
+		}
+	}
+	if (u64Target > sSim.u64Now)
+	{
+		sSim.u64Now = u64Target;
+	}
+}
+
+/*!
+ * @brief Advance the modelled time
+ *
+ * @param [in] u64Ns Time to advance (ns)
+ *
+ */
+void adf7030_1_Sim_Advance(uint64_t u64Ns)
+{
+	_process_until(sSim.u64Now + u64Ns);
+}
+
+/*!
+ * @brief Exchange one SPI frame (chip select low to high)
+ *
+ * @param [in]  pTx        Frame sent by the host
+ * @param [out] pRx        Frame received by the host (could be NULL)
+ * @param [in]  u32Len     Frame length
+ * @param [in]  u32Bitrate SPI bit rate (bit/s)
+ *
+ */
+void adf7030_1_Sim_Xfer(const uint8_t *pTx, uint8_t *pRx, uint32_t u32Len, uint32_t u32Bitrate)
+{
+	uint8_t aDummy[ADF7030_1_SPI_BUFFER_SIZE];
+	uint64_t u64Spi;
+	uint8_t u8Status;
+	uint8_t u8Cmd;
+
+	if (!u32Len || !pTx)
+	{
+		return;
+	}
+	if (!pRx || u32Len > sizeof(aDummy))
+	{
+		pRx = aDummy;
+		u32Len = (u32Len > sizeof(aDummy))?(sizeof(aDummy)):(u32Len);
+	}
+
+	sSim.sStats.u32Xfer++;
+	sSim.sStats.u32Byte += u32Len;
+
+	if (_is_sleeping())
+	{
+		// CS low wake-up the PHY
+		_wakeup();
+	}
+	if (!sSim.bAwake && sSim.u64TransEnd != SIM_NO_EVENT)
+	{
+		// The SPI slave is held until the boot end (MISO low, SPIS_READY not set)
+		sSim.sStats.u64HoldTime += sSim.u64TransEnd - sSim.u64Now;
+		_process_until(sSim.u64TransEnd);
+	}
+
+	u8Status = _status();
+	memset(pRx, u8Status, u32Len);
+	u8Cmd = pTx[0];
+
+	if (!sSim.bAwake)
+	{
+		sSim.sStats.u32BadAccess++;
+	}
+	else if (u8Cmd == CMD_NOP)
+	{
+		sSim.sStats.u32Poll++;
+	}
+	else if (u8Cmd & RADIO_CMD)
+	{
+		_command(u8Cmd);
+	}
+	else
+	{
+		_mem_access(pTx, pRx, u32Len);
+		_irq_update();
+	}
+
+	u64Spi = sSim.sTiming.u32SpiOverhead;
+	if (u32Bitrate)
+	{
+		u64Spi += ((uint64_t)u32Len * 8ULL * 1000000000ULL) / u32Bitrate;
+	}
+	sSim.sStats.u64SpiTime += u64Spi;
+	_process_until(sSim.u64Now + u64Spi);
+}
+
+/*!
+ * @brief Account one host SPI bitrate change
+ *
+ * @details The SPI bus is not used during the reconfiguration.
+ *
+ */
+void adf7030_1_Sim_SpiConfig(void)
+{
+	sSim.sStats.u32SpiConfig++;
+	sSim.sStats.u64SpiTime += sSim.sTiming.u32SpiConfig;
+	_process_until(sSim.u64Now + sSim.sTiming.u32SpiConfig);
+}
+
+/*!
+ * @brief Set the chip select level
+ *
+ * @details A falling edge wake-up the PHY from PHY_SLEEP.
+ *
+ * @param [in] bLevel The level
+ *
+ */
+void adf7030_1_Sim_SetCS(uint8_t bLevel)
+{
+	bLevel = (bLevel)?(1):(0);
+	if (sSim.bCS && !bLevel && _is_sleeping())
+	{
+		_wakeup();
+	}
+	sSim.bCS = bLevel;
+}
+
+/*!
+ * @brief Set the reset pin level
+ *
+ * @param [in] bLevel The level (0 : reset asserted)
+ *
+ */
+void adf7030_1_Sim_SetReset(uint8_t bLevel)
+{
+	bLevel = (bLevel)?(1):(0);
+	if (!bLevel)
+	{
+		_halt();
+	}
+	else if (!sSim.bReset && sSim.bPower)
+	{
+		_boot(0);
+	}
+	sSim.bReset = bLevel;
+}
+
+/*!
+ * @brief Set one trigger input level (the rising edge executes the radio
+ *        command written in SM_CONFIG GPIO_CMD, if the pin is enabled)
+ *
+ * @param [in] u8Pin  Trigger input (0 : TRIG_IN0, 1 : TRIG_IN1)
+ * @param [in] bLevel The level
+ *
+ */
+void adf7030_1_Sim_SetTrig(uint8_t u8Pin, uint8_t bLevel)
+{
+	u8Pin &= 0x1;
+	bLevel = (bLevel)?(1):(0);
+	if (bLevel && !sSim.bTrig[u8Pin] && sSim.bAwake && (sSim.u8TrigEn & (1 << u8Pin)) )
+	{
+		_command(_rd8(SM_CONFIG_GPIO_CMD_0_Addr + (u8Pin << 1)));
+	}
+	sSim.bTrig[u8Pin] = bLevel;
+}
+
+/*!
+ * @brief Set the power line
+ *
+ * @param [in] bOn 1 : powered, 0 : not powered
+ *
+ */
+void adf7030_1_Sim_SetPower(uint8_t bOn)
+{
+	bOn = (bOn)?(1):(0);
+	if (!bOn)
+	{
+		_halt();
+		memset(sSim.aSram, 0, sizeof(sSim.aSram));
+	}
+	else if (!sSim.bPower && sSim.bReset)
+	{
+		_boot(0);
+	}
+	sSim.bPower = bOn;
+}
+
+/*!
+ * @brief Set the air bit rate used to time the frames
+ *
+ * @param [in] u32Bps The bit rate (bit/s)
+ *
+ */
+void adf7030_1_Sim_SetAirRate(uint32_t u32Bps)
+{
+	sSim.u32AirRate = (u32Bps)?(u32Bps):(1);
+}
+
+/*!
+ * @brief Set the noise level returned by CCA
+ *
+ * @param [in] u16Noise The raw CCA read-back value
+ *
+ */
+void adf7030_1_Sim_SetNoise(uint16_t u16Noise)
+{
+	sSim.u16Noise = u16Noise;
+}
+
+/*!
+ * @brief Set the noise level returned by CCA on one channel frequency
+ *
+ * @param [in] u32Freq  The channel frequency (Hz, 0 : clear all the channels)
+ * @param [in] u16Noise The raw CCA read-back value
+ *
+ */
+void adf7030_1_Sim_SetChNoise(uint32_t u32Freq, uint16_t u16Noise)
+{
+	uint8_t i;
+	if (u32Freq == 0)
+	{
+		memset(sSim.aChNoiseFreq, 0, sizeof(sSim.aChNoiseFreq));
+		return;
+	}
+	for (i = 0; i < ADF7030_1_SIM_CH_NOISE_SZ; i++)
+	{
+		if ( (sSim.aChNoiseFreq[i] == u32Freq) || (sSim.aChNoiseFreq[i] == 0) )
+		{
+			sSim.aChNoiseFreq[i] = u32Freq;
+			sSim.aChNoise[i] = u16Noise;
+			return;
+		}
+	}
+}
+
+/*!
+ * @brief Set the received carrier and the local oscillator error, from which
+ *        the AFC frequency error of the received frames is computed
+ *
+ * @param [in] u32Carrier The received carrier frequency (Hz, 0 : no error)
+ * @param [in] i32LoErr   The local oscillator error (Hz, added to the channel frequency)
+ *
+ */
+void adf7030_1_Sim_SetAfc(uint32_t u32Carrier, int32_t i32LoErr)
+{
+	sSim.u32Carrier = u32Carrier;
+	sSim.i32LoErr = i32LoErr;
+}
+
+/*!
+ * @brief Set the temperature returned by MON
+ *
+ * @param [in] i16Temp The temperature (0.0625 degree Celsius unit)
+ *
+ */
+void adf7030_1_Sim_SetTemperature(int16_t i16Temp)
+{
+	sSim.i16Temp = i16Temp;
+}
+
+/*!
+ * @brief Set the patch selfcheck model
+ *
+ * @details These addresses come with the patch : the model has no code to
+ * execute, so it is told where the checksum descriptor is and which sequences
+ * select and inject the patch.
+ *
+ * @param [in] u32InfoAddr  Address of the checksum descriptor (0 : no selfcheck)
+ * @param [in] u16CheckSeq  Selfcheck setup sequence (see patch_desc_t::CheckSeq)
+ * @param [in] u16InjectSeq Inject sequence (see patch_desc_t::InjectSeq)
+ *
+ */
+void adf7030_1_Sim_SetSelfCheck(uint32_t u32InfoAddr, uint16_t u16CheckSeq, uint16_t u16InjectSeq)
+{
+	sSim.u32ChkInfo = u32InfoAddr;
+	sSim.u16ChkSeq = u16CheckSeq;
+	sSim.u16InjectSeq = u16InjectSeq;
+}
+
+/*!
+ * @brief Get the CRC computed by the selfcheck model
+ *
+ * @param [in] pData   The data
+ * @param [in] u32Len  The data length
+ * @param [in] u32Poly The polynomial
+ * @param [in] u32Seed The initial value
+ * @param [in] u8Len   The polynomial length (1 to 32 bits)
+ *
+ * @return The CRC
+ */
+uint32_t adf7030_1_Sim_Crc(const uint8_t *pData, uint32_t u32Len, uint32_t u32Poly, uint32_t u32Seed, uint8_t u8Len)
+{
+	return _crc(u32Seed, pData, u32Len, u32Poly, (u8Len == 0 || u8Len > 32)?(32):(u8Len));
+}
+
+/*!
+ * @brief Queue one frame to be received
+ *
+ * @param [in] u32DelayUs Delay between the PHY_RX entry and the frame preamble
+ * @param [in] pData      The payload
+ * @param [in] u8Len      The payload length
+ * @param [in] u16Rssi    The raw RSSI value
+ *
+ * @retval 0 Success
+ * @retval 1 Queue is full
+ */
+uint8_t adf7030_1_Sim_QueueRxFrame(uint32_t u32DelayUs, const uint8_t *pData, uint8_t u8Len, uint16_t u16Rssi)
+{
+	sim_rx_frame_t *pFrm;
+	if (sSim.u8RxCount >= ADF7030_1_SIM_RX_QUEUE_SZ || !pData)
+	{
+		return 1;
+	}
+	pFrm = &sSim.aRxQueue[(sSim.u8RxHead + sSim.u8RxCount) % ADF7030_1_SIM_RX_QUEUE_SZ];
+	pFrm->u32DelayUs = u32DelayUs;
+	pFrm->u16Rssi = u16Rssi;
+	pFrm->u8Len = u8Len;
+	memcpy(pFrm->aData, pData, u8Len);
+	sSim.u8RxCount++;
+	return 0;
+}
+
+/*!
+ * @brief Get the current (or target) PHY state
+ *
+ * @return The state (see adf7030_1_radio_state_e)
+ */
+uint8_t adf7030_1_Sim_GetState(void)
+{
+	return sSim.eState;
+}
+
+/*!
+ * @brief Read one word of the model memory (back-door, not counted)
+ *
+ * @param [in] u32Addr The address
+ *
+ * @return The word value
+ */
+uint32_t adf7030_1_Sim_ReadMem32(uint32_t u32Addr)
+{
+	return _rd32(u32Addr);
+}
+
+/*!
+ * @brief Get the counters
+ *
+ * @param [out] pStats Pointer on the counters
+ *
+ */
+void adf7030_1_Sim_GetStats(adf7030_1_sim_stats_t *pStats)
+{
+	if (pStats)
+	{
+		*pStats = sSim.sStats;
+		pStats->u64Time = sSim.u64Now - sSim.u64StatsStart;
+	}
+}
+
+/*!
+ * @brief Clear the counters
+ *
+ */
+void adf7030_1_Sim_ClrStats(void)
+{
+	memset(&sSim.sStats, 0, sizeof(sSim.sStats));
+	sSim.u64StatsStart = sSim.u64Now;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @} */
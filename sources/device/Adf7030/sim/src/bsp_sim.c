@@ -0,0 +1,497 @@
+/**
+  * @file bsp_sim.c
+  * @brief This file implement the BSP functions used by the PHY layer, on top
+  * of the ADF7030-1 model (host simulator)
+  *
+  * @details The SPI frames are exchanged with the model (chip select toggled
+  * as by the target BSP), the reset pin and the RF power line drive the model,
+  * and the model interrupt lines call the GPIO interrupt call-backs. Delays
+  * advance the modelled time.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup adf7030_sim
+ * @{
+ *
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+
+#include <bsp.h>
+#include <bsp_pwrlines.h>
+
+#include "bsp_sim.h"
+#include "adf7030-1_sim.h"
+
+/*!
+ * @brief GPIO interrupt line
+ */
+typedef struct {
+	pf_cb_t pfCb;
+	void *pCbParam;
+	uint8_t bEnable;
+	uint8_t eTrg;
+} sim_gpio_it_t;
+
+static uint8_t aGpioLevel[SIM_GPIO_NB_PIN];
+static sim_gpio_it_t aGpioIt[SIM_GPIO_NB_PIN];
+static uint16_t u16PwrLines;
+static uint32_t u32SpiBitrate = SIM_SPI_BITRATE_DEFAULT;
+
+/*!
+ * @brief The ADF7030-1 SPI device
+ */
+spi_dev_t spi_ADF7030 =
+{
+	.bus_id  = 0,
+	.ss_port = SIM_GPIO_PORT,
+	.ss_pin  = SIM_GPIO_SS_PIN
+};
+
+/*!
+ * @static
+ * @brief Model interrupt line rising edge
+ *
+ * @param [in] u8Pin PHY interrupt line (0 : IRQ_OUT0, 1 : IRQ_OUT1)
+ *
+ */
+static void _irq_cb(uint8_t u8Pin)
+{
+	uint16_t u16Pin = (u8Pin)?(SIM_GPIO_INT1_PIN):(SIM_GPIO_INT0_PIN);
+	sim_gpio_it_t *pIt = &aGpioIt[u16Pin];
+
+	if (pIt->bEnable && pIt->pfCb && (pIt->eTrg & GPIO_IRQ_RISING_EDGE))
+	{
+		pIt->pfCb(pIt->pCbParam, (void *)((uintptr_t)u16Pin));
+	}
+}
+
+/*!
+ * @brief Initialize the model and the simulated BSP
+ *
+ */
+void BSP_Sim_Init(void)
+{
+	memset(aGpioLevel, 0, sizeof(aGpioLevel));
+	memset(aGpioIt, 0, sizeof(aGpioIt));
+	aGpioLevel[SIM_GPIO_SS_PIN] = 1;
+	aGpioLevel[SIM_GPIO_RESET_PIN] = 1;
+	u16PwrLines = 0;
+	u32SpiBitrate = SIM_SPI_BITRATE_DEFAULT;
+	adf7030_1_Sim_Init();
+	adf7030_1_Sim_SetIrqCallback(_irq_cb);
+}
+
+/******************************************************************************/
+/* Delay                                                                      */
+/******************************************************************************/
+
+void msleep(uint32_t milisecond)
+{
+	adf7030_1_Sim_Advance(1000000ULL * milisecond);
+}
+
+void usleep(uint32_t microsecond)
+{
+	adf7030_1_Sim_Advance(1000ULL * microsecond);
+}
+
+/******************************************************************************/
+/* RTC (model time since start)                                               */
+/******************************************************************************/
+
+uint64_t BSP_Rtc_Time_GetEpochMs(void)
+{
+	return adf7030_1_Sim_Now() / 1000000ULL;
+}
+
+#ifdef HAS_HIRES_TIME_MEAS
+/******************************************************************************/
+/* High resolution timer (1 us, from the model time)                          */
+/******************************************************************************/
+
+static uint32_t aHiResCapture[4];
+
+int32_t HiResTime_EnDis(uint8_t bEnable)
+{
+	(void)bEnable;
+	return 0;
+}
+
+uint8_t HiResTime_IsEnabled(void)
+{
+	return 1;
+}
+
+uint32_t HiResTime_Now(void)
+{
+	return (uint32_t)(adf7030_1_Sim_Now() / 1000);
+}
+
+uint32_t HiResTime_Get(uint8_t id)
+{
+	return aHiResCapture[(id - 1) & 0x3];
+}
+
+void HiResTime_Capture(uint8_t id)
+{
+	aHiResCapture[(id - 1) & 0x3] = HiResTime_Now();
+}
+#endif
+
+/******************************************************************************/
+/* GPIO                                                                       */
+/******************************************************************************/
+
+uint8_t BSP_Gpio_InputEnable (const uint32_t u32Port, const uint16_t u16Pin, const uint8_t bFlag)
+{
+	(void)bFlag;
+	return (u32Port == SIM_GPIO_PORT && u16Pin < SIM_GPIO_NB_PIN)?(DEV_SUCCESS):(DEV_INVALID_PARAM);
+}
+
+uint8_t BSP_Gpio_OutputEnable(const uint32_t u32Port, const uint16_t u16Pin, const uint8_t bFlag)
+{
+	(void)bFlag;
+	return (u32Port == SIM_GPIO_PORT && u16Pin < SIM_GPIO_NB_PIN)?(DEV_SUCCESS):(DEV_INVALID_PARAM);
+}
+
+uint8_t BSP_Gpio_Get(const uint32_t u32Port, const uint16_t u16Pin, uint8_t *bLevel)
+{
+	if (u32Port != SIM_GPIO_PORT || u16Pin >= SIM_GPIO_NB_PIN || !bLevel)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	*bLevel = aGpioLevel[u16Pin];
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Gpio_Set(const uint32_t u32Port, const uint16_t u16Pin, uint8_t bLevel)
+{
+	if (u32Port != SIM_GPIO_PORT || u16Pin >= SIM_GPIO_NB_PIN)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	bLevel = (bLevel)?(1):(0);
+	aGpioLevel[u16Pin] = bLevel;
+	if (u16Pin == SIM_GPIO_SS_PIN)
+	{
+		adf7030_1_Sim_SetCS(bLevel);
+	}
+	else if (u16Pin == SIM_GPIO_RESET_PIN)
+	{
+		adf7030_1_Sim_SetReset(bLevel);
+	}
+	else if ( (u16Pin == SIM_GPIO_TRIG0_PIN) || (u16Pin == SIM_GPIO_TRIG1_PIN) )
+	{
+		adf7030_1_Sim_SetTrig(u16Pin - SIM_GPIO_TRIG0_PIN, bLevel);
+	}
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Gpio_SetLow (const uint32_t u32Port, const uint16_t u16Pin)
+{
+	return BSP_Gpio_Set(u32Port, u16Pin, 0);
+}
+
+uint8_t BSP_Gpio_SetHigh (const uint32_t u32Port, const uint16_t u16Pin)
+{
+	return BSP_Gpio_Set(u32Port, u16Pin, 1);
+}
+
+#ifdef USE_LPTIMER
+/******************************************************************************/
+/* LPTIM (one-shot, from the model time)                                      */
+/******************************************************************************/
+
+pfHandlerCB_t pfLptim1Event = NULL;
+pfHandlerCB_t pfLptim2Event = NULL;
+
+static void _lptim1_cb(void)
+{
+	if (pfLptim1Event)
+	{
+		pfLptim1Event();
+	}
+}
+
+static void _lptim2_cb(void)
+{
+	if (pfLptim2Event)
+	{
+		pfLptim2Event();
+	}
+}
+
+uint8_t BSP_LpTimer_Init(const uint8_t u8TimerId)
+{
+	(void)u8TimerId;
+	return DEV_SUCCESS;
+}
+
+uint32_t BSP_LpTimer_Start(const uint8_t u8TimerId, uint32_t u32Elapse)
+{
+	return BSP_LpTimer_StartUs(u8TimerId, 1000 * u32Elapse);
+}
+
+// Only one host timer in the model : both LPTIM share it
+uint32_t BSP_LpTimer_StartUs(const uint8_t u8TimerId, uint32_t u32Us)
+{
+	adf7030_1_Sim_SetHostTimer(1000ULL * u32Us, (u8TimerId)?(_lptim1_cb):(_lptim2_cb));
+	return u32Us;
+}
+
+uint32_t BSP_LpTimer_Stop(const uint8_t u8TimerId)
+{
+	(void)u8TimerId;
+	adf7030_1_Sim_SetHostTimer(0, NULL);
+	return 0;
+}
+
+void BSP_LpTimer_SetHandler (const uint8_t u8TimerId, pfHandlerCB_t const pfCb)
+{
+	if (u8TimerId)
+	{
+		pfLptim1Event = pfCb;
+	}
+	else
+	{
+		pfLptim2Event = pfCb;
+	}
+}
+#endif
+
+/******************************************************************************/
+/* GPIO interrupt                                                             */
+/******************************************************************************/
+
+int8_t BSP_GpioIt_GetLineId(const uint16_t u16Pin)
+{
+	return (u16Pin < SIM_GPIO_NB_PIN)?((int8_t)u16Pin):(-1);
+}
+
+uint8_t BSP_GpioIt_ConfigLine (const uint32_t u32Port, const uint16_t u16Pin, const gpio_irq_trg_cond_e ePol)
+{
+	if (u32Port != SIM_GPIO_PORT || u16Pin >= SIM_GPIO_NB_PIN)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	aGpioIt[u16Pin].eTrg = (uint8_t)ePol;
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_GpioIt_SetLine (const uint32_t u32Port, const uint16_t u16Pin, const bool bEnable)
+{
+	if (u32Port != SIM_GPIO_PORT || u16Pin >= SIM_GPIO_NB_PIN)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	aGpioIt[u16Pin].bEnable = (bEnable)?(1):(0);
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_GpioIt_SetCallback (const uint32_t u32Port, const uint16_t u16Pin, pf_cb_t const pfCb, void *const pCbParam )
+{
+	if (u32Port != SIM_GPIO_PORT || u16Pin >= SIM_GPIO_NB_PIN)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	aGpioIt[u16Pin].pfCb = pfCb;
+	aGpioIt[u16Pin].pCbParam = pCbParam;
+	return DEV_SUCCESS;
+}
+
+/******************************************************************************/
+/* Power lines                                                                */
+/******************************************************************************/
+
+void BSP_PwrLine_Init (void)
+{
+	u16PwrLines = 0;
+	adf7030_1_Sim_SetPower(0);
+}
+
+void BSP_PwrLine_Set (uint16_t u16Lines)
+{
+	u16PwrLines |= u16Lines;
+	if ((u16PwrLines & RF_EN_MSK) == RF_EN_MSK)
+	{
+		adf7030_1_Sim_SetPower(1);
+	}
+}
+
+void BSP_PwrLine_Clr (uint16_t u16Lines)
+{
+	u16PwrLines &= ~u16Lines;
+	if ((u16PwrLines & RF_EN_MSK) != RF_EN_MSK)
+	{
+		adf7030_1_Sim_SetPower(0);
+	}
+}
+
+uint16_t BSP_PwrLine_Get (uint16_t u16Lines)
+{
+	return u16PwrLines & u16Lines;
+}
+
+/******************************************************************************/
+/* Low power                                                                  */
+/******************************************************************************/
+
+static uint8_t u8StopInhibit;
+
+void BSP_LowPower_StopInhibit(uint8_t u8Src, uint8_t bInhibit)
+{
+	if (bInhibit)
+	{
+		u8StopInhibit |= u8Src;
+	}
+	else
+	{
+		u8StopInhibit &= ~u8Src;
+	}
+}
+
+uint8_t BSP_LowPower_IsStopInhibited(void)
+{
+	return u8StopInhibit;
+}
+
+/******************************************************************************/
+/* SPI                                                                        */
+/******************************************************************************/
+
+uint8_t BSP_Spi_Init(const p_spi_dev_t p_Device)
+{
+	// Single bus : the device could be not yet known (see Phy_adf7030_setup)
+	(void)p_Device;
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_SetDefault(const p_spi_dev_t p_Device)
+{
+	(void)p_Device;
+	u32SpiBitrate = SIM_SPI_BITRATE_DEFAULT;
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_Open(const p_spi_dev_t p_Device)
+{
+	// Single bus : the device could be not yet known (see Phy_adf7030_setup)
+	(void)p_Device;
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_Close (const p_spi_dev_t p_Device)
+{
+	// Single bus : the device could be not yet known (see Phy_adf7030_setup)
+	(void)p_Device;
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_SetBitrate (const p_spi_dev_t p_Device, const uint32_t u32_Hertz)
+{
+	(void)p_Device;
+	if (!u32_Hertz)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	// As on target, the bus is only reconfigured when the bitrate changes
+	if (u32_Hertz != u32SpiBitrate)
+	{
+		u32SpiBitrate = u32_Hertz;
+		adf7030_1_Sim_SpiConfig();
+	}
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_SetClockPhase (const p_spi_dev_t p_Device, const bool b_Flag)
+{
+	(void)p_Device;
+	(void)b_Flag;
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_SetClockPol (const p_spi_dev_t p_Device, const bool b_Flag)
+{
+	(void)p_Device;
+	(void)b_Flag;
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_ReadWrite (const p_spi_dev_t p_Device, spi_transceiver_s* const p_Xfr)
+{
+	if (!p_Device || !p_Xfr)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	BSP_Gpio_SetLow(p_Device->ss_port, p_Device->ss_pin);
+	adf7030_1_Sim_Xfer(p_Xfr->pTransmitter, p_Xfr->pReceiver, p_Xfr->ReceiverBytes, u32SpiBitrate);
+	BSP_Gpio_SetHigh(p_Device->ss_port, p_Device->ss_pin);
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_SetCallback (const p_spi_dev_t p_Device, pfEvtCb_t const pfEvtCb, void *pCbParam)
+{
+	if (!p_Device)
+	{
+		return DEV_INVALID_PARAM;
+	}
+	p_Device->pfEvent = pfEvtCb;
+	p_Device->pCbParam = pCbParam;
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_ReadWrite_DMA (const p_spi_dev_t p_Device, spi_transceiver_s* const p_Xfr)
+{
+	uint8_t eRet = BSP_Spi_ReadWrite(p_Device, p_Xfr);
+	// The transfer is already completed : notify as the DMA end interrupt would
+	if (eRet == DEV_SUCCESS && p_Device->pfEvent)
+	{
+		p_Device->pfEvent(p_Device->pCbParam, SPI_EVT_XFER_CPLT);
+	}
+	return eRet;
+}
+
+uint8_t BSP_Spi_Wait (const p_spi_dev_t p_Device, uint32_t u32Timeout)
+{
+	(void)p_Device;
+	(void)u32Timeout;
+	return DEV_SUCCESS;
+}
+
+uint8_t BSP_Spi_Abort (const p_spi_dev_t p_Device)
+{
+	(void)p_Device;
+	return DEV_SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @} */
@@ -0,0 +1,1055 @@
+/**
+  * @file phy_bench.c
+  * @brief This file implement the PHY layer host bench
+  *
+  * @details The unchanged PHY layer runs against the ADF7030-1 model. Each PHY
+  * operation is run in turn, and its SPI transactions, bytes and modelled time
+  * are printed as one CSV line, so that two driver versions can be compared
+  * without hardware.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup adf7030_sim
+ * @{
+ *
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "phy_layer_private.h"
+#include "adf7030-1_reg.h"
+#include "phy_trace.h"
+#include "phy_stats.h"
+#include "adf7030-1_phy_log.h"
+#include "adf7030-1__patch.h"
+#include "adf7030-1__state.h"
+
+#include "bsp_sim.h"
+#include "bsp_hires_time.h"
+#include "adf7030-1_sim.h"
+
+/*!
+ * @brief Maximum time (in us) to wait for a frame event
+ */
+#define BENCH_EVT_TMO_US 2000000
+
+/*!
+ * @brief Delay (in us) between the RX start and the injected frame
+ */
+#define BENCH_RX_DELAY_US 5000
+
+const adf7030_1_gpio_reset_info_t DEFAULT_GPIO_RESET =
+{
+	.u32Port = SIM_GPIO_PORT,
+	.u16Pin = SIM_GPIO_RESET_PIN
+};
+
+const adf7030_1_gpio_int_info_t DEFAULT_GPIO_INT[ADF7030_1_NUM_INT_PIN] =
+{
+	{
+		.u32Port = SIM_GPIO_PORT,
+		.u16Pin = SIM_GPIO_INT0_PIN,
+		.ePhyPin = ADF7030_1_GPIO3,
+	},
+	{
+		.u32Port = SIM_GPIO_PORT,
+		.u16Pin = SIM_GPIO_INT1_PIN,
+		.ePhyPin = ADF7030_1_GPIO5,
+	}
+};
+
+#if defined (USE_PHY_TRIG)
+const adf7030_1_gpio_trig_info_t DEFAULT_GPIO_TRIG[ADF7030_1_NUM_TRIG_PIN] =
+{
+	{
+		.u32Port = SIM_GPIO_PORT,
+		.u16Pin = SIM_GPIO_TRIG0_PIN,
+		.ePhyPin = ADF7030_1_GPIO2,
+		.nTrigCmd = PHY_TX,
+		.eTrigStatus = 0
+	},
+	{
+		.u32Port = SIM_GPIO_PORT,
+		.u16Pin = SIM_GPIO_TRIG1_PIN,
+		.ePhyPin = ADF7030_1_GPIO4,
+		.nTrigCmd = PHY_RX,
+		.eTrigStatus = 0
+	}
+};
+#endif
+
+static adf7030_1_device_t adf7030_1_ctx;
+static phydev_t sPhyDev;
+static volatile uint32_t u32LastEvt;
+static const char *pErrMsg; // last error message (ioctl argument, 32 bits address)
+
+static const uint32_t aAirRate[PHY_NB_MOD] = { 2400, 4800, 6400 };
+
+extern phy_power_t aPhyPower[PHY_NB_PWR];
+
+/*!
+ * @static
+ * @brief PHY event call-back (from the PHY service task)
+ *
+ */
+static void _evt_cb(void *p_CbParam, uint32_t evt)
+{
+	(void)p_CbParam;
+	u32LastEvt = evt;
+}
+
+/*!
+ * @static
+ * @brief Wait for a PHY event, letting the modelled time run
+ *
+ * @param [in] u32Evt The expected event
+ *
+ * @retval 0 The event occurred
+ * @retval 1 Timeout
+ */
+static uint8_t _wait_evt(uint32_t u32Evt)
+{
+	uint64_t u64End = adf7030_1_Sim_Now() + 1000ULL * BENCH_EVT_TMO_US;
+	while (u32LastEvt != u32Evt)
+	{
+		if (adf7030_1_Sim_Now() >= u64End)
+		{
+			return 1;
+		}
+		SimRtos_Idle(100);
+	}
+	return 0;
+}
+
+/*!
+ * @static
+ * @brief Start the counters of one operation
+ *
+ */
+static void _op_start(void)
+{
+	u32LastEvt = PHYDEV_EVT_NONE;
+	adf7030_1_Sim_ClrStats();
+}
+
+/*!
+ * @static
+ * @brief Print the counters of one operation
+ *
+ * @param [in] sName The operation name
+ * @param [in] i32Ret The operation return code
+ *
+ */
+static void _op_end(const char *sName, int32_t i32Ret)
+{
+	adf7030_1_sim_stats_t sStats;
+	adf7030_1_Sim_GetStats(&sStats);
+	printf("%-14s,%3ld,%5lu,%6lu,%4lu,%5lu,%6lu,%6lu,%4lu,%4lu,%4lu,%4lu,%9.1f,%9.1f,%9.1f\n",
+			sName, (long)i32Ret,
+			(unsigned long)sStats.u32Xfer, (unsigned long)sStats.u32Byte,
+			(unsigned long)sStats.u32Cmd, (unsigned long)sStats.u32Poll,
+			(unsigned long)sStats.u32MemRd, (unsigned long)sStats.u32MemWr,
+			(unsigned long)sStats.u32Irq, (unsigned long)sStats.u32CmdLost,
+			(unsigned long)sStats.u32BadAccess, (unsigned long)sStats.u32SpiConfig,
+			sStats.u64SpiTime / 1000.0, sStats.u64HoldTime / 1000.0,
+			sStats.u64Time / 1000.0);
+}
+
+/*!
+ * @static
+ * @brief Transmit one frame
+ *
+ */
+static int32_t _bench_tx(phy_mod_e eMod, uint8_t u8Len)
+{
+	uint8_t aBuf[255];
+	int32_t i32Ret;
+	uint8_t i;
+
+	for (i = 0; i < u8Len; i++)
+	{
+		aBuf[i] = i;
+	}
+	adf7030_1_Sim_SetAirRate(aAirRate[eMod]);
+	i32Ret = sPhyDev.pIf->pfSetSend(&sPhyDev, aBuf, u8Len);
+	if (i32Ret == PHY_STATUS_OK)
+	{
+		i32Ret = sPhyDev.pIf->pfTx(&sPhyDev, DEFAULT_CH, eMod);
+	}
+	if (i32Ret == PHY_STATUS_OK && _wait_evt(PHYDEV_EVT_TX_COMPLETE))
+	{
+		i32Ret = PHY_STATUS_ERROR;
+	}
+	return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief Transmit one frame at the given power, then check the PHY PA setup
+ *
+ */
+static int32_t _bench_tx_pwr(phy_power_e ePwr, phy_mod_e eMod)
+{
+	radio_dig_tx_cfg0_t tx_cfg0;
+	int32_t i32Ret;
+
+	sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CTL_SET_TX_POWER, ePwr);
+	i32Ret = _bench_tx(eMod, 20);
+	tx_cfg0.RADIO_DIG_TX_CFG0 = adf7030_1_Sim_ReadMem32(PROFILE_RADIO_DIG_TX_CFG0_Addr);
+	if ( (i32Ret == PHY_STATUS_OK) && (
+		 (tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_COARSE != aPhyPower[ePwr].coarse) ||
+		 (tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_FINE != aPhyPower[ePwr].fine) ||
+		 (tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_MICRO != aPhyPower[ePwr].micro) ) )
+	{
+		i32Ret = PHY_STATUS_ERROR;
+	}
+	return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief Receive one (injected) frame
+ *
+ */
+static int32_t _bench_rx(phy_mod_e eMod, uint8_t u8Len)
+{
+	uint8_t aBuf[255];
+	uint8_t u8RxLen = 0;
+	int32_t i32Ret;
+	uint8_t i;
+
+	for (i = 0; i < u8Len; i++)
+	{
+		aBuf[i] = 0xA5 ^ i;
+	}
+	adf7030_1_Sim_SetAirRate(aAirRate[eMod]);
+	adf7030_1_Sim_QueueRxFrame(BENCH_RX_DELAY_US, aBuf, u8Len, 0x7A0);
+	i32Ret = sPhyDev.pIf->pfRx(&sPhyDev, DEFAULT_CH, eMod);
+	if (i32Ret == PHY_STATUS_OK && _wait_evt(PHYDEV_EVT_RX_COMPLETE))
+	{
+		i32Ret = PHY_STATUS_ERROR;
+	}
+	if (i32Ret == PHY_STATUS_OK)
+	{
+		memset(aBuf, 0, sizeof(aBuf));
+		i32Ret = sPhyDev.pIf->pfGetRecv(&sPhyDev, aBuf, &u8RxLen);
+		if (i32Ret == PHY_STATUS_OK && u8RxLen != u8Len)
+		{
+			i32Ret = PHY_STATUS_ERROR;
+		}
+	}
+	return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief Receive back-to-back (injected) frames in continuous RX
+ *
+ * @details The next frame preamble starts as soon as the PHY is back in RX.
+ */
+static int32_t _bench_rx_cont(phy_mod_e eMod, uint8_t u8Len, uint8_t u8Nb)
+{
+	// static : the ioctl argument is 32 bits (see -no-pie in CMakeLists.txt)
+	static phy_rx_frame_t sFrame;
+	uint8_t aBuf[255];
+	uint64_t u64End;
+	int32_t i32Ret;
+	uint8_t u8Got = 0;
+	uint8_t i;
+
+	for (i = 0; i < u8Len; i++)
+	{
+		aBuf[i] = 0x5A ^ i;
+	}
+	adf7030_1_Sim_SetAirRate(aAirRate[eMod]);
+	for (i = 0; i < u8Nb; i++)
+	{
+		adf7030_1_Sim_QueueRxFrame((i)?(0):(BENCH_RX_DELAY_US), aBuf, u8Len, 0x7A0);
+	}
+	sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_RX_CONT, 1);
+	i32Ret = sPhyDev.pIf->pfRx(&sPhyDev, DEFAULT_CH, eMod);
+	// The other state commands are rejected until the continuous RX is stopped
+	if ( (i32Ret == PHY_STATUS_OK) &&
+	     ( (sPhyDev.pIf->pfTx(&sPhyDev, DEFAULT_CH, eMod) != PHY_STATUS_BUSY) ||
+	       (sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CTL_CMD_SLEEP, 0) != PHY_STATUS_BUSY) ) )
+	{
+		i32Ret = PHY_STATUS_ERROR;
+	}
+
+	u64End = adf7030_1_Sim_Now() + 1000ULL * BENCH_EVT_TMO_US;
+	while (i32Ret == PHY_STATUS_OK && u8Got < u8Nb && adf7030_1_Sim_Now() < u64End)
+	{
+		SimRtos_Idle(100);
+		while (sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_RX_POP, (uint32_t)(uintptr_t)&sFrame) == PHY_STATUS_OK)
+		{
+			if (sFrame.u8Len == u8Len)
+			{
+				u8Got++;
+			}
+		}
+	}
+	sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_RX_CONT, 0);
+	sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CTL_CMD_READY, 0);
+	return (i32Ret == PHY_STATUS_OK && u8Got == u8Nb)?(PHY_STATUS_OK):(PHY_STATUS_ERROR);
+}
+
+/*!
+ * @static
+ * @brief Listen before talk, optionally followed by one TX from CCA
+ *
+ * @details The noise is the one set by adf7030_1_Sim_SetNoise.
+ */
+static int32_t _bench_lbt(int8_t i8Threshold, uint8_t bExpBusy, uint8_t bTx)
+{
+	// static : the ioctl argument is 32 bits (see -no-pie in CMakeLists.txt)
+	static uint16_t aSample[8];
+	static phy_lbt_t sLbt;
+	int32_t i32Ret;
+
+	adf7030_1_Sim_SetAirRate(aAirRate[PHY_WM2400]);
+	sLbt.eChannel = DEFAULT_CH;
+	sLbt.eModulation = PHY_WM2400;
+	sLbt.i8Threshold = i8Threshold;
+	sLbt.u8Margin = 3;
+	sLbt.u8NbSample = 8;
+	sLbt.bTxAfter = bTx;
+	sLbt.pSamples = aSample;
+	i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_LBT, (uint32_t)(uintptr_t)&sLbt);
+	if (i32Ret == PHY_STATUS_OK && sLbt.bBusy != bExpBusy)
+	{
+		i32Ret = PHY_STATUS_ERROR;
+	}
+	if (i32Ret == PHY_STATUS_OK && bTx)
+	{
+		i32Ret = _bench_tx(PHY_WM2400, 20);
+	}
+	return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief Expected noise (raw) on one channel, see _bench_set_ch_noise
+ */
+#define BENCH_CH_NOISE(ch) ((uint16_t)(-4*(70 + 3*(ch))) & 0x7FF)
+
+/*!
+ * @static
+ * @brief Set a different noise level on each channel (-70 dBm, -73 dBm...)
+ */
+static void _bench_set_ch_noise(void)
+{
+	uint8_t i;
+	for (i = 0; i < PHY_NB_CH; i++)
+	{
+		adf7030_1_Sim_SetChNoise(PHY_FREQUENCY_CH(i), BENCH_CH_NOISE(i));
+	}
+}
+
+/*!
+ * @static
+ * @brief Measure the noise of all the channels, one CCA after another
+ */
+static int32_t _bench_cca_loop(phy_mod_e eMod)
+{
+	int32_t i32Ret = PHY_STATUS_OK;
+	uint8_t i;
+
+	for (i = 0; (i < PHY_NB_CH) && (i32Ret == PHY_STATUS_OK); i++)
+	{
+		i32Ret = sPhyDev.pIf->pfNoise(&sPhyDev, i, eMod);
+		if ( (i32Ret == PHY_STATUS_OK) && (sPhyDev.u16_Noise != BENCH_CH_NOISE(i)) )
+		{
+			i32Ret = PHY_STATUS_ERROR;
+		}
+	}
+	return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief Measure the noise of all the channels with the noise scan
+ */
+static int32_t _bench_scan(uint8_t u8ModMsk)
+{
+	// static : the ioctl argument is 32 bits (see -no-pie in CMakeLists.txt)
+	static phy_scan_t sScan;
+	int32_t i32Ret;
+	uint8_t i, j;
+
+	sScan.u8ChMsk = (1 << PHY_NB_CH) - 1;
+	sScan.u8ModMsk = u8ModMsk;
+	sScan.u8NbSample = NOISE_MEAS_AVG_NB;
+	i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_NOISE_SCAN, (uint32_t)(uintptr_t)&sScan);
+	for (j = 0; (j < PHY_NB_MOD) && (i32Ret == PHY_STATUS_OK); j++)
+	{
+		for (i = 0; i < PHY_NB_CH; i++)
+		{
+			if (sScan.aNoise[j][i] != ( (u8ModMsk & (1 << j))?(BENCH_CH_NOISE(i)):(0) ) )
+			{
+				i32Ret = PHY_STATUS_ERROR;
+			}
+		}
+	}
+	return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief Measure the noise of all the channels as the AT commands do : PHY
+ * powered on then off around each CCA (bScan = 0) or around one noise scan
+ */
+static int32_t _bench_at_noise(uint8_t bScan)
+{
+	int32_t i32Ret = PHY_STATUS_OK;
+	uint8_t i;
+
+	for (i = 0; (i < PHY_NB_CH) && (i32Ret == PHY_STATUS_OK); i++)
+	{
+		i32Ret = sPhyDev.pIf->pfInit(&sPhyDev);
+		if (i32Ret == PHY_STATUS_OK)
+		{
+			if (bScan)
+			{
+				i32Ret = _bench_scan(1 << PHY_WM2400);
+				i = PHY_NB_CH;
+			}
+			else if (sPhyDev.pIf->pfNoise(&sPhyDev, i, PHY_WM2400) != PHY_STATUS_OK)
+			{
+				i32Ret = PHY_STATUS_ERROR;
+			}
+			else if (sPhyDev.u16_Noise != BENCH_CH_NOISE(i))
+			{
+				i32Ret = PHY_STATUS_ERROR;
+			}
+		}
+		sPhyDev.pIf->pfUnInit(&sPhyDev);
+	}
+	// Back on for the next operations
+	if (sPhyDev.pIf->pfInit(&sPhyDev) != PHY_STATUS_OK)
+	{
+		i32Ret = PHY_STATUS_ERROR;
+	}
+	sPhyDev.pfEvtCb = _evt_cb;
+	return i32Ret;
+}
+
+#if defined (USE_PHY_AFC_TRACK)
+/*!
+ * @static
+ * @brief Receive (injected) frames with a local oscillator error, the AFC
+ * frequency correction has to compensate it
+ *
+ */
+static int32_t _bench_afc_track(int32_t i32LoErr, uint8_t u8Nb)
+{
+	int32_t i32Ret = PHY_STATUS_OK;
+	int32_t i32Res;
+	uint8_t i;
+
+	Phy_SetAfcCorr(0);
+	adf7030_1_Sim_SetAfc(PHY_FREQUENCY_CH(DEFAULT_CH), i32LoErr);
+	for (i = 0; (i < u8Nb) && (i32Ret == PHY_STATUS_OK); i++)
+	{
+		u32LastEvt = PHYDEV_EVT_NONE;
+		i32Ret = _bench_rx(PHY_WM4800, 20);
+	}
+	// Residual error of the local oscillator
+	i32Res = sPhyDev.i16TxFreqOffset + Phy_GetAfcCorr() + i32LoErr;
+	printf("afc_track     , LO error %ld Hz, correction %d Hz, residual %ld Hz\n",
+			(long)i32LoErr, Phy_GetAfcCorr(), (long)i32Res);
+	if ( (i32Res > 2*PHY_AFC_TRACK_DEADBAND_HZ) || (i32Res < -2*PHY_AFC_TRACK_DEADBAND_HZ) )
+	{
+		i32Ret = PHY_STATUS_ERROR;
+	}
+	adf7030_1_Sim_SetAfc(0, 0);
+	Phy_SetAfcCorr(0);
+	return i32Ret;
+}
+#endif
+
+#if defined (USE_PHY_SCHED)
+
+/*!
+ * @static
+ * @brief Transmit frames then receive one (injected) at given times, and one
+ * too late (rejected, the PHY is left free)
+ *
+ */
+static int32_t _bench_sched(uint8_t u8Nb)
+{
+	// static : the ioctl argument is 32 bits (see -no-pie in CMakeLists.txt)
+	static phy_sched_t sSched;
+	static uint32_t u32Fired;
+	uint8_t aBuf[20];
+	int32_t i32Ret = PHY_STATUS_OK;
+	int32_t i32Err, i32ErrMin = INT32_MAX, i32ErrMax = INT32_MIN;
+	uint8_t i;
+
+	memset(aBuf, 0x5A, sizeof(aBuf));
+	adf7030_1_Sim_SetAirRate(aAirRate[PHY_WM2400]);
+	sSched.eChannel = DEFAULT_CH;
+	sSched.eModulation = PHY_WM2400;
+	for (i = 0; (i < u8Nb + 1) && (i32Ret == PHY_STATUS_OK); i++)
+	{
+		u32LastEvt = PHYDEV_EVT_NONE;
+		// Spread the start times over the LPTIM prescaler ranges
+		sSched.u32Time = HiResTime_Now() + 5000 + 9000*i;
+		if (i < u8Nb)
+		{
+			sSched.eCmd = PHY_CMD_TX;
+			i32Ret = sPhyDev.pIf->pfSetSend(&sPhyDev, aBuf, sizeof(aBuf));
+		}
+		else
+		{
+			sSched.eCmd = PHY_CMD_RX;
+			adf7030_1_Sim_QueueRxFrame(BENCH_RX_DELAY_US, aBuf, sizeof(aBuf), 0x7A0);
+		}
+		if (i32Ret == PHY_STATUS_OK)
+		{
+			i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_SCHED, (uint32_t)(uintptr_t)&sSched);
+		}
+		// No STOP mode until the pulse is given
+		if ( (i32Ret == PHY_STATUS_OK) &&
+		     ( !(BSP_LowPower_IsStopInhibited() & LP_STOP_INHIBIT_PHY_SCHED) ||
+		       _wait_evt((i < u8Nb)?(PHYDEV_EVT_TX_COMPLETE):(PHYDEV_EVT_RX_COMPLETE)) ||
+		       (BSP_LowPower_IsStopInhibited() & LP_STOP_INHIBIT_PHY_SCHED) ) )
+		{
+			i32Ret = PHY_STATUS_ERROR;
+		}
+		if (i32Ret == PHY_STATUS_OK)
+		{
+			sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_SCHED_START, (uint32_t)(uintptr_t)&u32Fired);
+			i32Err = (int32_t)(u32Fired - sSched.u32Time);
+			i32ErrMin = (i32Err < i32ErrMin)?(i32Err):(i32ErrMin);
+			i32ErrMax = (i32Err > i32ErrMax)?(i32Err):(i32ErrMax);
+		}
+	}
+	if (i32Ret == PHY_STATUS_OK)
+	{
+		// Too late : rejected, nothing started
+		sSched.eCmd = PHY_CMD_TX;
+		sSched.u32Time = HiResTime_Now() + PHY_SCHED_MIN_US / 2;
+		sPhyDev.pIf->pfSetSend(&sPhyDev, aBuf, sizeof(aBuf));
+		if ( (sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_SCHED, (uint32_t)(uintptr_t)&sSched) != PHY_STATUS_ERROR) ||
+		     (adf7030_1_ctx.eState & ADF7030_1_STATE_BUSY) ||
+		     (BSP_LowPower_IsStopInhibited() & LP_STOP_INHIBIT_PHY_SCHED) )
+		{
+			i32Ret = PHY_STATUS_ERROR;
+		}
+	}
+	printf("sched         , %u TX + 1 RX, start error min %ld us, max %ld us\n",
+			u8Nb, (long)i32ErrMin, (long)i32ErrMax);
+	return i32Ret;
+}
+#endif
+
+/*!
+ * @static
+ * @brief Provoke rejected RX (invalid modulation), one per millisecond, then
+ * check the last error codes ring (content, newest first order and wrap-around)
+ *
+ */
+static int32_t _bench_err_ring(uint8_t u8Nb)
+{
+	phy_log_err_t sErr;
+	uint64_t u64Ms;
+	uint8_t i;
+
+	PhyLog_ErrClear();
+	pErrMsg = NULL;
+	for (i = 0; i < u8Nb; i++)
+	{
+		// Each error on its own RTC millisecond
+		adf7030_1_Sim_Advance(1000000ULL - (adf7030_1_Sim_Now() % 1000000ULL));
+		if (sPhyDev.pIf->pfRx(&sPhyDev, DEFAULT_CH, (phy_mod_e)(PHY_WM6400 + 1)) == PHY_STATUS_OK)
+		{
+			return PHY_STATUS_ERROR;
+		}
+	}
+	u64Ms = adf7030_1_Sim_Now() / 1000000ULL;
+	sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CTL_GET_STR_ERR, (uint32_t)(uintptr_t)&pErrMsg);
+	if ( !pErrMsg || (PhyLog_ErrTotal() != u8Nb) )
+	{
+		return PHY_STATUS_ERROR;
+	}
+	for (i = 0; i < PHY_LOG_ERR_RING_NB; i++)
+	{
+		if ( PhyLog_ErrGet(i, &sErr) != (i >= u8Nb) )
+		{
+			return PHY_STATUS_ERROR;
+		}
+		// The last one first, the oldest ones overwritten
+		if ( (i < u8Nb) &&
+		     ( (sErr.u8Inst != ADF7030_1_INVALID_PHY_CONFIGURATION) ||
+		       (1000ULL * sErr.u32Time + sErr.u16Ms != u64Ms - i) ) )
+		{
+			return PHY_STATUS_ERROR;
+		}
+	}
+	return PHY_STATUS_OK;
+}
+
+/*!
+ * @static
+ * @brief Set the temperature (measured by the PHY) and the voltage, then the
+ * PHY back to ready
+ *
+ * @details The auto-calibration is run if no cached calibration is close enough.
+ */
+static int32_t _bench_cal_env(int8_t i8Temp, uint8_t u8Vdd)
+{
+	cal_env_info_t sEnv;
+	int32_t i32Ret;
+
+	adf7030_1_Sim_SetTemperature(i8Temp * 16);
+	sEnv.calEnv = 0;
+	sEnv.u8Vdd = u8Vdd;
+	sEnv.bMeasTemp = 1;
+	sEnv.bAutoCal = 1;
+	i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_CAL_ENV, sEnv.calEnv);
+	if (i32Ret == PHY_STATUS_OK)
+	{
+		i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CTL_CMD_READY, 0);
+	}
+	return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief Set the temperature (measured by the PHY) with the PHY powered off, as
+ * the monitor task does between two sessions
+ *
+ * @details The PHY is powered on for the measure only : it must be off again.
+ */
+static int32_t _bench_cal_env_off(int8_t i8Temp)
+{
+	cal_env_info_t sEnv;
+	int32_t i32Ret;
+
+	sPhyDev.pIf->pfUnInit(&sPhyDev);
+	adf7030_1_Sim_SetTemperature(i8Temp * 16);
+	sEnv.calEnv = 0;
+	sEnv.bMeasTemp = 1;
+	sEnv.bAutoCal = 1;
+	i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_CAL_ENV, sEnv.calEnv);
+	if (adf7030_1_ctx.eState & ADF7030_1_STATE_INITIALIZED)
+	{
+		i32Ret = PHY_STATUS_ERROR;
+	}
+	return i32Ret;
+}
+
+/*!
+ * @brief Synthetic patch (code, checksum descriptor, selfcheck code) for the
+ * CRC verification
+ */
+#define BENCH_PATCH_ADDR     0x20003800UL
+#define BENCH_PATCH_SZ       64
+#define BENCH_PATCH_CHK_ADDR 0x20003900UL
+#define BENCH_PATCH_SC_ADDR  0x20003A00UL
+#define BENCH_PATCH_SC_SZ    16
+#define BENCH_PATCH_CRC_POLY 0x04C11DB7UL
+
+static uint8_t aPatchCode[BENCH_PATCH_SZ];
+static uint8_t aPatchSelfCheck[BENCH_PATCH_SC_SZ];
+static patch_checksum_desc_t sPatchChk = {
+	.Size = sizeof(patch_checksum_desc_t) + sizeof(patch_section_t),
+	.nbBlock = 1,
+	.crc_poly = BENCH_PATCH_CRC_POLY,
+	.crc_seed = 0xFFFFFFFFUL,
+	.Sections = { { .Size = BENCH_PATCH_SZ, .Addr = (uint16_t)BENCH_PATCH_ADDR } }
+};
+static patch_desc_t sPatch = {
+	.Name = "bench",
+	.Size = BENCH_PATCH_SZ + BENCH_PATCH_SC_SZ,
+	.nbBlock = 3,
+	.InfoBlockId = 1,
+	.CheckBlockId = 2,
+	.CheckSeq = (uint16_t)BENCH_PATCH_SC_ADDR + 1,
+	.InjectSeq = (uint16_t)BENCH_PATCH_ADDR + 1,
+	.EjectSeq = (uint16_t)BENCH_PATCH_ADDR + 5,
+	.pChecksum = &sPatchChk,
+	.BLOCKS = {
+		{ .Size = BENCH_PATCH_SZ, .Addr = BENCH_PATCH_ADDR, .pData = aPatchCode },
+		{ .Size = 0, .Addr = BENCH_PATCH_CHK_ADDR, .pData = NULL },
+		{ .Size = BENCH_PATCH_SC_SZ, .Addr = BENCH_PATCH_SC_ADDR, .pData = aPatchSelfCheck },
+	}
+};
+
+/*!
+ * @static
+ * @brief Load the synthetic patch, verified by the PHY CRC (selfcheck model)
+ *
+ * @details With bCorrupt, one byte of the patch is changed after its GoldenCRC
+ * is computed, so the patch must be rejected (not injected).
+ *
+ * @param [in] bCorrupt Corrupt the patch
+ *
+ */
+static int32_t _bench_patch_crc(uint8_t bCorrupt)
+{
+	adf7030_1_spi_info_t *pSPIDevInfo = &(adf7030_1_ctx.SPIInfo);
+	uint8_t eRet;
+	uint8_t i;
+
+	for (i = 0; i < BENCH_PATCH_SZ; i++)
+	{
+		aPatchCode[i] = (uint8_t)(i * 7 + 3);
+	}
+	sPatchChk.crc_config.u16_val = 0;
+	sPatchChk.crc_config.enable = 1;
+	sPatchChk.crc_config.bitdir = 1;
+	sPatchChk.crc_config.inject_ok = 1;
+	sPatchChk.crc_config.crc_len = 32;
+	sPatchChk.crc_output = 0;
+	sPatchChk.GoldenCRC = adf7030_1_Sim_Crc(aPatchCode, BENCH_PATCH_SZ, sPatchChk.crc_poly, sPatchChk.crc_seed, 32);
+	if (bCorrupt)
+	{
+		aPatchCode[BENCH_PATCH_SZ / 2] ^= 0x10;
+	}
+	adf7030_1_Sim_SetSelfCheck(BENCH_PATCH_CHK_ADDR, sPatch.CheckSeq, sPatch.InjectSeq);
+
+	eRet = adf7030_1__STATE_PhyCMD_WaitReady(pSPIDevInfo, PHY_OFF, PHY_OFF);
+	if (!eRet)
+	{
+		eRet = adf7030_1__LoadPatch(pSPIDevInfo, &sPatch, ADF7030_1_VERIFY_CRC, CFG_DEV, PHY_OFF);
+		// The checksum descriptor holds the CRC of the patch in the PHY
+		sPatchChk.crc_output = adf7030_1_Sim_Crc(aPatchCode, BENCH_PATCH_SZ, sPatchChk.crc_poly, sPatchChk.crc_seed, 32);
+		if ( adf7030_1__VerifyPatchCheckumInfo(pSPIDevInfo, &sPatch, &sPatchChk) )
+		{
+			return PHY_STATUS_ERROR;
+		}
+	}
+	adf7030_1_Sim_SetSelfCheck(0, 0, 0);
+	return (eRet == bCorrupt)?(PHY_STATUS_OK):(PHY_STATUS_ERROR);
+}
+
+/*!
+ * @static
+ * @brief Run and print the SPI micro-benchmark (reads and SPI transactions per second)
+ */
+static void _print_spi_bench(void)
+{
+	static const char * const aName[2] = { "spi_reg", "spi_bulk" };
+	static phy_spi_bench_t sBench;
+	adf7030_1_sim_stats_t sStats;
+	int32_t i32Ret;
+	double dS;
+	uint8_t i;
+
+	printf("\nspi_bench     ,ret, reads, xfer, cfg,  time_us,  reads_s,   xfer_s,  kbyte_s\n");
+	for (i = 0; i < 2; i++)
+	{
+		sBench.bBulk = i;
+		sBench.u16Nb = (i)?(50):(500);
+		_op_start();
+		i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_SPI_BENCH, (uint32_t)(uintptr_t)&sBench);
+		adf7030_1_Sim_GetStats(&sStats);
+		dS = sStats.u64Time / 1e9;
+		printf("%-14s,%3ld,%6u,%5lu,%4lu,%9.1f,%9.0f,%9.0f,%9.1f\n",
+				aName[i], (long)i32Ret, sBench.u16Done,
+				(unsigned long)sStats.u32Xfer, (unsigned long)sStats.u32SpiConfig,
+				sStats.u64Time / 1000.0, sBench.u16Done / dS, sStats.u32Xfer / dS,
+				sStats.u32Byte / dS / 1000.0);
+	}
+}
+
+/*!
+ * @static
+ * @brief Print the last error message, then the last error codes ring (oldest first)
+ */
+static void _print_err_ring(void)
+{
+	printf("\n[ERR] %s\n", (pErrMsg)?(pErrMsg):("none"));
+	PhyLog_ErrDump();
+}
+
+#if defined (USE_PHY_TIME_TRACE)
+/*!
+ * @static
+ * @brief Print the PHY timing trace statistics
+ */
+static void _print_lat(void)
+{
+	static const char * const aLatName[PHY_TRACE_NB_LAT] =
+	{
+		"wakeup", "off", "on", "cfg_dev", "tx", "rx", "cca", "frm_irq", "tx_eof_rx"
+	};
+	phy_trace_lat_t sLat;
+	uint8_t i;
+
+	printf("\ntransition    ,count,  min_us,  avg_us,  max_us,  p99_us\n");
+	for (i = 0; i < PHY_TRACE_NB_LAT; i++)
+	{
+		PhyTrace_GetLat(i, &sLat);
+		printf("%-14s,%5lu,%8lu,%8lu,%8lu,%8lu\n", aLatName[i],
+				(unsigned long)sLat.u32Count, (unsigned long)sLat.u32Min,
+				(unsigned long)sLat.u32Avg, (unsigned long)sLat.u32Max,
+				(unsigned long)sLat.u32P99);
+	}
+}
+#endif
+
+#if defined (USE_PHY_STATS)
+/*!
+ * @static
+ * @brief Print the PHY signal statistics (measured channels only)
+ */
+static void _print_stats(void)
+{
+	phy_stats_t sStats;
+	uint8_t i, j;
+
+	printf("\nstats  ,ch,mod,rssi_nb,rssi_avg,rssi_p50,noise_nb,noise_avg,noise_p50,ferr_nb,ferr_hz\n");
+	for (j = 0; j < PHY_NB_MOD; j++)
+	{
+		for (i = 0; i < PHY_NB_CH; i++)
+		{
+			PhyStats_Get(i, j, &sStats);
+			if (sStats.sRssi.u16Count || sStats.sNoise.u16Count)
+			{
+				printf("stats  ,%2u,%3u,%7u,%8.2f,%8.2f,%8u,%9.2f,%9.2f,%7u,%7ld\n", i, j,
+						sStats.sRssi.u16Count, sStats.sRssi.i16Ewma / 4.0, sStats.sRssi.i16P50 / 4.0,
+						sStats.sNoise.u16Count, sStats.sNoise.i16Ewma / 4.0, sStats.sNoise.i16P50 / 4.0,
+						sStats.u16FerrNb, (long)sStats.i32FerrHz);
+			}
+		}
+	}
+}
+#endif
+
+int main(void)
+{
+	int32_t i32Ret;
+	rx_stage_info_t sRxStage;
+
+	BSP_Sim_Init();
+
+	printf("operation     ,ret, xfer, bytes, cmd, poll, mem_rd, mem_wr, irq,lost, bad, cfg,   spi_us,  hold_us,  time_us\n");
+
+	// Power on, reset, base configuration (scheduler not yet started, as on target)
+	_op_start();
+	i32Ret = Phy_adf7030_setup(&sPhyDev, &adf7030_1_ctx,
+			(adf7030_1_gpio_int_info_t *)&DEFAULT_GPIO_INT,
+#if defined (USE_PHY_TRIG)
+			(adf7030_1_gpio_trig_info_t *)&DEFAULT_GPIO_TRIG,
+#else
+			(adf7030_1_gpio_trig_info_t *)NULL,
+#endif
+			(adf7030_1_gpio_reset_info_t *)&DEFAULT_GPIO_RESET,
+			ADF7030_1_GPIO6, ADF7030_1_GPIO_NONE);
+	if (i32Ret == PHY_STATUS_OK)
+	{
+		i32Ret = sPhyDev.pIf->pfInit(&sPhyDev);
+	}
+	_op_end("init", i32Ret);
+	if (i32Ret != PHY_STATUS_OK)
+	{
+		return 1;
+	}
+	sPhyDev.pfEvtCb = _evt_cb;
+	SimRtos_Start();
+
+	_op_start();
+	i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CTL_CMD_READY, 0);
+	_op_end("ready", i32Ret);
+
+	_op_start();
+	_op_end("tx_wm2400_20", _bench_tx(PHY_WM2400, 20));
+
+	_op_start();
+	_op_end("tx_wm2400_20", _bench_tx(PHY_WM2400, 20));
+
+	_op_start();
+	_op_end("rx_wm2400_20", _bench_rx(PHY_WM2400, 20));
+
+	_op_start();
+	adf7030_1_Sim_SetNoise(0x7B0);
+	_op_end("cca_wm2400", sPhyDev.pIf->pfNoise(&sPhyDev, DEFAULT_CH, PHY_WM2400));
+
+	_op_start();
+	i32Ret = sPhyDev.pIf->pfNoise(&sPhyDev, DEFAULT_CH, PHY_WM2400);
+	if (i32Ret == PHY_STATUS_OK)
+	{
+		i32Ret = _bench_tx(PHY_WM2400, 20);
+	}
+	_op_end("cca_then_tx", i32Ret);
+
+	// Sampled noise is -20 dBm
+	_op_start();
+	_op_end("lbt_free", _bench_lbt(-10, 0, 0));
+
+	_op_start();
+	_op_end("lbt_busy", _bench_lbt(-30, 1, 0));
+
+	_op_start();
+	_op_end("lbt_then_tx", _bench_lbt(-10, 0, 1));
+
+	// Noise of all the channels : CCA one after another, then noise scan
+	_bench_set_ch_noise();
+	_op_start();
+	_op_end("cca_loop_6ch", _bench_cca_loop(PHY_WM2400));
+
+	_op_start();
+	_op_end("scan_6ch", _bench_scan(1 << PHY_WM2400));
+
+	_op_start();
+	_op_end("scan_6ch_3mod", _bench_scan( (1 << PHY_NB_MOD) - 1 ));
+
+	_op_start();
+	_op_end("cca_at_6ch", _bench_at_noise(0));
+
+	_op_start();
+	_op_end("scan_at_6ch", _bench_at_noise(1));
+	adf7030_1_Sim_SetChNoise(0, 0);
+
+	_op_start();
+	_op_end("tx_wm4800_20", _bench_tx(PHY_WM4800, 20));
+
+	_op_start();
+	_op_end("tx_pwr_6db", _bench_tx_pwr(PHY_PMAX_minus_6db, PHY_WM4800));
+
+	_op_start();
+	_op_end("tx_pwr_0db", _bench_tx_pwr(PHY_PMAX_minus_0db, PHY_WM4800));
+
+	_op_start();
+	_op_end("tx_pwr_0db_mod", _bench_tx_pwr(PHY_PMAX_minus_0db, PHY_WM6400));
+
+	// Modulation switch WM4800 -> WM2400 : register delta, then full image
+	_op_start();
+	i32Ret = _bench_tx(PHY_WM4800, 20);
+	_op_start();
+	_op_end("tx_mod_delta", (i32Ret)?(i32Ret):(_bench_tx(PHY_WM2400, 20)));
+
+	_op_start();
+	i32Ret = _bench_tx(PHY_WM4800, 20);
+	adf7030_1_ctx.u8CfgMod = 0xFF; // loaded image unknown (PHY_CFG_MOD_NONE)
+	_op_start();
+	_op_end("tx_mod_full", (i32Ret)?(i32Ret):(_bench_tx(PHY_WM2400, 20)));
+
+	_op_start();
+	_op_end("rx_wm4800_20", _bench_rx(PHY_WM4800, 20));
+
+	_op_start();
+	_op_end("rx_cont_3x20", _bench_rx_cont(PHY_WM4800, 20, 3));
+
+	// TX then RX, with the RX setup pre-staged at the TX end of frame
+	_op_start();
+	sRxStage.eChannel = DEFAULT_CH;
+	sRxStage.eModulation = PHY_WM4800;
+	sRxStage.bEnable = 1;
+	sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_RX_STAGE, sRxStage.rxStage);
+	_op_end("tx_rx_stage", _bench_tx(PHY_WM4800, 20));
+
+	_op_start();
+	_op_end("rx_staged", _bench_rx(PHY_WM4800, 20));
+
+#if defined (USE_PHY_AFC_TRACK)
+	// Frequency correction from the AFC error (16 frames)
+	_op_start();
+	_op_end("afc_track", _bench_afc_track(800, 16));
+#endif
+
+#if defined (USE_PHY_SCHED)
+	// TX then RX started at given times
+	_op_start();
+	_op_end("sched", _bench_sched(4));
+#endif
+
+	// Last error codes ring (more errors than its size)
+	_op_start();
+	_op_end("err_ring", _bench_err_ring(PHY_LOG_ERR_RING_NB + 2));
+
+	// Calibration cache : miss (auto-calibration), hit, miss, hit on another entry
+	_op_start();
+	_op_end("cal_25C_miss", _bench_cal_env(25, 165));
+
+	_op_start();
+	_op_end("cal_28C_hit", _bench_cal_env(28, 165));
+
+	_op_start();
+	_op_end("cal_60C_miss", _bench_cal_env(60, 165));
+
+	_op_start();
+	_op_end("cal_20C_hit", _bench_cal_env(20, 160));
+
+	_op_start();
+	_op_end("cal_off_hit", _bench_cal_env_off(26));
+	// Back on for the next operations
+	if (sPhyDev.pIf->pfInit(&sPhyDev) != PHY_STATUS_OK)
+	{
+		return 1;
+	}
+	sPhyDev.pfEvtCb = _evt_cb;
+
+	// Patch verified by the PHY CRC : intact, then corrupted (rejected)
+	_op_start();
+	_op_end("patch_crc", _bench_patch_crc(0));
+
+	_op_start();
+	_op_end("patch_crc_bad", _bench_patch_crc(1));
+
+	// SPI micro-benchmark (PHY awake), as a separate table
+	_print_spi_bench();
+	printf("\noperation     ,ret, xfer, bytes, cmd, poll, mem_rd, mem_wr, irq,lost, bad, cfg,   spi_us,  hold_us,  time_us\n");
+
+	_op_start();
+	i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_SLEEP_MODE, 0);
+	i32Ret |= sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CTL_CMD_SLEEP, 0);
+	_op_end("sleep_warm", i32Ret);
+
+	_op_start();
+	_op_end("tx_warm_wake", _bench_tx(PHY_WM4800, 20));
+
+	_op_start();
+	i32Ret = sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CMD_SLEEP_MODE, 1);
+	i32Ret |= sPhyDev.pIf->pfIoctl(&sPhyDev, PHY_CTL_CMD_SLEEP, 0);
+	_op_end("sleep_cold", i32Ret);
+
+	_op_start();
+	_op_end("tx_cold_wake", _bench_tx(PHY_WM4800, 20));
+
+	_print_err_ring();
+#if defined (USE_PHY_TIME_TRACE)
+	_print_lat();
+#endif
+#if defined (USE_PHY_STATS)
+	_print_stats();
+#endif
+	return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @} */
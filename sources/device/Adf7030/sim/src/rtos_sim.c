@@ -0,0 +1,394 @@
+/**
+  * @file rtos_sim.c
+  * @brief This file implement the FreeRTOS subset of the host simulator
+  *
+  * @details The single task is a ucontext coroutine. It is resumed when the
+  * main flow blocks and a notification is pending ; it gives the hand back
+  * when it blocks on ulTaskNotifyTake. While blocking, the modelled time is
+  * advanced from one PHY model event to the next.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup adf7030_sim
+ * @{
+ *
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <ucontext.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "adf7030-1_sim.h"
+
+/*!
+ * @brief Host stack size of the task (the target stack buffer is not used)
+ */
+#ifndef SIM_TASK_STACK_SIZE
+#define SIM_TASK_STACK_SIZE (64*1024)
+#endif
+
+static ucontext_t sMainCxt;
+static ucontext_t sTaskCxt;
+static uint8_t aTaskStack[SIM_TASK_STACK_SIZE];
+
+static TaskHandle_t hTask;
+static uint8_t bInTask;
+static uint8_t bStarted;
+static SemaphoreHandle_t hTaskLockWait; /*!< Mutex the task is waiting for */
+
+/*!
+ * @static
+ * @brief Task entry (coroutine trampoline)
+ *
+ */
+static void _task_entry(void)
+{
+	hTask->pxCode(hTask->pvParameters);
+	// A task never returns
+	while (1)
+	{
+		swapcontext(&sTaskCxt, &sMainCxt);
+	}
+}
+
+/*!
+ * @static
+ * @brief Run the task while it has a pending notification (or the mutex it
+ * waits for is free)
+ *
+ */
+static void _task_run(void)
+{
+	if (hTask && !bInTask && bStarted)
+	{
+		while ( (hTaskLockWait)?(!hTaskLockWait->u8Owner):(hTask->ulNotifiedValue) )
+		{
+			bInTask = 1;
+			swapcontext(&sMainCxt, &sTaskCxt);
+			bInTask = 0;
+		}
+	}
+}
+
+/*!
+ * @brief Create the (single) task
+ *
+ */
+TaskHandle_t xTaskCreateStatic(
+		TaskFunction_t pxTaskCode, const char * const pcName,
+		const uint32_t ulStackDepth, void * const pvParameters,
+		UBaseType_t uxPriority, StackType_t * const puxStackBuffer,
+		StaticTask_t * const pxTaskBuffer)
+{
+	(void)pcName;
+	(void)ulStackDepth;
+	(void)uxPriority;
+	(void)puxStackBuffer;
+
+	if (hTask || !pxTaskBuffer)
+	{
+		return NULL;
+	}
+	pxTaskBuffer->pxCode = pxTaskCode;
+	pxTaskBuffer->pvParameters = pvParameters;
+	pxTaskBuffer->ulNotifiedValue = 0;
+	hTask = pxTaskBuffer;
+
+	getcontext(&sTaskCxt);
+	sTaskCxt.uc_stack.ss_sp = aTaskStack;
+	sTaskCxt.uc_stack.ss_size = sizeof(aTaskStack);
+	sTaskCxt.uc_link = &sMainCxt;
+	makecontext(&sTaskCxt, _task_entry, 0);
+	return hTask;
+}
+
+/*!
+ * @brief Notify the task (from interrupt call-back)
+ *
+ */
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken)
+{
+	if (xTaskToNotify)
+	{
+		xTaskToNotify->ulNotifiedValue++;
+		if (pxHigherPriorityTaskWoken)
+		{
+			*pxHigherPriorityTaskWoken = pdTRUE;
+		}
+	}
+}
+
+/*!
+ * @brief Wait for a notification (from the task only)
+ *
+ * @details The timeout is not modelled : if nothing is pending, the hand goes
+ * back to the main flow until the next notification.
+ */
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+	uint32_t u32Val;
+	(void)xTicksToWait;
+
+	if (!hTask || !bInTask)
+	{
+		return 0;
+	}
+	while (!hTask->ulNotifiedValue)
+	{
+		swapcontext(&sTaskCxt, &sMainCxt);
+	}
+	u32Val = hTask->ulNotifiedValue;
+	hTask->ulNotifiedValue = (xClearCountOnExit)?(0):(u32Val - 1);
+	return u32Val;
+}
+
+/*!
+ * @brief Get the scheduler state
+ *
+ */
+BaseType_t xTaskGetSchedulerState(void)
+{
+	return (bStarted)?(taskSCHEDULER_RUNNING):(taskSCHEDULER_NOT_STARTED);
+}
+
+/*!
+ * @brief Start the "scheduler" (allow blocking calls and the task to run)
+ *
+ */
+void SimRtos_Start(void)
+{
+	bStarted = 1;
+	_task_run();
+}
+
+/*!
+ * @brief Let the modelled time run (main flow idle), serving the task
+ *
+ * @param [in] u32Us Time to wait (in us)
+ *
+ */
+void SimRtos_Idle(uint32_t u32Us)
+{
+	uint64_t u64End = adf7030_1_Sim_Now() + 1000ULL * u32Us;
+	uint64_t u64Next;
+
+	_task_run();
+	while (adf7030_1_Sim_Now() < u64End)
+	{
+		u64Next = adf7030_1_Sim_NextEvent();
+		if (u64Next > u64End)
+		{
+			u64Next = u64End;
+		}
+		adf7030_1_Sim_Advance(u64Next - adf7030_1_Sim_Now());
+		_task_run();
+	}
+}
+
+/*!
+ * @brief Delay (1 ms tick) : the modelled time runs, serving the task when
+ *        called from the main flow
+ *
+ * @param [in] xTicksToDelay Number of ticks
+ *
+ */
+void vTaskDelay(const TickType_t xTicksToDelay)
+{
+	if (bInTask)
+	{
+		adf7030_1_Sim_Advance(1000000ULL * xTicksToDelay);
+	}
+	else
+	{
+		SimRtos_Idle(1000UL * xTicksToDelay);
+	}
+}
+
+/*!
+ * @brief Create a binary semaphore
+ *
+ */
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *pxSemaphoreBuffer)
+{
+	if (pxSemaphoreBuffer)
+	{
+		pxSemaphoreBuffer->u32Count = 0;
+	}
+	return pxSemaphoreBuffer;
+}
+
+/*!
+ * @brief Take a semaphore, advancing the modelled time while blocked
+ *
+ */
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+	uint64_t u64End;
+	uint64_t u64Next;
+
+	if (!xSemaphore)
+	{
+		return pdFALSE;
+	}
+	u64End = (xBlockTime == portMAX_DELAY)?(UINT64_MAX):(adf7030_1_Sim_Now() + 1000000ULL * xBlockTime);
+	while (1)
+	{
+		if (xSemaphore->u32Count)
+		{
+			xSemaphore->u32Count = 0;
+			return pdTRUE;
+		}
+		if (!xBlockTime || !bStarted)
+		{
+			return pdFALSE;
+		}
+		_task_run();
+		if (xSemaphore->u32Count)
+		{
+			continue;
+		}
+		if (adf7030_1_Sim_Now() >= u64End)
+		{
+			return pdFALSE;
+		}
+		u64Next = adf7030_1_Sim_NextEvent();
+		if (u64Next == UINT64_MAX && u64End == UINT64_MAX)
+		{
+			// Nothing will ever give it
+			return pdFALSE;
+		}
+		if (u64Next > u64End)
+		{
+			u64Next = u64End;
+		}
+		adf7030_1_Sim_Advance( (u64Next > adf7030_1_Sim_Now())?(u64Next - adf7030_1_Sim_Now()):(0) );
+	}
+}
+
+/*!
+ * @brief Give a semaphore
+ *
+ */
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+	if (!xSemaphore || xSemaphore->u32Count)
+	{
+		return pdFALSE;
+	}
+	xSemaphore->u32Count = 1;
+	return pdTRUE;
+}
+
+/*!
+ * @brief Give a semaphore (from interrupt call-back)
+ *
+ */
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken)
+{
+	if (pxHigherPriorityTaskWoken)
+	{
+		*pxHigherPriorityTaskWoken = pdFALSE;
+	}
+	return xSemaphoreGive(xSemaphore);
+}
+
+/*!
+ * @brief Create a recursive mutex
+ *
+ */
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic(StaticSemaphore_t *pxMutexBuffer)
+{
+	if (pxMutexBuffer)
+	{
+		pxMutexBuffer->u32Count = 0;
+		pxMutexBuffer->u8Owner = 0;
+		pxMutexBuffer->u32Depth = 0;
+	}
+	return pxMutexBuffer;
+}
+
+/*!
+ * @brief Take a recursive mutex
+ *
+ * @details The task only runs while the main flow is blocked. If the main
+ * flow owns the mutex, the task gives the hand back until it is released (as
+ * the owner would run with the inherited priority). The main flow never finds
+ * it owned by the task : the task keeps the hand while it holds it.
+ */
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t xMutex, TickType_t xBlockTime)
+{
+	uint8_t u8Me = (bInTask)?(2):(1);
+
+	if (!xMutex)
+	{
+		return pdFALSE;
+	}
+	if (xMutex->u8Owner && (xMutex->u8Owner != u8Me))
+	{
+		configASSERT(bInTask);
+		if (!xBlockTime)
+		{
+			return pdFALSE;
+		}
+		hTaskLockWait = xMutex;
+		while (xMutex->u8Owner)
+		{
+			swapcontext(&sTaskCxt, &sMainCxt);
+		}
+		hTaskLockWait = NULL;
+	}
+	xMutex->u8Owner = u8Me;
+	xMutex->u32Depth++;
+	return pdTRUE;
+}
+
+/*!
+ * @brief Give a recursive mutex, the waiting task runs on the last give
+ *
+ */
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t xMutex)
+{
+	if ( !xMutex || (xMutex->u8Owner != ((bInTask)?(2):(1))) )
+	{
+		return pdFALSE;
+	}
+	if (--(xMutex->u32Depth) == 0)
+	{
+		xMutex->u8Owner = 0;
+		_task_run();
+	}
+	return pdTRUE;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @} */
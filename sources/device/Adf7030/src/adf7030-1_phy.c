@@ -62,6 +62,7 @@ extern "C" {
 /* SPI speed */
 #define ADF7030_1_SPI_DEV_BITRATE         6000000 // Max ADF7030 : 12.5 MHz
 #define ADF7030_1_SPI_DEV_BITRATE_FAST    ADF7030_1_SPI_DEV_BITRATE << 1
+#define ADF7030_1_SPI_DEV_BITRATE_SLOW    1000000 // Wake-up and reset handshake
 
 #define PTR_TRX_BASE_MIN 0x2bcUL // 0x2bc << 2 = 0xAF0
 
@@ -121,6 +122,10 @@ uint8_t adf7030_1_PulseReset(
     if (pDevice == NULL) { return 1;}
     /* Setup pointer to Instance GPIO reset info */
     adf7030_1_gpio_reset_info_t * pResetGPIOInfo = &pDevice->ResetGPIOInfo;
+    /* PHY memory is going to be reset */
+    adf7030_1__SHADOW_Invalidate(pDevice);
+    /* Talk slowly up to the first PHY answer */
+    pDevice->SPIInfo.bHandshake = 1;
     if((pResetGPIOInfo->u32Port != 0UL) && (pResetGPIOInfo->u16Pin != 0UL))
     {
         /* Pulse low PHY Radio GPIO pin from the Glue Host */
@@ -153,6 +158,8 @@ uint8_t adf7030_1_PulseWakup(
 	p_spi_dev_t pSpiDev;
     uint8_t u8Level;
     if (pDevice == NULL) { return ADF7030_1_INVALID_OPERATION;}
+    /* Talk slowly up to the first PHY answer */
+    pDevice->SPIInfo.bHandshake = 1;
 #ifdef TRIG_AS_WAKE_UP
     if( (pDevice->TrigGPIOInfo[ADF7030_1_TRIGPIN0].eTrigStatus != ENABLED) &&
         (pDevice->TrigGPIOInfo[ADF7030_1_TRIGPIN1].eTrigStatus != ENABLED)
@@ -253,6 +260,42 @@ uint16_t adf7030_1__GetRawNoise(
     return u16_NoiseAvg;
 }
 
+/*!
+ * @brief  This function get one Noise sample
+ *
+ * @details The read-back is polled until a valid value is available (same
+ * validity rule as adf7030_1__GetRawNoise), up to NOISE_SAMPLE_RETRY_NB times.
+ *
+ * @note  The PHY device has to be in CCA state before calling this function
+ *
+ * @param [in]  pSPIDevInfo   Pointer to ADF7030-1 SPI device instance.
+ * @param [out] pu16Noise     Pointer to get the noise sample (raw).
+ *
+ * @retval 0 Success
+ * @retval 1 No valid sample
+ */
+uint8_t adf7030_1__GetRawNoiseSample(
+    adf7030_1_spi_info_t* pSPIDevInfo,
+    uint16_t              *pu16Noise
+)
+{
+    uint8_t u8i;
+    cca_read_back_t ccaReadBack;
+
+    if (pSPIDevInfo == NULL || pu16Noise == NULL) { return 1;}
+
+    for (u8i = 0; u8i < NOISE_SAMPLE_RETRY_NB; u8i++)
+    {
+        ccaReadBack = (cca_read_back_t)adf7030_1__SPI_GetMem32(pSPIDevInfo,  PROFILE_CCA_READBACK_Addr );
+        if (ccaReadBack.CCA_READBACK_b.LIVE_STATUS == 0 && ccaReadBack.CCA_READBACK_b.VALUE != 0)
+        {
+            *pu16Noise = ccaReadBack.CCA_READBACK_b.VALUE;
+            return 0;
+        }
+    }
+    return 1;
+}
+
 /*!
  * @brief  This function get the AFC frequency error
  *
@@ -268,6 +311,24 @@ inline int16_t adf7030_1__GetRawAfcFreqErr(
     return (int16_t)adf7030_1__READ_FIELD(AFC_FREQUENCY_ERROR_READBACK);
 }
 
+/*!
+ * @brief  This function get the temperature
+ *
+ * @note  The PHY device has to be in MON state before calling this function
+ *
+ * @param [in] pSPIDevInfo   Pointer to ADF7030-1 SPI device instance.
+ *
+ * @return Temperature (signed, 0.0625 degrees Celsius unit)
+ */
+int16_t adf7030_1__GetRawTemperature(
+    adf7030_1_spi_info_t* pSPIDevInfo
+)
+{
+    if (pSPIDevInfo == NULL) { return 0;}
+    // signed 12 bits
+    return (int16_t)(adf7030_1__READ_FIELD(PROFILE_MONITOR1_TEMP_OUTPUT) << 4) >> 4;
+}
+
 /*!
  * @brief  This function get the current frequency
  *
@@ -378,6 +439,8 @@ uint8_t adf7030_1__SetRawTXPower(
     tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_FINE = u8_PaFine;
     tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_MICRO = u8_PaMicro;
     adf7030_1__SPI_SetMem32(pSPIDevInfo, PROFILE_RADIO_DIG_TX_CFG0_Addr, tx_cfg0.RADIO_DIG_TX_CFG0);
+    // Written behind the host shadow
+    adf7030_1__SHADOW_Invalidate((adf7030_1_device_t*)pSPIDevInfo->hDevInfo);
     return ( (pSPIDevInfo->eXferResult)?(1):(0) );
 }
 
@@ -674,6 +737,8 @@ uint8_t adf7030_1__SetupExtPaLna(
         radio_dig_tx_cfg1.RADIO_DIG_TX_CFG1_b.EXT_LNA_FRAMING_EN = 0;
     }
     adf7030_1__SPI_SetMem32(pSPIDevInfo, PROFILE_RADIO_DIG_TX_CFG1_Addr, radio_dig_tx_cfg1.RADIO_DIG_TX_CFG1);
+    // Written behind the host shadow
+    adf7030_1__SHADOW_Invalidate((adf7030_1_device_t*)pSPIDevInfo->hDevInfo);
     return ( (pSPIDevInfo->eXferResult)?(1):(0) );
 }
 /******************************************************************************/
@@ -872,6 +937,8 @@ uint8_t adf7030_1__SetTxPacket(
     sBlock.Size = u8_Sz;
     e_Ret = adf7030_1__WriteDataBlock( pSPIDevInfo, &sBlock);
     adf7030_1__WRITE_FIELD(GENERIC_PKT_FRAME_CFG1_PAYLOAD_SIZE, (uint32_t)u8_Sz );
+    // Written behind the host shadow
+    adf7030_1__SHADOW_Invalidate((adf7030_1_device_t*)pSPIDevInfo->hDevInfo);
     return e_Ret;
 }
 
@@ -1021,10 +1088,18 @@ uint8_t adf7030_1_Setup(
         pSPIDevInfo->nClkFreq = ADF7030_1_SPI_DEV_BITRATE;
         pSPIDevInfo->nClkFreq_Fast = ADF7030_1_SPI_DEV_BITRATE_FAST;
         pSPIDevInfo->nClkFreq_Current = 0;
+        pSPIDevInfo->nClkFreq_Slow = ADF7030_1_SPI_DEV_BITRATE_SLOW;
+        pSPIDevInfo->bHandshake = 0;
 #if (ADF7030_1_PHY_ERROR_REPORT_ENABLE == 1)
         pSPIDevInfo->ePhyError = SM_NOERROR;
         pSPIDevInfo->bPhyErrorCheck = 1;
 #endif
+        /* No state change wait function by default, SPI polling only */
+        pSPIDevInfo->pfPhyWaitCb = NULL;
+        pSPIDevInfo->pPhyWaitParam = NULL;
+        /* No DMA transfer wait function by default, SPI polling only */
+        pSPIDevInfo->pfXferWaitCb = NULL;
+        pSPIDevInfo->pXferWaitParam = NULL;
         // don't modify the following register
         pSPIDevInfo->PHY_PNTR[PNTR_SETUP_ADDR]    = SPI_HOST_BASE;
     	pSPIDevInfo->PHY_PNTR[PNTR_SRAM_ADDR]     = BRAM_BASE; //SRAM_BASE;
@@ -175,6 +175,32 @@ inline float PHY_CONV_AfcFreqErrToFloat(int16_t i16AfcFreqErr)
 	return FreqErr;
 }
 
+/*!
+ * @brief  This function convert a ADF7030 (signed 11 bits) RSSI to 1/4 dBm.
+ *
+ * @param [in]  u16_Signed11 The ADF7030 (signed 11 bits) RSSI value.
+ *
+ * @return The RSSI in 1/4 dBm
+ */
+inline int16_t PHY_CONV_Signed11ToQdBm(uint16_t u16_Signed11)
+{
+	// sign extend
+	return ((int16_t)(u16_Signed11 << 5)) >> 5;
+}
+
+/*!
+ * @brief  This function convert a ADF7030 AFC frequency error to Hz (fixed point).
+ *
+ * @param [in]  i32AfcFreqErr The ADF7030 AFC frequency error value (could be an average).
+ *
+ * @return The AFC frequency error in Hz (rounded toward minus infinity)
+ */
+inline int32_t PHY_CONV_AfcFreqErrToHz(int32_t i32AfcFreqErr)
+{
+	// 26000000 / 4194304 = 203125 / 32768
+	return (int32_t)( ((int64_t)i32AfcFreqErr * 203125) >> 15 );
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,156 +39,65 @@ extern "C" {
 
 #include "adf7030-1_phy_log.h"
 
+#include <bsp.h>
+
 /*!
-   Instance error debug type definition.\n
+   Error debug type definition (code and its message).\n
 */
-typedef struct adf7030_1_instance_error_debug_s
+typedef struct adf7030_1_error_debug_s
 {
-    uint8_t instance_error_id;
-    const char ** instance_error_str;
-} adf7030_1_instance_error_debug_t;
+    uint8_t error_id;
+    const char * error_str;
+} adf7030_1_error_debug_t;
 
 /*!
-   PHY Radio error debug type definition.\n
+   Check that each table code is the value of its name.\n
 */
-typedef struct adf7030_1_phy_error_debug_s
-{
-    uint8_t phy_error_id;
-    const char ** phy_error_str;
-} adf7030_1_phy_error_debug_t;
-
+#define PHY_LOG_INST_ERR(code, name, desc) && ((code) == (name))
+#define PHY_LOG_PHY_ERR(code, name, desc) && ((code) == (name))
+enum { PHY_LOG_TBL_OK = 1
+#include "adf7030-1_phy_log_tbl.h"
+};
+typedef char phy_log_tbl_chk_t[(PHY_LOG_TBL_OK)?(1):(-1)];
 
+#ifndef USE_PHY_LOG_CODE
 /*!
-   Instance error debug messages array.\n
+   Instance error debug array.\n
 */
-const char * const instance_error_msgs[] =
+static const adf7030_1_error_debug_t instance_error_id[] =
 {
-    "ADF7030_1_SUCCESS -> The API is successful.",
-    "ADF7030_1_FAILURE -> The API failed to complete the operation.",
-    "ADF7030_1_HW_ERROR -> A hardware error was detected.",
-    "ADF7030_1_INVALID_DEVICE_NUM -> The given device number is outside the number of instances supported by the driver.",
-    "ADF7030_1_INVALID_HANDLE -> The given device handle is invalid.",
-    "ADF7030_1_INSUFFICIENT_MEMORY -> The given memory is not sufficient to operate the device.",
-    "ADF7030_1_NULL_POINTER -> One of the given pointer parameter points to NULL.",
-    "ADF7030_1_UNALIGNED_MEM_PTR -> The given pointer to the device memory is not aligned to word boundary.",
-    "ADF7030_1_DEVICE_ALREADY_OPENED -> The given device instance is already opened.",
-    "ADF7030_1_DEVICE_NOT_OPENED -> The given device instance is not opened.",
-    "ADF7030_1_INVALID_OPERATION -> The given operation is not permitted in the current state of the driver.",
-    "ADF7030_1_DEVICE_ACCESS_FAILED -> Failed to read or write the device registers.",
-    "ADF7030_1_GPIO_DEV_FAILED -> Failed to register or unregister callback with GPIO service.",
-    "ADF7030_1_SPI_DEV_FAILED -> SPI device driver failure.",
-    "ADF7030_1_SPI_DEV_POLL_EXPIRE -> SPI device driver polling timeout.",
-    "ADF7030_1_SPI_COMM_FAILED -> SPI Communication device related failure.",
-    "ADF7030_1_INVALID_PHY_CONFIGURATION -> The given PHY Radio configuration is invalid.",
-    "ADF7030_1_PENDING_IO -> If trying to perform a read when another read/write in progress.",
-    "ADF7030_1_DMA_NOT_SUPPORTED -> If trying to enable the DMA mode when communication device is TWI."
+#define PHY_LOG_INST_ERR(code, name, desc) { code, #name " -> " desc },
+#include "adf7030-1_phy_log_tbl.h"
 };
 
 /*!
-   PHY Radio hardware error debug messages array.\n
+   PHY Radio hardware error debug array.\n
 */
-const char * const phy_error_msgs[] =
+static const adf7030_1_error_debug_t phy_error_id[] =
 {
-    "SM_NOERROR -> No error",                                                                    // 0x00
-    "SM_INVALID_STATE -> Requested state does not exist",                                         // 0x01
-    "SM_TRANS_BLOCKED -> State transition has been denied",                                     // 0x02
-    "SM_TIMEOUT -> State machine timeout",                                                         // 0x03
-    "SM_ILLEGAL_SCRIPT_CMD -> Illegal script command",                                             // 0x04
-    "SM_UNKNOWN_SPECIAL_CMD -> Unknown state machine special command",                             // 0x05
-    "SM_UNPOPULATED_CUSTOM_CMD -> Special command is not configured",                             // 0x06
-    "SM_PROFILE_CRC_INCORRECT -> Backup up configuration is not valid",                         // 0x07
-    "SM_LPM_CRC_INCORRECT -> Not available ",                                                    // 0x08
-    "SM_INVALID_SCRIPT_DATA -> Not available",                                                     // 0x09
-    "SM_ROM_CRC_INCORRECT -> Not available",                                                     // 0x30
-    "SM_PROFILE_CRC_CALCULATING -> Startup CRC calculation running (not really an error code)", // 0x31
-    "HW_MAIN_PLL_VCO_CAL_FAILURE_COARSE_CAL_FAILED -> PLL course calibration failure",          // 0x11
-    "HW_MAIN_PLL_VCO_CAL_FAILURE_AMP_CAL_FAILED -> PLL amplitude calibration failure",          // 0x12
-    "HW_MAIN_PLL_VCO_CAL_FAILURE_FINE_CAL_FAILED -> PLL fine calibration failure",              // 0x13
-    "HW_ANC_PLL_LOCK_FAILED -> Auxiliary PLL lock failure",                                     // 0x14
-    "HW_MAIN_PLL_VCO_CAL_MODE_INVALID -> PLL calibration mode invalid",                         // 0x15
-    "HW_TCXO_NOT_READY -> Temperature Compensated Crystal Oscillator failure",                  // 0x20
-    "HW_XTAL_NOT_READY -> Crystal Oscillator failure",                                          // 0x21
-    "HW_OCL_CAL_FAILED -> Offset calibration failure",                                          // 0x23
-    "HW_DIV_BY_ZERO -> Hardware divide by zero",                                                // 0x24
-    "HW_VCO_KV_CAL_SINGLE_SHOT_FAILED -> VCO KV calibration step failure",                      // 0x25
-    "HW_VCO_KV_CAL_FINE_CAL_FAILED -> VCO KV fine calibration failure",                         // 0x26
-    "HW_VCO_KV_CAL_AMP_CAL_FAILED -> VCO KV amplitude calibration failure",                     // 0x27
-    "HW_VCO_KV_HFXTAL_INVALID -> VCO KV clock source invalid",                                  // 0x28
-    "HW_VCO_KV_CAL_COARSE_CAL_FAILED -> VCO KV coarse calibration failure",                     // 0x29
-    "HW_TEMP_SENSE_FAILED -> Temperature sensor failure",                                       // 0x32
-    "HW_LFRC_CAL_FAILED -> Low frequency oscillator calibration failure",                       // 0x33
-    "HW_HARD_FAULT_FAIL -> Firmware hard fault \0",                                             // 0x3F
-	//               0x0A to 0x10
-	//               0x16 to 0x1F
-	//               0x22
-	//               0x2A to 0x2F
-	//               0x34 to 0x3E
-	"HW_ERROR -> undetermined !"                                                                // 0xFF
+#define PHY_LOG_PHY_ERR(code, name, desc) { code, #name " -> " desc },
+#include "adf7030-1_phy_log_tbl.h"
 };
 
 /*!
-   Instance error debug array.\n
+   Undetermined error message.\n
 */
-adf7030_1_instance_error_debug_t instance_error_id[NUM_INSTANCE_ERROR] =
-{
-    {ADF7030_1_SUCCESS, &(instance_error_msgs[0]) },
-    {ADF7030_1_FAILURE, &(instance_error_msgs[1]) },
-    {ADF7030_1_HW_ERROR, &(instance_error_msgs[2])},
-    {ADF7030_1_INVALID_DEVICE_NUM, &(instance_error_msgs[3])},
-    {ADF7030_1_INVALID_HANDLE, &(instance_error_msgs[4])},
-    {ADF7030_1_INSUFFICIENT_MEMORY, &(instance_error_msgs[5])},
-    {ADF7030_1_NULL_POINTER, &(instance_error_msgs[6])},
-    {ADF7030_1_UNALIGNED_MEM_PTR, &(instance_error_msgs[7])},
-    {ADF7030_1_DEVICE_ALREADY_OPENED, &(instance_error_msgs[8])},
-    {ADF7030_1_DEVICE_NOT_OPENED, &(instance_error_msgs[9])},
-    {ADF7030_1_INVALID_OPERATION, &(instance_error_msgs[10])},
-    {ADF7030_1_DEVICE_ACCESS_FAILED, &(instance_error_msgs[11])},
-    {ADF7030_1_GPIO_DEV_FAILED, &(instance_error_msgs[12])},
-    {ADF7030_1_SPI_DEV_FAILED, &(instance_error_msgs[13])},
-    {ADF7030_1_SPI_DEV_POLL_EXPIRE, &(instance_error_msgs[14])},
-    {ADF7030_1_SPI_COMM_FAILED, &(instance_error_msgs[15])},
-    {ADF7030_1_INVALID_PHY_CONFIGURATION, &(instance_error_msgs[16])},
-    {ADF7030_1_PENDING_IO, &(instance_error_msgs[17])},
-    {ADF7030_1_DMA_NOT_SUPPORTED, &(instance_error_msgs[18])}
-};
+static const char phy_error_unknown[] = "HW_ERROR -> undetermined !";
 
+#define NUM_INSTANCE_ERROR (int)( sizeof(instance_error_id) / sizeof(instance_error_id[0]) )
+#define NUM_PHY_ERROR (int)( sizeof(phy_error_id) / sizeof(phy_error_id[0]) )
+#else
+/*!
+   Current error code string ("#Ixx" or "#Pxx", see phy_err_decode.py).\n
+*/
+static char error_code_str[5];
+#endif
 
 /*!
-   PHY Radio error debug array.\n
+   Last error codes ring.\n
 */
-adf7030_1_phy_error_debug_t phy_error_id[NUM_PHY_ERROR] =
-{
-        {0x00, &phy_error_msgs[0]},
-        {0x01, &phy_error_msgs[1]},
-        {0x02, &phy_error_msgs[2]},
-        {0x03, &phy_error_msgs[3]},
-        {0x04, &phy_error_msgs[4]},
-        {0x05, &phy_error_msgs[5]},
-        {0x06, &phy_error_msgs[6]},
-        {0x07, &phy_error_msgs[7]},
-        {0x08, &phy_error_msgs[8]},
-        {0x09, &phy_error_msgs[9]},
-        {0x30, &phy_error_msgs[10]},
-        {0x31, &phy_error_msgs[11]},
-        {0x11, &phy_error_msgs[12]},
-        {0x12, &phy_error_msgs[13]},
-        {0x13, &phy_error_msgs[14]},
-        {0x14, &phy_error_msgs[15]},
-        {0x15, &phy_error_msgs[16]},
-        {0x20, &phy_error_msgs[17]},
-        {0x21, &phy_error_msgs[18]},
-        {0x23, &phy_error_msgs[19]},
-        {0x24, &phy_error_msgs[20]},
-        {0x25, &phy_error_msgs[21]},
-        {0x26, &phy_error_msgs[22]},
-        {0x27, &phy_error_msgs[23]},
-        {0x28, &phy_error_msgs[24]},
-        {0x29, &phy_error_msgs[25]},
-        {0x32, &phy_error_msgs[26]},
-        {0x33, &phy_error_msgs[27]},
-        {0x3F, &phy_error_msgs[28]},
-        {0xFF, &phy_error_msgs[29]}
-};
+static phy_log_err_t aErrRing[PHY_LOG_ERR_RING_NB];
+static uint32_t u32ErrTotal; /*!< Number of errors pushed since the last clear */
 
 /**
  * @brief      Check erroneous return code of the Radio driver functions
@@ -203,6 +112,10 @@ void CheckReturn(adf7030_1_device_t* const pDevice )
     adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
     adf7030_1_res_e eResult = pSPIDevInfo->eXferResult;
     const char *pError = getErrMsg(pDevice);
+#ifdef USE_PHY_LOG_CODE
+    (void)eResult;
+    DBG("[ERR] %s", pError);
+#else
     if(eResult == ADF7030_1_HW_ERROR)
     {
         DBG("[ERR] PHY 0x%02X : %s", pSPIDevInfo->ePhyError, pError);
@@ -210,11 +123,17 @@ void CheckReturn(adf7030_1_device_t* const pDevice )
     else {
         DBG("[ERR] INST 0x%02X : %s", eResult, pError);
     }
+#endif
 }
 
 /**
  * @brief     Get the current error string
  *
+ * @details   With USE_PHY_LOG_CODE, the string is the error code only ("#Ixx"
+ *            for an instance error, "#Pxx" for a PHY Radio hardware error),
+ *            decoded on host by tools/scripts/phy_err_decode.py. It is
+ *            overwritten by the next call.
+ *
 * @param [in] pDevice Pointer to the PHY device info structure
  *
  * @return    Current error string
@@ -223,17 +142,31 @@ const char* getErrMsg(adf7030_1_device_t* const pDevice)
 {
     adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
     adf7030_1_res_e eResult = pSPIDevInfo->eXferResult;
+#ifdef USE_PHY_LOG_CODE
+    static const char hex[] = "0123456789ABCDEF";
+    uint8_t u8Code = (uint8_t)eResult;
 
-    //const char **ppError = instance_error_id[0].instance_error_str;
-    const char **ppError = phy_error_id[29].phy_error_str;
+    error_code_str[0] = '#';
+    error_code_str[1] = 'I';
+    if(eResult == ADF7030_1_HW_ERROR)
+    {
+        u8Code = (uint8_t)pSPIDevInfo->ePhyError;
+        error_code_str[1] = 'P';
+    }
+    error_code_str[2] = hex[u8Code >> 4];
+    error_code_str[3] = hex[u8Code & 0xF];
+    error_code_str[4] = '\0';
+    return (const char*)error_code_str;
+#else
+    const char *pError = phy_error_unknown;
 
     if(eResult == ADF7030_1_HW_ERROR)
     {
         for(int j=0; j < NUM_PHY_ERROR; j++)
         {
-            if(phy_error_id[j].phy_error_id == pSPIDevInfo->ePhyError)
+            if(phy_error_id[j].error_id == pSPIDevInfo->ePhyError)
             {
-                ppError = phy_error_id[j].phy_error_str;
+                pError = phy_error_id[j].error_str;
                 break;
             }
         }
@@ -243,14 +176,97 @@ const char* getErrMsg(adf7030_1_device_t* const pDevice)
         for(int i=0; i < NUM_INSTANCE_ERROR; i++)
         {
             /* Display Instance ERROR message */
-            if(instance_error_id[i].instance_error_id == (uint8_t)eResult)
+            if(instance_error_id[i].error_id == (uint8_t)eResult)
             {
-                ppError = instance_error_id[i].instance_error_str;
+                pError = instance_error_id[i].error_str;
                 break;
             }
         }
     }
-       return (const char*)(*ppError);
+    return pError;
+#endif
+}
+
+/**
+ * @brief     Push the current error in the last error codes ring
+ *
+ * @param [in] pDevice Pointer to the PHY device info structure
+ *
+ * @return    None
+ */
+void PhyLog_ErrPush(adf7030_1_device_t* const pDevice)
+{
+    adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
+    phy_log_err_t *pErr = &(aErrRing[u32ErrTotal % PHY_LOG_ERR_RING_NB]);
+    uint64_t u64Ms = BSP_Rtc_Time_GetEpochMs();
+
+    pErr->u32Time = (uint32_t)(u64Ms / 1000);
+    pErr->u16Ms = (uint16_t)(u64Ms % 1000);
+    pErr->u8Inst = (uint8_t)pSPIDevInfo->eXferResult;
+    pErr->u8Phy = (pSPIDevInfo->eXferResult == ADF7030_1_HW_ERROR)?((uint8_t)pSPIDevInfo->ePhyError):(SM_NOERROR);
+    u32ErrTotal++;
+}
+
+/**
+ * @brief     Get an error from the last error codes ring
+ *
+ * @param [in]  u8Idx Index of the error (0 : the last one)
+ * @param [out] pErr  Pointer on the error
+ *
+ * @retval 0 on success
+ * @retval 1 if there is no such error (or pErr is NULL)
+ */
+uint8_t PhyLog_ErrGet(uint8_t u8Idx, phy_log_err_t *pErr)
+{
+    if ( !pErr || (u8Idx >= PHY_LOG_ERR_RING_NB) || (u8Idx >= u32ErrTotal) )
+    {
+        return 1;
+    }
+    *pErr = aErrRing[(u32ErrTotal - 1 - u8Idx) % PHY_LOG_ERR_RING_NB];
+    return 0;
+}
+
+/**
+ * @brief     Get the number of errors pushed since the last clear
+ *
+ * @return    The number of errors (the ring only keeps the last PHY_LOG_ERR_RING_NB)
+ */
+uint32_t PhyLog_ErrTotal(void)
+{
+    return u32ErrTotal;
+}
+
+/**
+ * @brief     Clear the last error codes ring
+ *
+ * @return    None
+ */
+void PhyLog_ErrClear(void)
+{
+    u32ErrTotal = 0;
+}
+
+/**
+ * @brief     Display the last error codes ring, oldest first
+ *
+ * @details   One "[ERR] <epoch s>.<ms> #Ixx #Pxx" line per error, decoded on
+ *            host by tools/scripts/phy_err_decode.py.
+ *
+ * @return    None
+ */
+void PhyLog_ErrDump(void)
+{
+    phy_log_err_t sErr;
+    uint8_t i = PHY_LOG_ERR_RING_NB;
+
+    while (i--)
+    {
+        if ( PhyLog_ErrGet(i, &sErr) == 0 )
+        {
+            DBG("[ERR] %lu.%03u #I%02X #P%02X\n",
+                (unsigned long)sErr.u32Time, sErr.u16Ms, sErr.u8Inst, sErr.u8Phy);
+        }
+    }
 }
 
 #ifdef __cplusplus
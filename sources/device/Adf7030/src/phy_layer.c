@@ -38,6 +38,7 @@
 extern "C" {
 #endif
 
+#include <string.h>
 #include <bsp.h>
 #include <bsp_pwrlines.h>
 #include "phy_layer_private.h"
@@ -58,6 +59,8 @@ extern "C" {
 
 #include "adf7030-1_phy_conv.h"
 #include "adf7030-1_phy_log.h"
+#include "phy_trace.h"
+#include "phy_stats.h"
 
 #if defined (USE_PHY_LAYER_TRACE)
 #ifndef TRACE_PHY_LAYER
@@ -67,6 +70,61 @@ extern "C" {
 #define TRACE_PHY_LAYER(...)
 #endif
 
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*!
+ * @brief PHY service (interrupt bottom-half) task stack size (in words)
+ */
+#ifndef PHY_SRV_STACK_SIZE
+#define PHY_SRV_STACK_SIZE 400
+#endif
+
+/*!
+ * @brief PHY service (interrupt bottom-half) task priority
+ *
+ * @details The PHY events (pfEvtCb) are notified from this task, no longer
+ * from the frame interrupt : the call-back runs in task context, at this
+ * priority, without the PHY lock (so it could call the PHY interface).
+ */
+#ifndef PHY_SRV_PRIORITY
+#define PHY_SRV_PRIORITY (UBaseType_t)(configMAX_PRIORITIES - 1)
+#endif
+
+/*!
+ * @brief Maximum time (in ms) to wait for a PHY state transition event
+ */
+#ifndef PHY_STATE_WAIT_TMO
+#define PHY_STATE_WAIT_TMO 20
+#endif
+
+/*!
+ * @brief Maximum time (in ms) to wait for the end of PHY calibration event
+ */
+#ifndef PHY_CAL_WAIT_TMO
+#define PHY_CAL_WAIT_TMO 1000
+#endif
+
+/*!
+ * @brief PHY interrupt used to signal the end of a state transition (on INTPIN1)
+ */
+#define PHY_STATE_IRQ_MSK ( SM_IDLE_IRQn_Msk )
+
+/*!
+ * @brief Maximum number of 32 bits writes queued by the TX/RX setup sequence
+ */
+#define PHY_TRX_LIST_NB_WORD 8
+
+/*!
+ * @brief Pre-staged RX states (see adf7030_1_device_t::u8RxStage)
+ */
+enum {
+	RX_STAGE_NONE, /*!< No pre-staged RX */
+	RX_STAGE_REQ,  /*!< Requested, to be written at the TX end of frame */
+	RX_STAGE_DONE, /*!< Written in the PHY, the next RX only has to be started */
+};
+
 // The WM6400 modulation is not natively supported by the ADF7030 and must works in Raw Mode
 
 /*!
@@ -168,21 +226,63 @@ int16_t i16RssiOffsetCal __attribute__(( weak )) = 0;
  * @brief This table hold the WM2400 modulation configuration
  */
 static const uint8_t RF_CFG_WM2400[] = {
-    #include "WM2400_small.cfg"
+    #include "WM2400_small.img"
 };
 
 /*!
  * @brief This table hold the WM4800 modulation configuration
  */
 static const uint8_t RF_CFG_WM4800[] = {
-    #include "WM4800_small.cfg"
+    #include "WM4800_small.img"
 };
 
 /*!
  * @brief This table hold the WM6400 modulation configuration
  */
 static const uint8_t RF_CFG_WM6400[] = {
-    #include "WM6400_small.cfg"
+    #include "WM6400_small.img"
+};
+
+/*!
+ * @brief This table hold the WM2400 to WM4800 delta configuration
+ */
+static const uint8_t RF_DELTA_WM2400_WM4800[] = {
+    #include "WM2400_to_WM4800.img"
+};
+
+/*!
+ * @brief This table hold the WM2400 to WM6400 delta configuration
+ */
+static const uint8_t RF_DELTA_WM2400_WM6400[] = {
+    #include "WM2400_to_WM6400.img"
+};
+
+/*!
+ * @brief This table hold the WM4800 to WM2400 delta configuration
+ */
+static const uint8_t RF_DELTA_WM4800_WM2400[] = {
+    #include "WM4800_to_WM2400.img"
+};
+
+/*!
+ * @brief This table hold the WM4800 to WM6400 delta configuration
+ */
+static const uint8_t RF_DELTA_WM4800_WM6400[] = {
+    #include "WM4800_to_WM6400.img"
+};
+
+/*!
+ * @brief This table hold the WM6400 to WM2400 delta configuration
+ */
+static const uint8_t RF_DELTA_WM6400_WM2400[] = {
+    #include "WM6400_to_WM2400.img"
+};
+
+/*!
+ * @brief This table hold the WM6400 to WM4800 delta configuration
+ */
+static const uint8_t RF_DELTA_WM6400_WM4800[] = {
+    #include "WM6400_to_WM4800.img"
 };
 
 /*!
@@ -196,7 +296,7 @@ static const uint8_t RF_CAL_CFG[] = {
  * @brief This table hold the basis configuration
  */
 static const uint8_t RF_BASE_CFG[] = {
-    #include "WM_base.cfg"
+    #include "WM_base.img"
 };
 
 /*!
@@ -209,6 +309,15 @@ static uint8_t RF_RADIO_CAL[RADIO_CAL_SZ];
  */
 static uint8_t RF_VCO_CAL[VCO_CAL_SZ];
 
+/*!
+ * @brief This table hold the calibration results for several temperatures and
+ * voltages (the one loaded in RF_RADIO_CAL / RF_VCO_CAL is u8CalSel)
+ */
+static phy_cal_entry_t aCalCache[PHY_CAL_CACHE_NB];
+static uint8_t u8CalSel = PHY_CAL_CACHE_NB; /*!< Loaded entry (PHY_CAL_CACHE_NB : none) */
+static cal_env_info_t sCalEnv;              /*!< Current temperature and voltage */
+static uint8_t bCalEnvKnown;                /*!< sCalEnv has been set (PHY_CMD_CAL_ENV) */
+
 /*!
  * @brief This table hidden rf config
  */
@@ -266,8 +375,91 @@ static const cfg_t RF_CFG[PHY_NB_CFG] = {
 	[PHY_CAL_CFG]   = RF_CFG_SETUP( RF_CAL_CFG ),
 	[PHY_HIDDEN]    = RF_CFG_SETUP( RF_HIDDEN ),
 };
+
+/*!
+ * @brief This table hold the delta configuration from one modulation to another
+ */
+static const cfg_t RF_DELTA[PHY_NB_MOD][PHY_NB_MOD] = {
+    [PHY_WM2400] = {
+        [PHY_WM4800] = RF_CFG_SETUP( RF_DELTA_WM2400_WM4800 ),
+        [PHY_WM6400] = RF_CFG_SETUP( RF_DELTA_WM2400_WM6400 ),
+    },
+    [PHY_WM4800] = {
+        [PHY_WM2400] = RF_CFG_SETUP( RF_DELTA_WM4800_WM2400 ),
+        [PHY_WM6400] = RF_CFG_SETUP( RF_DELTA_WM4800_WM6400 ),
+    },
+    [PHY_WM6400] = {
+        [PHY_WM2400] = RF_CFG_SETUP( RF_DELTA_WM6400_WM2400 ),
+        [PHY_WM4800] = RF_CFG_SETUP( RF_DELTA_WM6400_WM4800 ),
+    },
+};
 #undef RF_CFG_SETUP
 
+/*!
+ * @brief No (or unknown) modulation configuration is loaded in the PHY
+ */
+#define PHY_CFG_MOD_NONE 0xFF
+
+/*!
+ * @brief This structure hold the TX power register words of one power entry
+ */
+typedef struct {
+	uint32_t u32TxCfg0; /*!< PROFILE_RADIO_DIG_TX_CFG0 */
+#ifdef PHY_USE_POWER_RAMP
+	uint32_t u32TxCfg1; /*!< PROFILE_RADIO_DIG_TX_CFG1 */
+#endif
+} tx_pwr_word_t;
+
+/*!
+ * @brief This table hold the TX power register words, precomputed for each
+ * aPhyPower entry on top of the modulation profile u8TxPwrMod
+ */
+static tx_pwr_word_t aTxPwrWord[PHY_NB_PWR];
+static uint32_t u32TxCfg0Base;                /*!< Profile TX_CFG0 (PA fields are replaced) */
+#ifdef PHY_USE_POWER_RAMP
+static uint32_t u32TxCfg1Base;                /*!< Profile TX_CFG1 (PA ramp field is replaced) */
+#endif
+static uint8_t u8TxPwrMod = PHY_CFG_MOD_NONE; /*!< Modulation of the base words (PHY_CFG_MOD_NONE : none) */
+
+static uint8_t _cfg_word(const cfg_t *pCfg, uint32_t u32Addr, uint32_t *pu32Word);
+static void _tx_pwr_base(adf7030_1_device_t *pDevice, uint8_t eModulation);
+static void _tx_pwr_build(void);
+
+/*!
+ * @brief Frequency correction (Hz) learned from the AFC error of the received
+ * frames, on top of i16TxFreqOffset (which belongs to the application)
+ */
+static int16_t i16AfcCorr;
+#if defined (USE_PHY_AFC_TRACK)
+static int32_t i32AfcAcc; /*!< Filtered AFC error (Hz) << PHY_AFC_TRACK_SHIFT */
+static uint8_t u8AfcNb;   /*!< Number of filtered frames (up to PHY_AFC_TRACK_MIN_NB) */
+#endif
+
+static uint32_t _ch_freq(phydev_t *pPhydev, uint8_t eCh);
+#if defined (USE_PHY_AFC_TRACK)
+static void _afc_track(phydev_t *pPhydev, uint16_t u16Rssi, uint16_t u16Ferr);
+#define PHY_AFC_TRACK(dev, rssi, ferr) _afc_track(dev, rssi, ferr)
+#else
+#define PHY_AFC_TRACK(dev, rssi, ferr)
+#endif
+
+#if defined (USE_PHY_SCHED)
+#if !defined (USE_PHY_TRIG) || !defined (HAS_HIRES_TIME_MEAS)
+#error "USE_PHY_SCHED requires USE_PHY_TRIG (trigger pin) and HAS_HIRES_TIME_MEAS (time-base)"
+#endif
+static adf7030_1_device_t *pSchedDevice;
+static uint32_t u32SchedTime;            /*!< Scheduled time (HiResTime) */
+static uint8_t bSchedArm;                /*!< The next TX/RX trigger pulse is given by the LPTIM */
+static volatile uint8_t bSchedPend;      /*!< The LPTIM is armed, the pulse is pending */
+static volatile uint32_t u32SchedFired;  /*!< Time of the last pulse (HiResTime), 0 : none */
+
+static int32_t _sched_wait(phy_sched_t *pSched);
+static int32_t _sched(phydev_t *pPhydev, phy_sched_t *pSched);
+static uint8_t _sched_arm(phydev_t *pPhydev);
+static void _sched_cancel(phydev_t *pPhydev);
+static void _sched_it(void);
+#endif
+
 //#define PHY_DEBUG_SPE
 #ifdef PHY_DEBUG_SPE
 profile_t       sProfile;
@@ -297,12 +489,25 @@ static int32_t _uninit(phydev_t *pPhydev);
 static int32_t _do_TX(phydev_t *pPhydev, phy_chan_e eChannel, phy_mod_e eModulation);
 static int32_t _do_RX(phydev_t *pPhydev, phy_chan_e eChannel, phy_mod_e eModulation);
 static int32_t _do_CCA(phydev_t *pPhydev, phy_chan_e eChannel, phy_mod_e eModulation);
+static int32_t _do_LBT(phydev_t *pPhydev, phy_lbt_t *pLbt);
+static int32_t _spi_bench(phydev_t *pPhydev, phy_spi_bench_t *pBench);
+static int32_t _noise_scan(phydev_t *pPhydev, phy_scan_t *pScan);
 
 static int32_t _set_send(phydev_t *pPhydev, uint8_t *pBuf, uint8_t u8Len);
 static int32_t _get_recv(phydev_t *pPhydev, uint8_t *pBuf, uint8_t *u8Len);
 
 static int32_t _ioctl(phydev_t *pPhydev, uint32_t eCtl, uint32_t args);
 
+/*!
+ * @brief PHY lock, serialise the radio accesses (SPI, state commands and
+ * their waits) of the caller tasks and of the PHY service task. Recursive,
+ * an ioctl could execute a TX/RX sequence (e.g. scheduled one).
+ */
+static SemaphoreHandle_t hPhyLock;
+static StaticSemaphore_t xPhyLockBuffer;
+#define PHY_LOCK()   xSemaphoreTakeRecursive(hPhyLock, portMAX_DELAY)
+#define PHY_UNLOCK() xSemaphoreGiveRecursive(hPhyLock)
+
 /*!
  * @brief This structure hold the Phy device interface
  */
@@ -353,6 +558,10 @@ int32_t Phy_adf7030_setup(
     {
         pPhydev->pIf = &_phy_if;
         pPhydev->pCxt = pCtx;
+        if (hPhyLock == NULL)
+        {
+        	hPhyLock = xSemaphoreCreateRecursiveMutexStatic(&xPhyLockBuffer);
+        }
         if ( !(adf7030_1_Setup(
                 pCtx,
                 pINTDevInfo,
@@ -395,7 +604,7 @@ int32_t Phy_GetCal(uint8_t *pBuf)
 			memcpy(p, RF_CFG[PHY_RADIO_CAL].cf, RF_CFG[PHY_RADIO_CAL].size );
 			p += RF_CFG[PHY_RADIO_CAL].size;
 
-	    	if ( *(uint64_t*)(RF_CFG[PHY_RADIO_CAL].cf) == VCO_CAL_HEADER_BE)
+	    	if ( *(uint64_t*)(RF_CFG[PHY_VCO_CAL].cf) == VCO_CAL_HEADER_BE)
 	    	{
 				// Get VCO Calibration from local buffer
 				memcpy(p, RF_CFG[PHY_VCO_CAL].cf, RF_CFG[PHY_VCO_CAL].size );
@@ -425,7 +634,7 @@ int32_t Phy_SetCal(uint8_t *pBuf)
     	if ( *(uint64_t*)(p) == RADIO_CAL_HEADER_BE )
     	{
     		// Set RADIO Calibration to local buffer
-    		memcpy(RF_CFG[PHY_RADIO_CAL].cf, p, RF_CFG[PHY_RADIO_CAL].size );
+    		memcpy((void*)RF_CFG[PHY_RADIO_CAL].cf, p, RF_CFG[PHY_RADIO_CAL].size );
 
     		p += RF_CFG[PHY_RADIO_CAL].size;
 
@@ -433,7 +642,7 @@ int32_t Phy_SetCal(uint8_t *pBuf)
         	if ( *(uint64_t*)(p) == VCO_CAL_HEADER_BE )
         	{
         		// Set VCO Calibration to local buffer
-        		memcpy(RF_CFG[PHY_VCO_CAL].cf, p, RF_CFG[PHY_VCO_CAL].size );
+        		memcpy((void*)RF_CFG[PHY_VCO_CAL].cf, p, RF_CFG[PHY_VCO_CAL].size );
         		eStatus = PHY_STATUS_OK;
         	}
     	}
@@ -451,6 +660,118 @@ inline int32_t Phy_ClrCal(void)
 {
 	*(uint64_t*)(RF_CFG[PHY_RADIO_CAL].cf) = 0x0;
 	*(uint64_t*)(RF_CFG[PHY_VCO_CAL].cf) = 0x0;
+	memset(aCalCache, 0, sizeof(aCalCache));
+	u8CalSel = PHY_CAL_CACHE_NB;
+	return PHY_STATUS_OK;
+}
+
+/*!
+ * @brief  This function Get the calibration cache
+ *
+ * @param [in]  pBuf Pointer to write in the calibration cache (PHY_CAL_CACHE_SZ bytes)
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+int32_t Phy_GetCalCache(uint8_t *pBuf)
+{
+	if (pBuf == NULL)
+	{
+		return PHY_STATUS_ERROR;
+	}
+	memcpy(pBuf, aCalCache, sizeof(aCalCache));
+	return PHY_STATUS_OK;
+}
+
+/*!
+ * @brief  This function Set the calibration cache
+ *
+ * @details Entries that don't (seem to) hold valid calibration data are cleared.
+ *
+ * @param [in]  pBuf Pointer on the calibration cache to set (PHY_CAL_CACHE_SZ bytes)
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+int32_t Phy_SetCalCache(uint8_t *pBuf)
+{
+	uint8_t i;
+	if (pBuf == NULL)
+	{
+		return PHY_STATUS_ERROR;
+	}
+	memcpy(aCalCache, pBuf, sizeof(aCalCache));
+	for (i = 0; i < PHY_CAL_CACHE_NB; i++)
+	{
+		if ( (aCalCache[i].u8Seq > PHY_CAL_CACHE_NB) ||
+			 ( *(uint64_t*)(aCalCache[i].aCalRes) != RADIO_CAL_HEADER_BE ) ||
+			 ( *(uint64_t*)(&(aCalCache[i].aCalRes[RADIO_CAL_SZ])) != VCO_CAL_HEADER_BE ) )
+		{
+			memset(&(aCalCache[i]), 0, sizeof(phy_cal_entry_t));
+		}
+	}
+	u8CalSel = PHY_CAL_CACHE_NB;
+	return PHY_STATUS_OK;
+}
+
+/*!
+ * @brief  This function Set the TX power table
+ *
+ * @details The TX power register words are built again from it, so the next
+ * power change is a single write.
+ *
+ * @param [in]  pPwr Pointer on the TX power table to set (PHY_NB_PWR entries)
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+int32_t Phy_SetPower(const phy_power_t *pPwr)
+{
+	if (pPwr == NULL)
+	{
+		return PHY_STATUS_ERROR;
+	}
+	memcpy(aPhyPower, pPwr, sizeof(phy_power_t)*PHY_NB_PWR);
+	_tx_pwr_build();
+	return PHY_STATUS_OK;
+}
+
+/*!
+ * @brief  This function Get the AFC frequency correction
+ *
+ * @return The frequency correction (Hz), added to the TX and RX channel frequency
+ *
+ */
+int16_t Phy_GetAfcCorr(void)
+{
+	return i16AfcCorr;
+}
+
+/*!
+ * @brief  This function Set the AFC frequency correction
+ *
+ * @details The AFC tracking (if any) restart from it. It takes effect on the
+ * next TX or RX.
+ *
+ * @param [in]  i16Corr The frequency correction (Hz, within +/-PHY_AFC_CORR_MAX)
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+int32_t Phy_SetAfcCorr(int16_t i16Corr)
+{
+	if ( (i16Corr > PHY_AFC_CORR_MAX) || (i16Corr < -PHY_AFC_CORR_MAX) )
+	{
+		return PHY_STATUS_ERROR;
+	}
+	i16AfcCorr = i16Corr;
+#if defined (USE_PHY_AFC_TRACK)
+	u8AfcNb = 0;
+#endif
 	return PHY_STATUS_OK;
 }
 
@@ -474,13 +795,78 @@ inline int32_t Phy_ClrCal(void)
 // Internal private function
 static int32_t _ready_seq(phydev_t *pPhydev);
 static int32_t _sleep_seq(phydev_t *pPhydev);
-static int32_t _trx_seq(phydev_t *pPhydev);
+static int32_t _trx_seq(phydev_t *pPhydev, uint8_t eCmd);
 static int32_t _test_seq(phydev_t *pPhydev, test_modes_tx_e eTxMode);
 static int32_t _auto_calibrate_seq(phydev_t *pPhydev);
 static int32_t _rssi_calibrate_seq(phydev_t *pPhydev, int8_t i8RssiRefLevel);
+static int32_t _cal_env_seq(phydev_t *pPhydev, cal_env_info_t sEnv);
+static int32_t _cal_env_upd(phydev_t *pPhydev, cal_env_info_t sEnv);
+static int32_t _meas_temp(phydev_t *pPhydev, int8_t *pi8Temp);
+static uint8_t _cal_nearest(uint8_t *pbClose);
+static void _cal_pick(void);
+static void _cal_store(void);
 static int32_t _do_cmd(phydev_t *pPhydev, uint8_t eCmd);
 static void _frame_it(void *p_CbParam, void *p_Arg);
+static uint32_t _frame_process(phydev_t *pPhydev);
+static uint32_t _rx_cont_next(phydev_t *pPhydev);
+static void _rx_stage(phydev_t *pPhydev);
+static uint8_t _rx_staged(phydev_t *pPhydev);
+static phy_rx_frame_t* _rx_pool_peek(void);
+static void _rx_pool_free(void);
+static void _srv_task(void const *argument);
 static void _instrum_it(void *p_CbParam, void *p_Arg);
+#if defined (USE_PHY_TIME_TRACE)
+static void _trace_cb(void *p_TraceParam, uint8_t u8Evt, uint32_t u32Arg);
+#endif
+
+/*!
+ * @brief PHY service task, handle the frame interrupt (SPI access and event notification)
+ */
+static TaskHandle_t hPhySrvTask;
+static StaticTask_t xPhySrvTaskBuffer;
+static StackType_t xPhySrvTaskStack[PHY_SRV_STACK_SIZE];
+
+/*!
+ * @brief Transaction list buffer of the TX/RX setup sequence
+ */
+static uint8_t aTrxListBuff[PHY_TRX_LIST_NB_WORD * ADF7030_1_TRX_LIST_WORD_SIZE];
+
+#if (PHY_RX_POOL_NB & (PHY_RX_POOL_NB - 1)) || (PHY_RX_POOL_NB > 128)
+#error "PHY_RX_POOL_NB must be a power of 2, up to 128"
+#endif
+/*!
+ * @brief Received frame pool (continuous RX). Slots are filled by the PHY
+ * service task and freed by the reader, so the counters are never written by
+ * both sides.
+ */
+static phy_rx_frame_t aRxPool[PHY_RX_POOL_NB];
+static uint8_t u8RxPoolIn;    /*!< Number of filled slots (service task) */
+static uint8_t u8RxPoolOut;   /*!< Number of freed slots (reader) */
+static uint32_t u32RxPoolDrop; /*!< Number of frames dropped (pool full) */
+#if defined (USE_PHY_IRQ_WAIT)
+static uint8_t _state_wait(void *p_WaitParam, uint32_t u32Timeout);
+
+/*!
+ * @brief Semaphore given from INTPIN1 when the PHY state transition is completed
+ */
+static SemaphoreHandle_t hPhyWaitSem;
+static StaticSemaphore_t xPhyWaitSemBuffer;
+#endif
+
+#if defined (USE_SPI_DMA)
+static void _xfer_it(void *p_CbParam, uint32_t evt);
+static uint8_t _xfer_wait(void *p_WaitParam, uint32_t u32Timeout);
+
+/*!
+ * @brief Semaphore given from the DMA SPI transfer end interrupt
+ */
+static SemaphoreHandle_t hPhyXferSem;
+static StaticSemaphore_t xPhyXferSemBuffer;
+/*!
+ * @brief Last DMA SPI transfer event (see spi_evt_e)
+ */
+static volatile uint32_t u32PhyXferEvt;
+#endif
 
 /*!
  * @static
@@ -501,10 +887,11 @@ static int32_t _init(phydev_t *pPhydev)
     adf7030_1_gpio_int_info_t *pIntGPIOInfo = pDevice->IntGPIOInfo;
     if(pPhydev)
     {
+    	PHY_LOCK();
 		// private parameters
     	pDevice->bCfgDone = 0;
+    	pDevice->u8CfgMod = PHY_CFG_MOD_NONE;
     	pDevice->bCrcOn = 0;
-    	pDevice->bTxPwrDone = 0;
     	pDevice->u8PendTXBuffSize = 0;
 		if( !(adf7030_1_Init( pDevice, &spi_ADF7030 )) )
 		{
@@ -524,9 +911,46 @@ static int32_t _init(phydev_t *pPhydev)
 			// FIXME : set the CAL headers
 			*(uint64_t*)(RF_CFG[PHY_RADIO_CAL].cf) = 0x0;
 			*(uint64_t*)(RF_CFG[PHY_VCO_CAL].cf) = 0x0;
+			// No cached entry loaded : the next ready sequence picks it again
+			u8CalSel = PHY_CAL_CACHE_NB;
 
+			if (hPhySrvTask == NULL)
+			{
+				hPhySrvTask = xTaskCreateStatic(
+						(TaskFunction_t)&_srv_task, "phy_srv",
+						PHY_SRV_STACK_SIZE, (void*)pPhydev, PHY_SRV_PRIORITY,
+						xPhySrvTaskStack, &xPhySrvTaskBuffer);
+			}
 			pIntGPIOInfo[ADF7030_1_INTPIN0].pfIntCb = &_frame_it;
+#if defined (USE_PHY_IRQ_WAIT)
+			if (hPhyWaitSem == NULL)
+			{
+				hPhyWaitSem = xSemaphoreCreateBinaryStatic(&xPhyWaitSemBuffer);
+			}
+			pIntGPIOInfo[ADF7030_1_INTPIN1].pfIntCb = &_instrum_it;
+			pDevice->SPIInfo.pfPhyWaitCb = &_state_wait;
+			pDevice->SPIInfo.pPhyWaitParam = (void*)pPhydev;
+#else
 			pIntGPIOInfo[ADF7030_1_INTPIN1].pfIntCb = NULL; //&_instrum_it;
+#endif
+#if defined (USE_SPI_DMA)
+			if (hPhyXferSem == NULL)
+			{
+				hPhyXferSem = xSemaphoreCreateBinaryStatic(&xPhyXferSemBuffer);
+			}
+			BSP_Spi_SetCallback(pDevice->SPIInfo.hSPIDevice, &_xfer_it, (void*)pPhydev);
+			pDevice->SPIInfo.pfXferWaitCb = &_xfer_wait;
+			pDevice->SPIInfo.pXferWaitParam = (void*)pPhydev;
+#endif
+#if defined (USE_PHY_TIME_TRACE)
+			PhyTrace_Init();
+			pDevice->SPIInfo.pfTraceCb = &_trace_cb;
+			pDevice->SPIInfo.pTraceParam = (void*)pPhydev;
+#endif
+#if defined (USE_PHY_SCHED)
+			pSchedDevice = pDevice;
+			BSP_LpTimer_SetHandler(PHY_SCHED_LPTIM_ID, &_sched_it);
+#endif
 			i32Ret = PHY_STATUS_OK;
 			for (u8i =0; u8i < 2; u8i++)
 			{
@@ -553,6 +977,7 @@ static int32_t _init(phydev_t *pPhydev)
 				adf7030_1__IRQ_GetMap(pDevice, ADF7030_1_INTPIN1);
 			}
 		}
+		PHY_UNLOCK();
     }
     return i32Ret;
 }
@@ -575,6 +1000,7 @@ static int32_t _uninit(phydev_t *pPhydev)
     uint8_t u8i;
     if(pPhydev)
     {
+    	PHY_LOCK();
     	i32Ret = PHY_STATUS_OK;
 		 /* Clear and disable adf7030 interrupt */
 		for (u8i = 0; u8i < ADF7030_1_NUM_INT_PIN; u8i++)
@@ -592,10 +1018,11 @@ static int32_t _uninit(phydev_t *pPhydev)
 
 		if (!i32Ret) {
 			pDevice->bCfgDone = 0;
+			pDevice->u8CfgMod = PHY_CFG_MOD_NONE;
 			pDevice->bCrcOn = 0;
-			pDevice->bTxPwrDone = 0;
 			pDevice->u8PendTXBuffSize = 0;
 		}
+		PHY_UNLOCK();
     }
     return i32Ret;
 }
@@ -644,7 +1071,7 @@ static int32_t _ready_seq(phydev_t *pPhydev)
 			if ( pDevice->bCfgDone == 0 )
 			{
 				// yes, switch to PHY_OFF state
-				eRet |= adf7030_1__STATE_PhyCMD_WaitReady(pSPIDevInfo, PHY_OFF, PHY_OFF);
+				eRet |= adf7030_1__STATE_PhyCMD_WaitIrq(pSPIDevInfo, PHY_OFF, PHY_OFF, PHY_STATE_WAIT_TMO);
 			}
 			break;
 		case PHY_OFF:
@@ -657,16 +1084,29 @@ static int32_t _ready_seq(phydev_t *pPhydev)
 	switch (pSPIDevInfo->nPhyState)
 	{
 		case PHY_SLEEP:
-			// will wake-up, so need to CFG_DEV
-			pDevice->eState &= ~ADF7030_1_STATE_CONFIGURED;
+			PHY_TIME_TRACE(PHY_TRACE_WAKEUP, 0);
 			// Wake up
 			eRet |= adf7030_1_PulseWakup(pDevice);
-			// reinitialize the PNTR pointers
+			// reinitialize the PNTR pointers (SPI host registers are not retained)
 			eRet |= adf7030_1__SPI_GetMMapPointers(pSPIDevInfo);
-			// switch to PHY_OFF
-			eRet |= adf7030_1__STATE_PhyCMD_WaitReady(pSPIDevInfo, PHY_OFF, PHY_OFF);
-			//eRet |= adf7030_1__SendConfiguration( pSPIDevInfo, RF_CFG[PHY_BASE_CFG].cf, RF_CFG[PHY_BASE_CFG].size);
-			eRet |= adf7030_1__SendConfiguration( pSPIDevInfo, RF_CFG[PHY_HIDDEN].cf, RF_CFG[PHY_HIDDEN].size);
+			// Was the SRAM (base configuration, profile) lost during sleep ?
+			if ( !(pDevice->eState & ADF7030_1_STATE_INITIALIZED) )
+			{
+				// yes, so it restarts as from reset (no profile to apply a delta on)
+				pDevice->u8CfgMod = PHY_CFG_MOD_NONE;
+				eRet |= adf7030_1__SendConfigImage( pSPIDevInfo, RF_CFG[PHY_BASE_CFG].cf, RF_CFG[PHY_BASE_CFG].size);
+				eRet |= adf7030_1__STATE_PhyCMD_WaitReady(pSPIDevInfo, CFG_DEV, PHY_OFF);
+				if (!eRet)
+				{
+					pDevice->eState |= ADF7030_1_STATE_INITIALIZED;
+				}
+			}
+			else
+			{
+				// no, switch to PHY_OFF
+				eRet |= adf7030_1__STATE_PhyCMD_WaitReady(pSPIDevInfo, PHY_OFF, PHY_OFF);
+			}
+			eRet |= adf7030_1__SendConfigImage( pSPIDevInfo, RF_CFG[PHY_HIDDEN].cf, RF_CFG[PHY_HIDDEN].size);
 			if(eRet)
 			{
 				break;
@@ -675,20 +1115,33 @@ static int32_t _ready_seq(phydev_t *pPhydev)
 			// Does it need a full configuration ?
 			if ( pDevice->bCfgDone == 0 )
 			{
-				// Yes, load the configuration file
-				eRet |= adf7030_1__SendConfiguration( pSPIDevInfo, RF_CFG[pPhydev->eModulation].cf, RF_CFG[pPhydev->eModulation].size);
+				if ( (pDevice->u8CfgMod < PHY_NB_MOD) && (pDevice->u8CfgMod != pPhydev->eModulation) )
+				{
+					// Only a modulation switch, load the differing words. The delta
+					// relies on the PHY still holding the u8CfgMod image : any reset,
+					// cold sleep or failed sequence drops u8CfgMod first.
+					eRet |= adf7030_1__SendConfigImage( pSPIDevInfo, RF_DELTA[pDevice->u8CfgMod][pPhydev->eModulation].cf, RF_DELTA[pDevice->u8CfgMod][pPhydev->eModulation].size);
+				}
+				else
+				{
+					// Yes, load the configuration file
+					eRet |= adf7030_1__SendConfigImage( pSPIDevInfo, RF_CFG[pPhydev->eModulation].cf, RF_CFG[pPhydev->eModulation].size);
+				}
+				pDevice->u8CfgMod = (eRet)?(PHY_CFG_MOD_NONE):(pPhydev->eModulation);
 				if (!eRet)
 				{
 					pDevice->eState &= ~ADF7030_1_STATE_CONFIGURED;
 				}
 
+				// Take the cached calibration nearest to the current temperature and voltage (if any)
+				_cal_pick();
 				// Check if calibration data are set or not
 				if (*(uint64_t*)(RF_CFG[PHY_RADIO_CAL].cf) != 0x0 )
 				{
 					// send calibration RADIO and VCO
-					if ( !(adf7030_1__SendConfiguration( pSPIDevInfo, RF_CFG[PHY_RADIO_CAL].cf, RF_CFG[PHY_RADIO_CAL].size)) )
+					if ( !(adf7030_1__SendConfigImage( pSPIDevInfo, RF_CFG[PHY_RADIO_CAL].cf, RF_CFG[PHY_RADIO_CAL].size)) )
 					{
-						if ( !(adf7030_1__SendConfiguration( pSPIDevInfo, RF_CFG[PHY_VCO_CAL].cf, RF_CFG[PHY_VCO_CAL].size)) )
+						if ( !(adf7030_1__SendConfigImage( pSPIDevInfo, RF_CFG[PHY_VCO_CAL].cf, RF_CFG[PHY_VCO_CAL].size)) )
 						{
 							pDevice->eState |= ADF7030_1_STATE_CALIBRATED;
 						}
@@ -700,7 +1153,7 @@ static int32_t _ready_seq(phydev_t *pPhydev)
 			if ( !(pDevice->eState & ADF7030_1_STATE_CONFIGURED) )
 			{
 				// yes, switch to CFG_DEV, then PHY_OFF (automatic goes back)
-				eRet |= adf7030_1__STATE_PhyCMD_WaitReady(pSPIDevInfo, CFG_DEV, PHY_OFF);
+				eRet |= adf7030_1__STATE_PhyCMD_WaitIrq(pSPIDevInfo, CFG_DEV, PHY_OFF, PHY_STATE_WAIT_TMO);
 				if (!eRet)
 				{
 					pDevice->bCfgDone = 1;
@@ -708,7 +1161,7 @@ static int32_t _ready_seq(phydev_t *pPhydev)
 				}
 			}
 			// switch to PHY_ON, ...it is ready
-			eRet |= adf7030_1__STATE_PhyCMD_WaitReady(pSPIDevInfo, PHY_ON, PHY_ON);
+			eRet |= adf7030_1__STATE_PhyCMD_WaitIrq(pSPIDevInfo, PHY_ON, PHY_ON, PHY_STATE_WAIT_TMO);
 		case PHY_ON : // CFG_DEV or PHY_ON without requiring full configuration
 		case CFG_DEV :
 			break;
@@ -725,12 +1178,15 @@ static int32_t _ready_seq(phydev_t *pPhydev)
 	{
 		// enable to communicate with the PHY
 		eStatus = PHY_STATUS_ERROR;
+		// The PHY content is unknown (e.g. failed wake-up) : next time, load the full image
+		pDevice->u8CfgMod = PHY_CFG_MOD_NONE;
 		/* Notice that, at this point :
 		 *  - pDevice->eState has ADF7030_1_STATE_READY not set
 		 *  - pDevice->eState could has ADF7030_1_STATE_CONFIGURED not set
 		 *  - pDevice->bCfgDone could be 0
 		 */
 	}
+	PHY_TIME_TRACE(PHY_TRACE_READY, (eRet)?(1):(0));
 	return eStatus;
 }
 
@@ -766,8 +1222,17 @@ static int32_t _sleep_seq(phydev_t *pPhydev)
 		case PHY_ON:
 			// of course, not ready anymore
 			pDevice->eState &= ~ADF7030_1_STATE_READY;
-			// nor configured
-			pDevice->eState &= ~ADF7030_1_STATE_CONFIGURED;
+			if (pDevice->bColdSleep)
+			{
+				// Lowest current : don't retain the SRAM, so all is lost on wake-up
+				eRet |= adf7030_1__SetupLPM(pSPIDevInfo, 0);
+				pDevice->eState &= ~(ADF7030_1_STATE_INITIALIZED | ADF7030_1_STATE_CONFIGURED | ADF7030_1_STATE_CALIBRATED);
+				pDevice->bCfgDone = 0;
+				pDevice->u8CfgMod = PHY_CFG_MOD_NONE;
+				pDevice->bCrcOn = 0;
+			}
+			// else, fast wake-up : the base configuration retains the SRAM (LPM_CFG0),
+			// so the profile, calibration and shadow registers are still valid on wake-up
 			pSPIDevInfo->nPhyNextState = PHY_SLEEP;
 			eRet |= adf7030_1__STATE_PhyCMD( pSPIDevInfo, pSPIDevInfo->nPhyNextState );
 			if (!eRet)
@@ -789,92 +1254,115 @@ static int32_t _sleep_seq(phydev_t *pPhydev)
  * @brief  This function implement the transmission/reception sequence
  *
  * @param [in]  pPhydev Pointer on the Phy device instance
+ * @param [in]  eCmd    Command to prepare (PHY_CMD_TX, PHY_CMD_RX or PHY_CMD_CCA)
  *
  * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
  * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
  * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
  *
  */
-static int32_t _trx_seq(phydev_t *pPhydev)
+static int32_t _trx_seq(phydev_t *pPhydev, uint8_t eCmd)
 {
 	int32_t eStatus = PHY_STATUS_OK;
 	uint8_t eRet = 0;
     adf7030_1_device_t* pDevice = pPhydev->pCxt;
     adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
+	adf7030_1_trx_list_t sTrxList;
 	// It must be set to READY before
 	if(pDevice->eState & ADF7030_1_STATE_READY)
 	{
 		if( ! (pDevice->eState & ADF7030_1_STATE_BUSY) )
 		{
+			// Overwrite the pre-staged RX setup (if any)
+			if (pDevice->u8RxStage == RX_STAGE_DONE)
+			{
+				pDevice->u8RxStage = RX_STAGE_NONE;
+			}
+			// SPI writes are queued, then sent in as few frames as possible
+			adf7030_1__TRX_Init(&sTrxList, aTrxListBuff, sizeof(aTrxListBuff));
+
 			// Need to update CRC ?
 			if ( pDevice->bCrcOn != pPhydev->bCrcOn )
 			{
 				// Configure CRC
 				frame_cfg0_t frame_cfg0;
-				frame_cfg0 = (frame_cfg0_t)(adf7030_1__SPI_GetMem32(pSPIDevInfo, GENERIC_PKT_FRAME_CFG0_Addr));
+				frame_cfg0 = (frame_cfg0_t)(adf7030_1__SHADOW_Get(pDevice, ADF7030_1_SHADOW_FRAME_CFG0));
 				frame_cfg0.FRAME_CFG0_b.CRC_LEN = pPhydev->bCrcOn*16;
-				adf7030_1__SPI_SetMem32(pSPIDevInfo, GENERIC_PKT_FRAME_CFG0_Addr, frame_cfg0.FRAME_CFG0);
+				eRet |= adf7030_1__SHADOW_Queue(pDevice, &sTrxList, ADF7030_1_SHADOW_FRAME_CFG0, frame_cfg0.FRAME_CFG0);
 				pDevice->bCrcOn = pPhydev->bCrcOn;
 			}
 
-			// Need to update TX Power ?
-			if ( !(pDevice->bTxPwrDone) )
-			{
-				// Change TX Power
-				// PA_Coarse in {1 to 6}
-				// PA_Fine in {0, 3 to 127}
-				// PA_Micro in {1 to 31}
-				radio_dig_tx_cfg0_t tx_cfg0;
-				tx_cfg0 = (radio_dig_tx_cfg0_t)(adf7030_1__SPI_GetMem32(pSPIDevInfo, PROFILE_RADIO_DIG_TX_CFG0_Addr));
-				// Setup PA1 power
-				tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_COARSE = aPhyPower[pPhydev->eTxPower].coarse;
-				tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_FINE = aPhyPower[pPhydev->eTxPower].fine;
-				tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_MICRO = aPhyPower[pPhydev->eTxPower].micro;
-				adf7030_1__SPI_SetMem32(pSPIDevInfo, PROFILE_RADIO_DIG_TX_CFG0_Addr, tx_cfg0.RADIO_DIG_TX_CFG0);
-				// Change TX power ramp
-#ifdef PHY_USE_POWER_RAMP
-				radio_dig_tx_cfg1_t tx_cfg1;
-				tx_cfg1 = (radio_dig_tx_cfg1_t)(adf7030_1__SPI_GetMem32(pSPIDevInfo, PROFILE_RADIO_DIG_TX_CFG1_Addr));
-				tx_cfg1.RADIO_DIG_TX_CFG1_b.PA_RAMP_RATE = pa_ramp_rate;
-				adf7030_1__SPI_SetMem32(pSPIDevInfo, PROFILE_RADIO_DIG_TX_CFG1_Addr, tx_cfg1.RADIO_DIG_TX_CFG1);
-#endif
-				pDevice->bTxPwrDone = 1;
+			// Set the payload length (contiguous to FRAME_CFG0)
+			if (eCmd == PHY_CMD_TX)
+			{
+				uint32_t u32Sz = pDevice->u8PendTXBuffSize;
+				if (pPhydev->eModulation == PHY_WM6400)
+				{
+					// from here, configuration for WM6400 has been done (set in CFG file)
+					// - raw mode is already selected
+					// - CRC is disable
+					// - PREAMBLE and SYNC word are set in the TX packet buffer
+					// - adjust the TX buffer address (offset)
+					// So, to take into account PREAMBLE and SYNCHRO words :
+					// - adjust the payload length
+					u32Sz += (PHY_WM6400_PREAMBLE_SIZE/8) + (PHY_WM6400_SYNC_WORD_SIZE/8);
+				}
+				frame_cfg1_t frame_cfg1;
+				frame_cfg1 = (frame_cfg1_t)(adf7030_1__SHADOW_Get(pDevice, ADF7030_1_SHADOW_FRAME_CFG1));
+				frame_cfg1.FRAME_CFG1_b.PAYLOAD_SIZE = u32Sz;
+				eRet |= adf7030_1__SHADOW_Queue(pDevice, &sTrxList, ADF7030_1_SHADOW_FRAME_CFG1, frame_cfg1.FRAME_CFG1);
+				pDevice->u8PendTXBuffSize = 0;
 			}
 
-			// Change frequency
-			uint32_t u32_Freq = PHY_FREQUENCY_CH(pPhydev->eChannel);
-			// only for TX
-			u32_Freq += pPhydev->i16TxFreqOffset;
-			adf7030_1__SPI_SetMem32( pSPIDevInfo, PROFILE_CH_FREQ_Addr, u32_Freq);
-
-			// Enable / Disable interrupt
+			// Enable / Disable interrupt (type is set in FRAME_CFG1)
 			if (pPhydev->eTestMode == PHY_TST_MODE_NONE)
 			{
 				// Need to update interrupt on PREMBLE and SYNC ?
 				if(pPhydev->bPreSyncOn)
 				{
-					// if not set
-					//if( !(pDevice->IntGPIOInfo[ADF7030_1_INTPIN0].nIntMap & (PREAMBLE_IRQn_Msk | SYNCWORD_IRQn_Msk)) )
-					{
-						eRet |= adf7030_1__IRQ_SetMap(pDevice, ADF7030_1_INTPIN0, (uint32_t)(PREAMBLE_IRQn_Msk | SYNCWORD_IRQn_Msk | EOF_IRQn_Msk));
-						eRet |= adf7030_1__IRQ_ClrStatus(pDevice, ADF7030_1_INTPIN0, 0xFFFFFFFF);
-					}
-					// else, already set
+					eRet |= adf7030_1__IRQ_QueueMap(pDevice, &sTrxList, ADF7030_1_INTPIN0, (uint32_t)(PREAMBLE_IRQn_Msk | SYNCWORD_IRQn_Msk | EOF_IRQn_Msk));
 				}
 				else {
-					// if set
-					//if( (pDevice->IntGPIOInfo[ADF7030_1_INTPIN0].nIntMap & (PREAMBLE_IRQn_Msk | SYNCWORD_IRQn_Msk)) )
-					{
-						eRet |= adf7030_1__IRQ_SetMap(pDevice, ADF7030_1_INTPIN0, (uint32_t)EOF_IRQn_Msk);
-						eRet |= adf7030_1__IRQ_ClrStatus(pDevice, ADF7030_1_INTPIN0, 0xFFFFFFFF);
-					}
-					// else, already unset
+					eRet |= adf7030_1__IRQ_QueueMap(pDevice, &sTrxList, ADF7030_1_INTPIN0, (uint32_t)EOF_IRQn_Msk);
 				}
 			}
 			else
 			{
 				// disable interrupt
-				eRet |= adf7030_1__IRQ_SetMap(pDevice, ADF7030_1_INTPIN0, (uint32_t)0x0);
+				eRet |= adf7030_1__IRQ_QueueMap(pDevice, &sTrxList, ADF7030_1_INTPIN0, (uint32_t)0x0);
+			}
+
+			// Set TX Power : precomputed words, nothing is queued if the PHY
+			// already holds them (a configuration load invalidates the shadow)
+			if (u8TxPwrMod != pPhydev->eModulation)
+			{
+				_tx_pwr_base(pDevice, pPhydev->eModulation);
+			}
+			eRet |= adf7030_1__SHADOW_Queue(pDevice, &sTrxList, ADF7030_1_SHADOW_TX_CFG0, aTxPwrWord[pPhydev->eTxPower].u32TxCfg0);
+			// Change TX power ramp
+#ifdef PHY_USE_POWER_RAMP
+			eRet |= adf7030_1__SHADOW_Queue(pDevice, &sTrxList, ADF7030_1_SHADOW_TX_CFG1, aTxPwrWord[pPhydev->eTxPower].u32TxCfg1);
+#endif
+
+			// Change frequency
+			uint32_t u32_Freq = _ch_freq(pPhydev, pPhydev->eChannel);
+			eRet |= adf7030_1__SHADOW_Queue( pDevice, &sTrxList, ADF7030_1_SHADOW_CH_FREQ, u32_Freq);
+
+			// Clear pending interrupt
+			if (pPhydev->eTestMode == PHY_TST_MODE_NONE)
+			{
+				eRet |= adf7030_1__IRQ_QueueClrStatus(pDevice, &sTrxList, ADF7030_1_INTPIN0, 0xFFFFFFFF);
+			}
+
+			// Send all
+			if(eRet)
+			{
+				// Queued values are no longer trusted
+				adf7030_1__SHADOW_Invalidate(pDevice);
+			}
+			else
+			{
+				eRet |= adf7030_1__TRX_Exec(pDevice, &sTrxList);
 			}
 #ifdef PHY_DEBUG_SPE
 			eRet = adf7030_1__ReadDataBlock(pSPIDevInfo, &(sConfig.BLOCKS[0]));
@@ -932,8 +1420,8 @@ static int32_t _test_seq(phydev_t *pPhydev, test_modes_tx_e eTxMode)
 			test_modes0.TEST_MODES0_b.PER_EN = 0;
 			test_modes0.TEST_MODES0_b.PER_IRQ_SELF_CLEAR = 0;
 			test_modes0.TEST_MODES0_b.TX_TEST = 0;
-			pDevice->bTxPwrDone = 0;
 			pDevice->bCfgDone = 0;
+			pDevice->u8CfgMod = PHY_CFG_MOD_NONE;
 		}
 		else
 		{
@@ -960,10 +1448,10 @@ static int32_t _test_seq(phydev_t *pPhydev, test_modes_tx_e eTxMode)
 
 					// Set TICK_RATE to 1 and DETECTION_TIME to 0
 					cca_cfg_t cca_cfg;
-					cca_cfg = (cca_cfg_t)(adf7030_1__SPI_GetMem32(pSPIDevInfo, PROFILE_CCA_CFG_Addr));
+					cca_cfg = (cca_cfg_t)(adf7030_1__SHADOW_Get(pDevice, ADF7030_1_SHADOW_CCA_CFG));
 					cca_cfg.CCA_CFG_b.TICK_RATE = 1;
 					cca_cfg.CCA_CFG_b.DETECTION_TIME = 0;
-					adf7030_1__SPI_SetMem32(pSPIDevInfo, PROFILE_CCA_CFG_Addr, cca_cfg.CCA_CFG);
+					adf7030_1__SHADOW_Set(pDevice, ADF7030_1_SHADOW_CCA_CFG, cca_cfg.CCA_CFG);
 				}
 			}
 			else
@@ -1017,13 +1505,68 @@ static int32_t _test_seq(phydev_t *pPhydev, test_modes_tx_e eTxMode)
 }
 
 /*!
- * @brief  This function implement the calibration sequence
+ * @brief Maximum data size of one offline calibration patch record
+ */
+#define PHY_CAL_PATCH_BLK_SZ 128
+
+/*!
+ * @static
+ * @brief  This function load the offline calibration patch, then verify it
  *
- * @param [in]  pPhydev Pointer on the Phy device instance
+ * @details The patch comes as a configuration image (OfflineCalibrations.cfg) :
+ * each of its block write records is converted into a one block patch and
+ * loaded in turn. It has neither information nor selfcheck block, so it can't
+ * be verified by the on-chip CRC.
  *
- * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
- * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
- * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ * @param [in]  pSPIDevInfo Pointer on the SPI device info structure
+ * @param [in]  pCfg        Pointer on the patch configuration image
+ * @param [in]  u32Size     Size of the patch configuration image
+ * @param [in]  eVerify     Verification mode (ADF7030_1_VERIFY_NONE or ADF7030_1_VERIFY_READBACK)
+ *
+ * @retval 0 Success
+ * @retval 1 Malformed record, transfer or verification failure
+ *
+ */
+static uint8_t _cal_patch_load(adf7030_1_spi_info_t* pSPIDevInfo, const uint8_t *pCfg, uint32_t u32Size, adf7030_1_verify_e eVerify)
+{
+	static uint32_t aData[PHY_CAL_PATCH_BLK_SZ/4];
+	static patch_desc_t sPatch = {
+		.Name = "OfflineCal",
+		.nbBlock = 1,
+		// No information, nor selfcheck block
+		.InfoBlockId = 1,
+		.CheckBlockId = 1,
+		.pChecksum = NULL,
+		.BLOCKS = { { .pData = (const uint8_t*)aData } }
+	};
+	uint32_t u32Pos = 0;
+	uint32_t u32Len;
+
+	while (u32Pos < u32Size)
+	{
+		u32Len = ((uint32_t)pCfg[u32Pos] << 16) | ((uint32_t)pCfg[u32Pos+1] << 8) | pCfg[u32Pos+2];
+		if ( (u32Len <= 8) || (u32Len > PHY_CAL_PATCH_BLK_SZ + 8) || (u32Pos + u32Len > u32Size) )
+		{
+			return 1;
+		}
+		if ( adf7030_1__ConvConfig(&pCfg[u32Pos], u32Len, sPatch.BLOCKS, 0) ||
+		     adf7030_1__LoadPatch(pSPIDevInfo, &sPatch, eVerify, PHY_OFF, PHY_OFF) )
+		{
+			return 1;
+		}
+		u32Pos += u32Len;
+	}
+	return 0;
+}
+
+/*!
+ * @brief  This function implement the calibration sequence
+ *
+ * @param [in]  pPhydev Pointer on the Phy device instance
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
  *
  */
 static int32_t _auto_calibrate_seq(phydev_t *pPhydev)
@@ -1046,25 +1589,30 @@ static int32_t _auto_calibrate_seq(phydev_t *pPhydev)
 		// device must be in PHY_OFF state
 		eRet |= adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, PHY_OFF, PHY_OFF );
 
-		// Transfers Offline calibration patch to the PHY Radio
-	    eRet |= adf7030_1_Configure(pDevice, RF_CFG[PHY_CAL_CFG].cf, RF_CFG[PHY_CAL_CFG].size);
+		// Transfers Offline calibration patch to the PHY Radio, read it back (the patch runs on the PHY core)
+	    eRet |= _cal_patch_load(pSPIDevInfo, RF_CFG[PHY_CAL_CFG].cf, RF_CFG[PHY_CAL_CFG].size, ADF7030_1_VERIFY_READBACK);
 
 		// Change frequency to mid of the band
-		adf7030_1__SPI_SetMem32( pSPIDevInfo, PROFILE_CH_FREQ_Addr, (uint32_t)(PHY_FREQUENCY_CH(PHY_CH120) + PHY_CHANNEL_WIDTH/2));
+		adf7030_1__SHADOW_Set( pDevice, ADF7030_1_SHADOW_CH_FREQ, (uint32_t)(PHY_FREQUENCY_CH(PHY_CH120) + PHY_CHANNEL_WIDTH/2));
 
 		// Enable the calibration
-		eRet |= adf7030_1__SetupPatch(pSPIDevInfo, SM_DATA_CAL_ENABLE_key, 1);
-		eRet |= adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, CFG_DEV, PHY_OFF );
-	    eRet |= adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, PHY_ON, PHY_ON );
+		eRet |= adf7030_1__SetupPatch(pSPIDevInfo, SM_DATA_CAL_ENABLE_key, ADF7030_1_VERIFY_READBACK);
+		eRet |= adf7030_1__STATE_PhyCMD_WaitIrq( pSPIDevInfo, CFG_DEV, PHY_OFF, PHY_STATE_WAIT_TMO );
+	    eRet |= adf7030_1__STATE_PhyCMD_WaitIrq( pSPIDevInfo, PHY_ON, PHY_ON, PHY_STATE_WAIT_TMO );
 
 		// Setup "module" to calibrate
 	    adf7030_1__SPI_SetMem32(pSPIDevInfo, PROFILE_RADIO_CAL_CFG0_Addr, pDevice->CalCfg.RADIO_CAL_CFG0);
+	    // Arm the end of transition event (if any)
+	    if (pSPIDevInfo->pfPhyWaitCb)
+	    {
+	    	pSPIDevInfo->pfPhyWaitCb(pSPIDevInfo->pPhyWaitParam, 0);
+	    }
 		// Start the calibration
 	    eRet |= adf7030_1__STATE_PhyCMD( pSPIDevInfo, DO_CAL );
 	    if (!eRet)
 	    {
 			// Wait for calibration done
-			eRet = adf7030_1__STATE_WaitStateReady(pSPIDevInfo, PHY_ON, 0);
+			eRet = adf7030_1__STATE_WaitStateIrq(pSPIDevInfo, PHY_ON, 0, PHY_CAL_WAIT_TMO);
 			// ---> Calibration finished, should be PHY_ON idle now
 			if ( adf7030_1__READ_FIELD(PROFILE_RADIO_CAL_CFG1_CAL_SUCCESS) )
 			{
@@ -1089,6 +1637,8 @@ static int32_t _auto_calibrate_seq(phydev_t *pPhydev)
 					*(uint64_t*)(RF_CFG[PHY_RADIO_CAL].cf) = RADIO_CAL_HEADER_BE;
 					*(uint64_t*)(RF_CFG[PHY_VCO_CAL].cf) = VCO_CAL_HEADER_BE;
 					eStatus = PHY_STATUS_OK;
+					// Keep it for the current temperature and voltage
+					_cal_store();
 
 #if defined (USE_PHY_LAYER_TRACE)
 					uint32_t i;
@@ -1161,13 +1711,13 @@ static int32_t _rssi_calibrate_seq(phydev_t *pPhydev, int8_t i8RssiRefLevel)
 		// TODO :
 
 		// clear DETECTION_TIME in cca_cfg_t
-		cca_cfg.CCA_CFG = adf7030_1__SPI_GetMem32(pSPIDevInfo, PROFILE_CCA_CFG_Addr);
-		adf7030_1__WRITE_FIELD(PROFILE_CCA_CFG_DETECTION_TIME, 0);
+		cca_cfg.CCA_CFG = adf7030_1__SHADOW_Get(pDevice, ADF7030_1_SHADOW_CCA_CFG);
+		adf7030_1__SHADOW_Set(pDevice, ADF7030_1_SHADOW_CCA_CFG, cca_cfg.CCA_CFG & ~PROFILE_CCA_CFG_DETECTION_TIME_Msk);
 		// Issue CCA command
 		if (  adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, CCA, CCA ) )
 		{
 			// Revert DETECTION_TIME
-			adf7030_1__SPI_SetMem32(pSPIDevInfo, PROFILE_CCA_CFG_Addr, cca_cfg.CCA_CFG);
+			adf7030_1__SHADOW_Set(pDevice, ADF7030_1_SHADOW_CCA_CFG, cca_cfg.CCA_CFG);
 			return eStatus;
 		}
 
@@ -1195,11 +1745,478 @@ static int32_t _rssi_calibrate_seq(phydev_t *pPhydev, int8_t i8RssiRefLevel)
 			TRACE_PHY_LAYER("RSSI offset %d\n", i16RssiOffsetCal);
 		}
 		// Revert DETECTION_TIME
-		adf7030_1__SPI_SetMem32(pSPIDevInfo, PROFILE_CCA_CFG_Addr, cca_cfg.CCA_CFG);
+		adf7030_1__SHADOW_Set(pDevice, ADF7030_1_SHADOW_CCA_CFG, cca_cfg.CCA_CFG);
     }
     return eStatus;
 }
 
+/*!
+ * @brief  This function set the current temperature and voltage, then select
+ *         the nearest cached calibration.
+ *
+ * @details The selected calibration is sent on the next full configuration. If
+ * no cached calibration is close enough (see PHY_CAL_TEMP_TOL and
+ * PHY_CAL_VDD_TOL) and bAutoCal is set, the auto-calibration is run and its
+ * results are cached.
+ *
+ * A TX or RX on going is not disturbed (busy). A PHY powered off (e.g. between
+ * two sessions) is powered on for this sequence only, a sleeping one is put
+ * back to sleep.
+ *
+ * @param [in]  pPhydev Pointer on the Phy device instance
+ * @param [in]  sEnv    The temperature and voltage
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR), no close enough calibration
+ */
+static int32_t _cal_env_seq(phydev_t *pPhydev, cal_env_info_t sEnv)
+{
+	int32_t eStatus;
+    adf7030_1_device_t* pDevice = pPhydev->pCxt;
+    adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
+
+	if (pDevice->eState & ADF7030_1_STATE_BUSY)
+	{
+		return PHY_STATUS_BUSY;
+	}
+	if ( !(pDevice->eState & ADF7030_1_STATE_INITIALIZED) )
+	{
+		eStatus = _init(pPhydev);
+		if (eStatus == PHY_STATUS_OK)
+		{
+			eStatus = _cal_env_upd(pPhydev, sEnv);
+		}
+		_uninit(pPhydev);
+	}
+	else if (pSPIDevInfo->nPhyState == PHY_SLEEP)
+	{
+		eStatus = _cal_env_upd(pPhydev, sEnv);
+		if (pSPIDevInfo->nPhyState != PHY_SLEEP)
+		{
+			_do_cmd(pPhydev, PHY_CTL_CMD_SLEEP);
+		}
+	}
+	else
+	{
+		eStatus = _cal_env_upd(pPhydev, sEnv);
+	}
+	return eStatus;
+}
+
+/*!
+ * @brief  This function update the current temperature and voltage, then select
+ *         the nearest cached calibration (see _cal_env_seq)
+ *
+ * @param [in]  pPhydev Pointer on the Phy device instance
+ * @param [in]  sEnv    The temperature and voltage
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR), no close enough calibration
+ */
+static int32_t _cal_env_upd(phydev_t *pPhydev, cal_env_info_t sEnv)
+{
+	int32_t eStatus = PHY_STATUS_OK;
+    adf7030_1_device_t* pDevice = pPhydev->pCxt;
+	uint8_t u8Idx, bClose;
+
+	if (sEnv.bMeasTemp)
+	{
+		eStatus = _meas_temp(pPhydev, &(sEnv.i8Temp));
+		if (eStatus != PHY_STATUS_OK)
+		{
+			return eStatus;
+		}
+	}
+	sCalEnv.i8Temp = sEnv.i8Temp;
+	sCalEnv.u8Vdd = sEnv.u8Vdd;
+	bCalEnvKnown = 1;
+
+	u8Idx = _cal_nearest(&bClose);
+	if (!bClose && sEnv.bAutoCal)
+	{
+		TRACE_PHY_LAYER("Phy no calibration at %d C, %d mV\n", sCalEnv.i8Temp, sCalEnv.u8Vdd*20);
+		return _auto_calibrate_seq(pPhydev);
+	}
+	if ( bClose && (u8Idx != u8CalSel) )
+	{
+		// Sent with the next full configuration
+		pDevice->bCfgDone = 0;
+	}
+	return (bClose)?(PHY_STATUS_OK):(PHY_STATUS_ERROR);
+}
+
+/*!
+ * @brief  This function measure the temperature with the PHY
+ *
+ * @param [in]  pPhydev  Pointer on the Phy device instance
+ * @param [out] pi8Temp  Pointer on the temperature (degree Celsius)
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ */
+static int32_t _meas_temp(phydev_t *pPhydev, int8_t *pi8Temp)
+{
+	int32_t eStatus;
+	uint8_t eRet;
+    adf7030_1_device_t* pDevice = pPhydev->pCxt;
+    adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
+
+	eStatus = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
+	if (eStatus == PHY_STATUS_OK)
+	{
+		eRet = adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, MON, MON );
+		if (!eRet)
+		{
+			// 0.0625 C unit
+			*pi8Temp = (int8_t)(adf7030_1__GetRawTemperature(pSPIDevInfo) / 16);
+		}
+		eRet |= adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, PHY_ON, PHY_ON );
+		if (eRet)
+		{
+			eStatus = PHY_STATUS_ERROR;
+		}
+	}
+	return eStatus;
+}
+
+/*!
+ * @brief  This function find the cached calibration nearest to the current
+ *         temperature and voltage
+ *
+ * @details A close enough entry (see PHY_CAL_TEMP_TOL and PHY_CAL_VDD_TOL) is
+ * always preferred. The voltage is ignored if unknown (0).
+ *
+ * @param [out] pbClose  Pointer to get if the entry is close enough
+ *
+ * @return The entry index (PHY_CAL_CACHE_NB : empty cache)
+ */
+static uint8_t _cal_nearest(uint8_t *pbClose)
+{
+	uint32_t u32Dist, u32Best = 0xFFFFFFFF;
+	int32_t i32DeltaT, i32DeltaV;
+	uint8_t i, u8Best = PHY_CAL_CACHE_NB;
+
+	*pbClose = 0;
+	for (i = 0; i < PHY_CAL_CACHE_NB; i++)
+	{
+		if (aCalCache[i].u8Seq == 0)
+		{
+			continue;
+		}
+		i32DeltaT = aCalCache[i].i8Temp - sCalEnv.i8Temp;
+		i32DeltaT = (i32DeltaT < 0)?(-i32DeltaT):(i32DeltaT);
+		i32DeltaV = 0;
+		if (aCalCache[i].u8Vdd && sCalEnv.u8Vdd)
+		{
+			i32DeltaV = aCalCache[i].u8Vdd - sCalEnv.u8Vdd;
+			i32DeltaV = (i32DeltaV < 0)?(-i32DeltaV):(i32DeltaV);
+		}
+		// in tolerance unit (scaled by PHY_CAL_TEMP_TOL * PHY_CAL_VDD_TOL)
+		u32Dist = i32DeltaT * PHY_CAL_VDD_TOL + i32DeltaV * PHY_CAL_TEMP_TOL;
+		if ( (i32DeltaT > PHY_CAL_TEMP_TOL) || (i32DeltaV > PHY_CAL_VDD_TOL) )
+		{
+			u32Dist |= 0x80000000;
+		}
+		if (u32Dist < u32Best)
+		{
+			u32Best = u32Dist;
+			u8Best = i;
+		}
+	}
+	if (u8Best < PHY_CAL_CACHE_NB)
+	{
+		*pbClose = (u32Best & 0x80000000)?(0):(1);
+	}
+	return u8Best;
+}
+
+/*!
+ * @brief  This function load the nearest cached calibration, if close enough,
+ *         into the calibration results sent with the configuration
+ *
+ * @details Nothing is loaded while the temperature and voltage are unknown : the
+ * current results are kept.
+ *
+ * @return None
+ */
+static void _cal_pick(void)
+{
+	uint8_t u8Idx, bClose;
+
+	if (!bCalEnvKnown)
+	{
+		return;
+	}
+	u8Idx = _cal_nearest(&bClose);
+	if ( bClose && (u8Idx != u8CalSel) )
+	{
+		if (Phy_SetCal(aCalCache[u8Idx].aCalRes) == PHY_STATUS_OK)
+		{
+			u8CalSel = u8Idx;
+		}
+	}
+}
+
+/*!
+ * @brief  This function cache the current calibration results for the current
+ *         temperature and voltage
+ *
+ * @details It replaces the close enough entry if any, else an empty one, else
+ * the oldest one. u8Seq is the age rank (1 : newest). Nothing is cached while
+ * the temperature and voltage are unknown.
+ *
+ * @return None
+ */
+static void _cal_store(void)
+{
+	uint8_t i, u8Idx, u8Rank, bClose;
+
+	if (!bCalEnvKnown)
+	{
+		// The loaded results are no longer a cached entry
+		u8CalSel = PHY_CAL_CACHE_NB;
+		return;
+	}
+	u8Idx = _cal_nearest(&bClose);
+	if (!bClose)
+	{
+		// the empty or the oldest one
+		for (u8Idx = 0, i = 0; i < PHY_CAL_CACHE_NB; i++)
+		{
+			if ( (aCalCache[i].u8Seq == 0) || (aCalCache[i].u8Seq == PHY_CAL_CACHE_NB) )
+			{
+				u8Idx = i;
+				if (aCalCache[i].u8Seq == 0)
+				{
+					break;
+				}
+			}
+		}
+	}
+	if (Phy_GetCal(aCalCache[u8Idx].aCalRes) != PHY_STATUS_OK)
+	{
+		return;
+	}
+	// Age the newer entries
+	u8Rank = (aCalCache[u8Idx].u8Seq)?(aCalCache[u8Idx].u8Seq):(PHY_CAL_CACHE_NB + 1);
+	for (i = 0; i < PHY_CAL_CACHE_NB; i++)
+	{
+		if ( aCalCache[i].u8Seq && (aCalCache[i].u8Seq < u8Rank) )
+		{
+			aCalCache[i].u8Seq++;
+		}
+	}
+	aCalCache[u8Idx].u8Seq = 1;
+	aCalCache[u8Idx].i8Temp = sCalEnv.i8Temp;
+	aCalCache[u8Idx].u8Vdd = sCalEnv.u8Vdd;
+	u8CalSel = u8Idx;
+}
+
+/*!
+ * @brief  This function get the value a configuration image writes at a PHY
+ *         memory address
+ *
+ * @details Only the 32 bits address block write sequences are looked up (the
+ * last one writing the address wins).
+ *
+ * @param [in]  pCfg     Pointer on the configuration image
+ * @param [in]  u32Addr  Address of the 32 bits word in the PHY memory
+ * @param [out] pu32Word Pointer to write the word value in
+ *
+ * @retval 0 if found
+ * @retval 1 if the image doesn't write this address
+ */
+static uint8_t _cfg_word(const cfg_t *pCfg, uint32_t u32Addr, uint32_t *pu32Word)
+{
+	const uint8_t *pSeq;
+	uint32_t u32Pos = 0;
+	uint32_t u32Len, u32Start;
+	uint8_t eRet = 1;
+
+	while (u32Pos + 8 <= pCfg->size)
+	{
+		// length (3 bytes), command (1 byte), address (4 bytes), words (MSB first)
+		pSeq = &(pCfg->cf[u32Pos]);
+		u32Len = (pSeq[0] << 16) | (pSeq[1] << 8) | pSeq[2];
+		if ( (u32Len < 8) || (u32Pos + u32Len > pCfg->size) )
+		{
+			break;
+		}
+		if ( (pSeq[3] & 0xF8) == ( ADF703x_SPI_MEM_WRITE | ADF703x_SPI_MEM_BLOCK | ADF703x_SPI_MEM_ADDRESS | ADF703x_SPI_MEM_LONG ) )
+		{
+			u32Start = ((uint32_t)pSeq[4] << 24) | (pSeq[5] << 16) | (pSeq[6] << 8) | pSeq[7];
+			if ( (u32Addr >= u32Start) && (u32Addr + 4 <= u32Start + u32Len - 8) && !((u32Addr - u32Start) & 0x3) )
+			{
+				pSeq += 8 + (u32Addr - u32Start);
+				*pu32Word = ((uint32_t)pSeq[0] << 24) | (pSeq[1] << 16) | (pSeq[2] << 8) | pSeq[3];
+				eRet = 0;
+			}
+		}
+		u32Pos += u32Len;
+	}
+	return eRet;
+}
+
+/*!
+ * @brief  This function set the TX power base words for a modulation, then
+ *         build the TX power register words
+ *
+ * @details The base words are taken from the modulation configuration image,
+ * else (not in the image) read once from the PHY.
+ *
+ * @param [in] pDevice     Pointer on the adf7030 device
+ * @param [in] eModulation The modulation configuration loaded in the PHY
+ *
+ * @return None
+ */
+static void _tx_pwr_base(adf7030_1_device_t *pDevice, uint8_t eModulation)
+{
+	if ( _cfg_word(&RF_CFG[eModulation], PROFILE_RADIO_DIG_TX_CFG0_Addr, &u32TxCfg0Base) )
+	{
+		u32TxCfg0Base = adf7030_1__SHADOW_Get(pDevice, ADF7030_1_SHADOW_TX_CFG0);
+	}
+#ifdef PHY_USE_POWER_RAMP
+	if ( _cfg_word(&RF_CFG[eModulation], PROFILE_RADIO_DIG_TX_CFG1_Addr, &u32TxCfg1Base) )
+	{
+		u32TxCfg1Base = adf7030_1__SHADOW_Get(pDevice, ADF7030_1_SHADOW_TX_CFG1);
+	}
+#endif
+	u8TxPwrMod = eModulation;
+	_tx_pwr_build();
+}
+
+/*!
+ * @brief  This function build the TX power register words of each aPhyPower
+ *         entry
+ *
+ * @return None
+ */
+static void _tx_pwr_build(void)
+{
+	radio_dig_tx_cfg0_t tx_cfg0;
+#ifdef PHY_USE_POWER_RAMP
+	radio_dig_tx_cfg1_t tx_cfg1;
+#endif
+	uint8_t i;
+
+	for (i = 0; i < PHY_NB_PWR; i++)
+	{
+		// PA_Coarse in {1 to 6}
+		// PA_Fine in {0, 3 to 127}
+		// PA_Micro in {1 to 31}
+		tx_cfg0.RADIO_DIG_TX_CFG0 = u32TxCfg0Base;
+		// Setup PA1 power
+		tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_COARSE = aPhyPower[i].coarse;
+		tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_FINE = aPhyPower[i].fine;
+		tx_cfg0.RADIO_DIG_TX_CFG0_b.PA_MICRO = aPhyPower[i].micro;
+		aTxPwrWord[i].u32TxCfg0 = tx_cfg0.RADIO_DIG_TX_CFG0;
+#ifdef PHY_USE_POWER_RAMP
+		tx_cfg1.RADIO_DIG_TX_CFG1 = u32TxCfg1Base;
+		tx_cfg1.RADIO_DIG_TX_CFG1_b.PA_RAMP_RATE = pa_ramp_rate;
+		aTxPwrWord[i].u32TxCfg1 = tx_cfg1.RADIO_DIG_TX_CFG1;
+#endif
+	}
+}
+
+/*!
+ * @brief  This function compute the frequency of a channel, with the
+ *         application offset and the AFC correction
+ *
+ * @param [in] pPhydev Pointer on the device
+ * @param [in] eCh     The channel (see phy_chan_e)
+ *
+ * @return The frequency (Hz)
+ */
+static uint32_t _ch_freq(phydev_t *pPhydev, uint8_t eCh)
+{
+	return PHY_FREQUENCY_CH(eCh) + pPhydev->i16TxFreqOffset + i16AfcCorr;
+}
+
+#if defined (USE_PHY_AFC_TRACK)
+/*!
+ * @brief  This function track the local frequency error from the AFC error of
+ *         a received frame
+ *
+ * @details Frames in test mode, too weak (under PHY_AFC_TRACK_RSSI_MIN) or
+ * with an outlier error (over PHY_AFC_TRACK_ERR_MAX_HZ) are ignored. The others
+ * feed an EWMA. Once PHY_AFC_TRACK_MIN_NB frames are filtered, if the filtered
+ * error is over PHY_AFC_TRACK_DEADBAND_HZ, the correction moves by half of it
+ * (up to PHY_AFC_TRACK_STEP_HZ, within +/-PHY_AFC_CORR_MAX) and the filter
+ * takes the step off, as the next frames will be received with it.
+ *
+ * The error is taken as the received carrier minus the local oscillator, so the
+ * correction is moved in its direction.
+ *
+ * @param [in] pPhydev Pointer on the device
+ * @param [in] u16Rssi The RSSI of the frame (ADF7030 signed 11 bits)
+ * @param [in] u16Ferr The AFC frequency error of the frame (ADF7030 raw)
+ *
+ * @return None
+ */
+static void _afc_track(phydev_t *pPhydev, uint16_t u16Rssi, uint16_t u16Ferr)
+{
+	int32_t i32Err, i32Step, i32Corr;
+
+	if ( (pPhydev->eTestMode != PHY_TST_MODE_NONE) ||
+	     (PHY_CONV_Signed11ToQdBm(u16Rssi) < 4*PHY_AFC_TRACK_RSSI_MIN) )
+	{
+		return;
+	}
+	i32Err = PHY_CONV_AfcFreqErrToHz((int16_t)u16Ferr);
+	if ( (i32Err > PHY_AFC_TRACK_ERR_MAX_HZ) || (i32Err < -PHY_AFC_TRACK_ERR_MAX_HZ) )
+	{
+		return;
+	}
+
+	if (u8AfcNb == 0)
+	{
+		i32AfcAcc = i32Err << PHY_AFC_TRACK_SHIFT;
+	}
+	else
+	{
+		i32AfcAcc += i32Err - (i32AfcAcc >> PHY_AFC_TRACK_SHIFT);
+	}
+	if (u8AfcNb < PHY_AFC_TRACK_MIN_NB)
+	{
+		u8AfcNb++;
+		if (u8AfcNb < PHY_AFC_TRACK_MIN_NB)
+		{
+			return;
+		}
+	}
+
+	i32Err = i32AfcAcc >> PHY_AFC_TRACK_SHIFT;
+	if ( (i32Err <= PHY_AFC_TRACK_DEADBAND_HZ) && (i32Err >= -PHY_AFC_TRACK_DEADBAND_HZ) )
+	{
+		return;
+	}
+	i32Step = i32Err / 2;
+	if (i32Step > PHY_AFC_TRACK_STEP_HZ)
+	{
+		i32Step = PHY_AFC_TRACK_STEP_HZ;
+	}
+	else if (i32Step < -PHY_AFC_TRACK_STEP_HZ)
+	{
+		i32Step = -PHY_AFC_TRACK_STEP_HZ;
+	}
+	i32Corr = i16AfcCorr + i32Step;
+	if (i32Corr > PHY_AFC_CORR_MAX)
+	{
+		i32Corr = PHY_AFC_CORR_MAX;
+	}
+	else if (i32Corr < -PHY_AFC_CORR_MAX)
+	{
+		i32Corr = -PHY_AFC_CORR_MAX;
+	}
+	i32AfcAcc -= (i32Corr - i16AfcCorr) << PHY_AFC_TRACK_SHIFT;
+	i16AfcCorr = (int16_t)i32Corr;
+	TRACE_PHY_LAYER("Phy AFC correction %d Hz\n", i16AfcCorr);
+}
+#endif
+
 /*!
  * @brief  This is the main FSM.
  *
@@ -1221,6 +2238,19 @@ static int32_t _do_cmd(phydev_t *pPhydev, uint8_t eCmd)
     adf7030_1_device_t* pDevice = pPhydev->pCxt;
     adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
 
+	// Any other command leaves the CCA state kept by the LBT
+	if (eCmd != PHY_CMD_TX)
+	{
+		pDevice->bLbtTx = 0;
+	}
+#if defined (USE_PHY_SCHED)
+	// Any command cancels the pending scheduled TX/RX
+	if (bSchedPend)
+	{
+		_sched_cancel(pPhydev);
+	}
+#endif
+
 	if ( eCmd < PHY_CTL_CMD_READY)
 	{
 		// Power supply command
@@ -1234,9 +2264,10 @@ static int32_t _do_cmd(phydev_t *pPhydev, uint8_t eCmd)
 		pPhydev->bPreSyncOn = 0;
 
 		pDevice->bCfgDone = 0;
+		pDevice->u8CfgMod = PHY_CFG_MOD_NONE;
 		pDevice->bCrcOn = 0;
-		pDevice->bTxPwrDone = 0;
 		pDevice->u8PendTXBuffSize = 0;
+		adf7030_1__SHADOW_Invalidate(pDevice);
 
 		pPhydev->u16_Noise = 0;
 		pPhydev->u16_Rssi  = 0;
@@ -1256,7 +2287,7 @@ static int32_t _do_cmd(phydev_t *pPhydev, uint8_t eCmd)
 			default:
 				adf7030_1_PulseReset(pDevice);
 				eRet |= adf7030_1__SPI_GetMMapPointers(pSPIDevInfo);
-				eRet |= adf7030_1__SendConfiguration( pSPIDevInfo, RF_CFG[PHY_BASE_CFG].cf, RF_CFG[PHY_BASE_CFG].size);
+				eRet |= adf7030_1__SendConfigImage( pSPIDevInfo, RF_CFG[PHY_BASE_CFG].cf, RF_CFG[PHY_BASE_CFG].size);
 				eRet |= adf7030_1__STATE_PhyCMD_WaitReady(pSPIDevInfo, CFG_DEV, PHY_OFF);
 				if (eRet)
 				{
@@ -1281,51 +2312,98 @@ static int32_t _do_cmd(phydev_t *pPhydev, uint8_t eCmd)
 		    	misc_fw.FW = adf7030_1__GetMiscFwStatus(pSPIDevInfo);
 		    	pSPIDevInfo->nPhyState =  misc_fw.FW_b.CURR_STATE;
 		    	pSPIDevInfo->ePhyError =  misc_fw.FW_b.ERR_CODE;
+		    	// On transition (e.g. back to PHY_ON after the TX end of frame),
+		    	// CURR_STATE already gives the target state : a command sent now
+		    	// would be ignored, so wait for its end.
+		    	if ( !pSPIDevInfo->nStatus.VALUE_b.CMD_READY &&
+		    	     adf7030_1__STATE_WaitStateReady(pSPIDevInfo, pSPIDevInfo->nPhyState, 255) )
+		    	{
+		    		eStatus = PHY_STATUS_ERROR;
+		    	}
 		    }
 
-			switch (eCmd)
+			if (eStatus == PHY_STATUS_OK)
 			{
-				case PHY_CTL_CMD_READY:
-					eStatus = _ready_seq(pPhydev);
-					break;
-				case PHY_CTL_CMD_SLEEP:
-					eStatus = _sleep_seq(pPhydev);
-					break;
-				case PHY_CMD_RX:
-				case PHY_CMD_CCA:
-				case PHY_CMD_TX:
-					eStatus = _trx_seq(pPhydev);
-					if (eStatus == PHY_STATUS_OK)
+				switch (eCmd)
+				{
+					case PHY_CTL_CMD_READY:
+						eStatus = _ready_seq(pPhydev);
+						break;
+					case PHY_CTL_CMD_SLEEP:
+						eStatus = _sleep_seq(pPhydev);
+						break;
+					case PHY_CMD_RX:
+					case PHY_CMD_CCA:
+					case PHY_CMD_TX:
 					{
-						if ( eCmd == PHY_CMD_RX)
+						uint8_t bStaged = 0;
+						if ( (eCmd == PHY_CMD_RX) && _rx_staged(pPhydev) )
 						{
-							pSPIDevInfo->nPhyNextState = PHY_RX;
-							pDevice->eState |= ADF7030_1_STATE_RECEIVING;
+							// Setup already done at the TX end of frame
+							bStaged = 1;
+							eStatus = PHY_STATUS_OK;
 						}
-						else if (eCmd == PHY_CMD_CCA)
+						else
 						{
-							pSPIDevInfo->nPhyNextState = CCA;
-							pDevice->eState |= ADF7030_1_STATE_NOISE_MEAS;
+							eStatus = _trx_seq(pPhydev, eCmd);
 						}
-						else { // PHY_CMD_TX
-							pSPIDevInfo->nPhyNextState = PHY_TX;
-							pDevice->eState |= ADF7030_1_STATE_TRANSMITTING;
+						if (eCmd == PHY_CMD_RX)
+						{
+							// Consumed (or no longer relevant)
+							pDevice->u8RxStage = RX_STAGE_NONE;
 						}
+						if (eStatus == PHY_STATUS_OK)
+						{
+							if ( eCmd == PHY_CMD_RX)
+							{
+								pSPIDevInfo->nPhyNextState = PHY_RX;
+								pDevice->eState |= ADF7030_1_STATE_RECEIVING;
+							}
+							else if (eCmd == PHY_CMD_CCA)
+							{
+								pSPIDevInfo->nPhyNextState = CCA;
+								pDevice->eState |= ADF7030_1_STATE_NOISE_MEAS;
+							}
+							else { // PHY_CMD_TX
+								pSPIDevInfo->nPhyNextState = PHY_TX;
+								pDevice->eState |= ADF7030_1_STATE_TRANSMITTING;
+							}
 #ifdef USE_PHY_TRIG
-						eRet = adf7030_1_SetupTrig(pDevice, ADF7030_1_TRIGPIN0, pSPIDevInfo->nPhyNextState, 1);
-						eRet |= adf7030_1_PulseTrigger(pDevice, ADF7030_1_TRIGPIN0);
-#else
-						//eRet = adf7030_1__STATE_PhyCMD( pSPIDevInfo, pSPIDevInfo->nPhyNextState );
-						eRet = adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, pSPIDevInfo->nPhyNextState, pSPIDevInfo->nPhyNextState );
+							// The CCA is a measure : wait for it (SPI command)
+							if (eCmd != PHY_CMD_CCA)
+							{
+								// The trigger is already set on PHY_RX when pre-staged
+								eRet = (bStaged)?(0):(adf7030_1_SetupTrig(pDevice, ADF7030_1_TRIGPIN0, pSPIDevInfo->nPhyNextState, 1));
+#if defined (USE_PHY_SCHED)
+								if (bSchedArm)
+								{
+									// The pulse is given by the LPTIM interrupt
+									bSchedArm = 0;
+									eRet |= (eRet)?(0):(_sched_arm(pPhydev));
+								}
+								else
 #endif
-						if(eRet)
-						{
-							eStatus = PHY_STATUS_ERROR;
+								{
+									eRet |= adf7030_1_PulseTrigger(pDevice, ADF7030_1_TRIGPIN0);
+								}
+							}
+							else
+#endif
+							{
+								(void)bStaged;
+								//eRet = adf7030_1__STATE_PhyCMD( pSPIDevInfo, pSPIDevInfo->nPhyNextState );
+								eRet = adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, pSPIDevInfo->nPhyNextState, pSPIDevInfo->nPhyNextState );
+							}
+							if(eRet)
+							{
+								eStatus = PHY_STATUS_ERROR;
+							}
 						}
+						break;
 					}
-					break;
-				default:
-					break;
+					default:
+						break;
+				}
 			}
 		}
 		else {
@@ -1333,11 +2411,20 @@ static int32_t _do_cmd(phydev_t *pPhydev, uint8_t eCmd)
 			pSPIDevInfo->eXferResult = ADF7030_1_INVALID_OPERATION;
 		}
     }
+    // The PHY timings (LPTIM1 on PCLK, HiResTime on TIM2) don't run in STOP mode : allow it only when the radio is idle
+    BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_PHY,
+    		!( ( (pSPIDevInfo->nPhyState == PHY_SLEEP) || (pSPIDevInfo->nPhyState == PHY_OFF) ) &&
+    		   ( (pSPIDevInfo->nPhyNextState == PHY_SLEEP) || (pSPIDevInfo->nPhyNextState == PHY_OFF) ) ) );
+    if ( (eStatus != PHY_STATUS_OK) && (pSPIDevInfo->eXferResult != ADF7030_1_SUCCESS) )
+    {
+    	PhyLog_ErrPush(pDevice);
+    }
     return eStatus;
 }
 
 /*!
- * @brief  Interruption handler to treat the frame event
+ * @brief  Interruption handler to treat the frame event (timestamp only, the
+ *         PHY service task is notified to do the SPI access)
  *
  * @param [in] p_CbParam Pointer on call-back parameter
  * @param [in] p_Arg     Pointer on call-back argument
@@ -1349,13 +2436,76 @@ static void _frame_it(void *p_CbParam, void *p_Arg)
 #ifdef HAS_HIRES_TIME_MEAS
 	HiResTime_Capture(1);
 #endif
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	PHY_TIME_TRACE(PHY_TRACE_IRQ, ADF7030_1_INTPIN0);
+
+#ifdef HAS_HIRES_TIME_MEAS
 	phydev_t *pPhydev = (phydev_t *) p_CbParam;
+	// EOF is the only frame interrupt while transmitting
+	if ( ((adf7030_1_device_t*)pPhydev->pCxt)->eState & ADF7030_1_STATE_TRANSMITTING)
+	{
+		HiResTime_Capture(2);
+		PHY_TIME_TRACE(PHY_TRACE_TX_EOF, 0);
+	}
+#endif
+	// Interrupt status is read and cleared from the PHY service task
+	vTaskNotifyGiveFromISR(hPhySrvTask, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/*!
+ * @static
+ * @brief  PHY service task (frame interrupt bottom-half)
+ *
+ * @details The frame is processed with the PHY lock held, so it doesn't
+ * interleave with a caller task sequence (SPI bus, state wait and DMA transfer
+ * semaphores are shared). The event call-back is then called in this task
+ * context.
+ *
+ * @param [in] argument Pointer on the Phy device instance
+ *
+ * @return None
+ */
+static void _srv_task(void const *argument)
+{
+	phydev_t *pPhydev = (phydev_t *) argument;
+	uint32_t eEvt;
+	while(1)
+	{
+		if ( ulTaskNotifyTake(pdTRUE, portMAX_DELAY) )
+		{
+			PHY_LOCK();
+			eEvt = _frame_process(pPhydev);
+			PHY_UNLOCK();
+			// event notification, out of the lock (the call-back could use the PHY)
+			if( (eEvt != PHYDEV_EVT_NONE) && pPhydev->pfEvtCb ) {
+				pPhydev->pfEvtCb(pPhydev->pCbParam, eEvt);
+			}
+		}
+	}
+}
+
+/*!
+ * @static
+ * @brief  Read and clear the frame interrupt status
+ *
+ * @details Called with the PHY lock held.
+ *
+ * @param [in] pPhydev Pointer on the Phy device instance
+ *
+ * @return The event to notify (see phydev_evt_e)
+ */
+static uint32_t _frame_process(phydev_t *pPhydev)
+{
     adf7030_1_device_t* pDevice = (adf7030_1_device_t*)pPhydev->pCxt;
     adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
     misc_fw_t misc_fw;
     uint32_t eEvt = PHYDEV_EVT_NONE;
     uint32_t u32IrqStatus;
+    uint8_t bRxNext = 0;
+    uint8_t bRxStage = 0;
 
+    PHY_TIME_TRACE(PHY_TRACE_FRM_PROCESS, 0);
     u32IrqStatus = adf7030_1__GetIrqStatus(pSPIDevInfo, ADF7030_1_INTPIN0);
 	misc_fw.FW = adf7030_1__GetMiscFwStatus(pSPIDevInfo);
 	pSPIDevInfo->nPhyState =  misc_fw.FW_b.CURR_STATE;
@@ -1370,6 +2520,7 @@ static void _frame_it(void *p_CbParam, void *p_Arg)
 				#ifdef HAS_HIRES_TIME_MEAS
 					HiResTime_Capture(3);
 				#endif
+				PHY_TIME_TRACE(PHY_TRACE_RX_PREAMBLE, 0);
 				pDevice->bDetected = 1;
 			}
 			if(u32IrqStatus & SYNCWORD_IRQn_Msk )
@@ -1387,227 +2538,989 @@ static void _frame_it(void *p_CbParam, void *p_Arg)
 	{
 		if (pDevice->eState & ADF7030_1_STATE_TRANSMITTING)
 		{
-			#ifdef HAS_HIRES_TIME_MEAS
-				HiResTime_Capture(2);
-			#endif
 			eEvt = PHYDEV_EVT_TX_COMPLETE;
 			pDevice->eState &= ~ADF7030_1_STATE_TRANSMITTING;
+			bRxStage = (pDevice->u8RxStage == RX_STAGE_REQ);
 		}
 		else if (pDevice->eState & ADF7030_1_STATE_RECEIVING)
 		{
 			#ifdef HAS_HIRES_TIME_MEAS
 				HiResTime_Capture(4);
 			#endif
+			PHY_TIME_TRACE(PHY_TRACE_RX_EOF, 0);
 			eEvt = PHYDEV_EVT_RX_COMPLETE;
-			pDevice->eState &= ~ADF7030_1_STATE_RECEIVING;
+#if defined (USE_PHY_AFC_TRACK)
+			// (continuous RX : got by _rx_cont_next)
+			if ( !(pDevice->bRxCont) && !(pDevice->IntGPIOInfo[ADF7030_1_INTPIN0].nIntMap & SYNCWORD_IRQn_Msk) )
+			{
+				// Not get at the sync word, still the frame one (AFC is frozen until the RX restart)
+				pPhydev->u16_Ferr = adf7030_1__GetRawAfcFreqErr(&(pDevice->SPIInfo));
+			}
+#endif
+			if (pDevice->bRxCont)
+			{
+				// stay in RECEIVING, frame is queued after the RX restart
+				bRxNext = 1;
+			}
+			else
+			{
+				pDevice->eState &= ~ADF7030_1_STATE_RECEIVING;
+			}
+		}
+		else if (pDevice->eState & ADF7030_1_STATE_NOISE_MEAS)
+		{
+			pDevice->eState &= ~ADF7030_1_STATE_NOISE_MEAS;
+		}
+		else // abort TX or RX ?
+		{}
+	}
+
+	if(u32IrqStatus == 0 )
+	{
+		eEvt = PHYDEV_EVT_ERROR;
+	}
+
+    // just to help debug
+    pDevice->IntGPIOInfo[ADF7030_1_INTPIN0].nIntStatus = u32IrqStatus;
+    // clear interrupt status
+    adf7030_1__ClrIrqStatus(pSPIDevInfo, ADF7030_1_INTPIN0);
+    if (bRxNext)
+    {
+    	eEvt = _rx_cont_next(pPhydev);
+    }
+    if (bRxStage)
+    {
+    	// Done before the notification, so the RX could be started right after
+    	_rx_stage(pPhydev);
+    }
+    return eEvt;
+}
+
+/*!
+ * @static
+ * @brief  Continuous RX : restart the RX, then queue the received frame
+ *
+ * @details The PHY is back to PHY_ON at the end of frame. It is set to RX
+ * before reading the frame : the RX packet buffer is only written after the
+ * next preamble and synchro word, which last far longer than the frame read.
+ * If the RX restart fails, the continuous RX is left and the frame dropped.
+ *
+ * @param [in] pPhydev Pointer on the Phy device instance
+ *
+ * @return The event to notify (see phydev_evt_e)
+ */
+static uint32_t _rx_cont_next(phydev_t *pPhydev)
+{
+    adf7030_1_device_t* pDevice = (adf7030_1_device_t*)pPhydev->pCxt;
+    adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
+    phy_rx_frame_t *pFrame;
+    uint16_t u16Rssi;
+    uint8_t eRet;
+
+    // RSSI is the live one, so get it before the RX restart
+    u16Rssi = adf7030_1__GetRawRSSI(pSPIDevInfo);
+    if ( !(pDevice->IntGPIOInfo[ADF7030_1_INTPIN0].nIntMap & SYNCWORD_IRQn_Msk) )
+    {
+    	// Not got at this frame sync word, and lost on the RX restart
+    	pPhydev->u16_Ferr = adf7030_1__GetRawAfcFreqErr(pSPIDevInfo);
+    }
+    // the PHY goes back to PHY_ON on its own, commands are ignored until then
+    eRet = adf7030_1__STATE_WaitStateReady( pSPIDevInfo, PHY_ON, 255 );
+#ifdef USE_PHY_TRIG
+    // the trigger is already set up on PHY_RX
+    eRet |= adf7030_1_PulseTrigger(pDevice, ADF7030_1_TRIGPIN0);
+#else
+    eRet |= adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, PHY_RX, PHY_RX );
+#endif
+    if (eRet)
+    {
+    	// The RX is not restarted : leave the continuous RX (caller could restart it)
+    	pDevice->eState &= ~ADF7030_1_STATE_RECEIVING;
+    	pDevice->bRxCont = 0;
+    	return PHYDEV_EVT_ERROR;
+    }
+
+    if ( (uint8_t)(u8RxPoolIn - u8RxPoolOut) >= PHY_RX_POOL_NB )
+    {
+    	u32RxPoolDrop++;
+    	TRACE_PHY_LAYER("Phy RX pool full, frame dropped (%lu)\n", u32RxPoolDrop);
+    	return PHYDEV_EVT_NONE;
+    }
+    pFrame = &(aRxPool[u8RxPoolIn & (PHY_RX_POOL_NB - 1)]);
+    if ( adf7030_1__GetRxPacket(pSPIDevInfo, pFrame->aData, &(pFrame->u8Len)) )
+    {
+    	return PHYDEV_EVT_ERROR;
+    }
+    pFrame->u64Time = BSP_Rtc_Time_GetEpochMs();
+    pFrame->u16Rssi = u16Rssi;
+    pFrame->u16Ferr = pPhydev->u16_Ferr;
+    PHY_STATS_RX(pPhydev->eChannel, pPhydev->eModulation, u16Rssi, pPhydev->u16_Ferr);
+    PHY_AFC_TRACK(pPhydev, u16Rssi, pPhydev->u16_Ferr);
+    // publish the slot once filled
+    __atomic_store_n(&u8RxPoolIn, (uint8_t)(u8RxPoolIn + 1), __ATOMIC_RELEASE);
+    return PHYDEV_EVT_RX_COMPLETE;
+}
+
+/*!
+ * @static
+ * @brief  Write the pre-staged RX setup (channel, CRC, interrupts)
+ *
+ * @details Only the run-time setup is pre-staged : if the modulation differs
+ * from the current one, the next RX does the full configuration as usual.
+ *
+ * @param [in] pPhydev Pointer on the Phy device instance
+ *
+ * @return None
+ */
+static void _rx_stage(phydev_t *pPhydev)
+{
+    adf7030_1_device_t* pDevice = (adf7030_1_device_t*)pPhydev->pCxt;
+
+    pDevice->u8RxStage = RX_STAGE_NONE;
+    if ( (pDevice->u8RxStageMod != pPhydev->eModulation) || !(pDevice->bCfgDone) )
+    {
+    	return;
+    }
+    pPhydev->eChannel = (phy_chan_e)pDevice->u8RxStageCh;
+    if (_trx_seq(pPhydev, PHY_CMD_RX) != PHY_STATUS_OK)
+    {
+    	return;
+    }
+#ifdef USE_PHY_TRIG
+    if (adf7030_1_SetupTrig(pDevice, ADF7030_1_TRIGPIN0, PHY_RX, 1))
+    {
+    	return;
+    }
+#endif
+    pDevice->u8RxStage = RX_STAGE_DONE;
+}
+
+/*!
+ * @static
+ * @brief  Check that the pre-staged RX setup match the requested RX
+ *
+ * @details The host shadow is dropped each time the PHY memory could have
+ * been lost or changed behind it, so a valid frequency shadow equal to the
+ * requested channel means that the pre-staged setup is still in the PHY.
+ *
+ * @param [in] pPhydev Pointer on the Phy device instance
+ *
+ * @retval 1 The RX setup could be skipped
+ * @retval 0 Otherwise
+ */
+static uint8_t _rx_staged(phydev_t *pPhydev)
+{
+    adf7030_1_device_t* pDevice = (adf7030_1_device_t*)pPhydev->pCxt;
+    uint32_t u32IntMap = (pPhydev->bPreSyncOn)?(PREAMBLE_IRQn_Msk | SYNCWORD_IRQn_Msk | EOF_IRQn_Msk):(EOF_IRQn_Msk);
+    uint32_t u32Freq = _ch_freq(pPhydev, pPhydev->eChannel);
+
+    return ( (pDevice->u8RxStage == RX_STAGE_DONE)
+          && (pDevice->u8RxStageCh == pPhydev->eChannel)
+          && (pDevice->u8RxStageMod == pPhydev->eModulation)
+          && (pDevice->bCfgDone)
+          && (pDevice->bCrcOn == pPhydev->bCrcOn)
+          && (pPhydev->eTestMode == PHY_TST_MODE_NONE)
+          && (pDevice->IntGPIOInfo[ADF7030_1_INTPIN0].nIntMap == u32IntMap)
+          && (pDevice->Shadow.nValid & (1UL << ADF7030_1_SHADOW_CH_FREQ))
+          && (pDevice->Shadow.nValue[ADF7030_1_SHADOW_CH_FREQ] == u32Freq) )?(1):(0);
+}
+
+/*!
+ * @static
+ * @brief  Get the oldest frame of the RX pool (left in the pool)
+ *
+ * @return Pointer on the frame, NULL if the pool is empty
+ */
+static phy_rx_frame_t* _rx_pool_peek(void)
+{
+	if ( __atomic_load_n(&u8RxPoolIn, __ATOMIC_ACQUIRE) == u8RxPoolOut )
+	{
+		return NULL;
+	}
+	return &(aRxPool[u8RxPoolOut & (PHY_RX_POOL_NB - 1)]);
+}
+
+/*!
+ * @static
+ * @brief  Free the oldest frame of the RX pool
+ *
+ * @return None
+ */
+static void _rx_pool_free(void)
+{
+	__atomic_store_n(&u8RxPoolOut, (uint8_t)(u8RxPoolOut + 1), __ATOMIC_RELEASE);
+}
+
+/*!
+ * @brief  Interruption handler as an instrumentation
+ *
+ * @param [in] p_CbParam Pointer on call-back parameter
+ * @param [in] p_Arg     Pointer on call-back argument
+ *
+ * @return None
+ */
+static void _instrum_it(void *p_CbParam, void *p_Arg)
+{
+	PHY_TIME_TRACE(PHY_TRACE_IRQ, ADF7030_1_INTPIN1);
+#if defined (USE_PHY_IRQ_WAIT)
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	// Just wake-up the waiting task, status is cleared from it (see _state_wait)
+	xSemaphoreGiveFromISR(hPhyWaitSem, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+#else
+	phydev_t *pPhydev = (phydev_t *) p_CbParam;
+    adf7030_1_device_t* pDevice = (adf7030_1_device_t*)pPhydev->pCxt;
+    adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
+    uint32_t u32IrqStatus;
+
+    u32IrqStatus = adf7030_1__GetIrqStatus(pSPIDevInfo, ADF7030_1_INTPIN1);
+    // just to help debug
+    pDevice->IntGPIOInfo[ADF7030_1_INTPIN1].nIntStatus = u32IrqStatus;
+    // clear interrupt status
+    adf7030_1__ClrIrqStatus(pSPIDevInfo, ADF7030_1_INTPIN1);
+#endif
+}
+
+#if defined (USE_PHY_TIME_TRACE)
+/*!
+ * @static
+ * @brief  Driver trace call-back (command, command done, SPI frame)
+ *
+ * @param [in] p_TraceParam Pointer on the Phy device instance (unused)
+ * @param [in] u8Evt        The driver event (see adf7030_1_trace_evt_e)
+ * @param [in] u32Arg       The event argument
+ *
+ * @return None
+ */
+static void _trace_cb(void *p_TraceParam, uint8_t u8Evt, uint32_t u32Arg)
+{
+	(void)p_TraceParam;
+	PhyTrace_Add(u8Evt, (uint16_t)u32Arg);
+}
+#endif
+
+#if defined (USE_PHY_IRQ_WAIT)
+/*!
+ * @brief  Wait for the end of a PHY state transition (INTPIN1 interrupt)
+ *
+ * @param [in] p_WaitParam Pointer on the Phy device instance
+ * @param [in] u32Timeout  Maximum time to wait (in ms). If 0, discard the
+ *                         pending event and (re)arm the PHY interrupt.
+ *
+ * @retval 0 The transition event occurred (or interrupt is armed)
+ * @retval 1 Timeout, scheduler not running or communication failure
+ */
+static uint8_t _state_wait(void *p_WaitParam, uint32_t u32Timeout)
+{
+	phydev_t *pPhydev = (phydev_t *) p_WaitParam;
+    adf7030_1_device_t* pDevice = (adf7030_1_device_t*)pPhydev->pCxt;
+    uint8_t eRet = 1;
+
+    if (u32Timeout == 0)
+    {
+    	xSemaphoreTake(hPhyWaitSem, 0);
+    	eRet = adf7030_1__IRQ_SetMap(pDevice, ADF7030_1_INTPIN1, (uint32_t)PHY_STATE_IRQ_MSK);
+    	eRet |= adf7030_1__IRQ_ClrStatus(pDevice, ADF7030_1_INTPIN1, 0xFFFFFFFF);
+    }
+    // Not able to block if the scheduler is not started (e.g. init) : caller will poll
+    else if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+    {
+    	if ( xSemaphoreTake(hPhyWaitSem, pdMS_TO_TICKS(u32Timeout)) == pdTRUE )
+    	{
+    		eRet = 0;
+    	}
+    	// clear interrupt status, so next rising edge can occur
+    	adf7030_1__IRQ_ClrStatus(pDevice, ADF7030_1_INTPIN1, 0xFFFFFFFF);
+    }
+    return eRet;
+}
+#endif
+
+#if defined (USE_SPI_DMA)
+/*!
+ * @static
+ * @brief  DMA SPI transfer end callback (called from ISR)
+ *
+ * @param [in] p_CbParam Pointer on the Phy device instance
+ * @param [in] evt       Event (see spi_evt_e)
+ *
+ */
+static void _xfer_it(void *p_CbParam, uint32_t evt)
+{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	(void)p_CbParam;
+	u32PhyXferEvt = evt;
+	xSemaphoreGiveFromISR(hPhyXferSem, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/*!
+ * @brief  Wait for the end of a DMA SPI transfer
+ *
+ * @param [in] p_WaitParam Pointer on the Phy device instance
+ * @param [in] u32Timeout  Maximum time to wait (in ms). If 0, discard the
+ *                         pending event.
+ *
+ * @retval 0 The transfer is completed (or pending event is discarded)
+ * @retval 1 Timeout or transfer failure
+ */
+static uint8_t _xfer_wait(void *p_WaitParam, uint32_t u32Timeout)
+{
+	phydev_t *pPhydev = (phydev_t *) p_WaitParam;
+    adf7030_1_device_t* pDevice = (adf7030_1_device_t*)pPhydev->pCxt;
+    uint8_t eRet = 1;
+
+    if (u32Timeout == 0)
+    {
+    	xSemaphoreTake(hPhyXferSem, 0);
+    	u32PhyXferEvt = SPI_EVT_NONE;
+    	eRet = 0;
+    }
+    else
+    {
+    	// Not able to block if the scheduler is not started (e.g. init) : poll
+    	if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+    	{
+    		xSemaphoreTake(hPhyXferSem, pdMS_TO_TICKS(u32Timeout));
+    	}
+    	else
+    	{
+    		BSP_Spi_Wait(pDevice->SPIInfo.hSPIDevice, u32Timeout);
+    	}
+    	if (u32PhyXferEvt == SPI_EVT_XFER_CPLT)
+    	{
+    		eRet = 0;
+    	}
+    }
+    return eRet;
+}
+#endif
+
+/******************************************************************************/
+/******************************************************************************/
+
+/*!
+ * @static
+ * @brief  This function execute a TX sequence
+ *
+ * @param [in]  pPhydev     Pointer on the Phy device instance
+ * @param [in]  eChannel    Channel use to TX
+ * @param [in]  eModulation Modulation use to TX
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+static int32_t _do_TX(phydev_t *pPhydev, phy_chan_e eChannel, phy_mod_e eModulation)
+{
+    int32_t i32Ret = PHY_STATUS_OK;
+    adf7030_1_device_t* pDevice = pPhydev->pCxt;
+	PHY_LOCK();
+	if ( !(pDevice->eState & ADF7030_1_STATE_BUSY) && !pDevice->bRxCont )
+	{
+		// set modulation
+		if ( eModulation != pPhydev->eModulation)
+		{
+			pPhydev->eModulation = eModulation;
+			// full reconfiguration is required
+			pDevice->bCfgDone = 0;
+		}
+		// Still in CCA after a free LBT on this channel ?
+		if ( pDevice->bLbtTx && pDevice->bCfgDone && (eChannel == pPhydev->eChannel) )
+		{
+			// yes, go to PHY_TX from there
+			i32Ret = PHY_STATUS_OK;
+		}
+		else
+		{
+			// set the Channel
+			pPhydev->eChannel = eChannel;
+			i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
+		}
+		pDevice->bLbtTx = 0;
+		if (i32Ret == PHY_STATUS_OK)
+		{
+			// payload length is set by the TX setup sequence
+			i32Ret = _do_cmd(pPhydev, PHY_CMD_TX);
+		}
+	}
+	else
+	{
+		i32Ret = PHY_STATUS_BUSY;
+	}
+    PHY_UNLOCK();
+    return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief  This function execute an RX sequence
+ *
+ * @param [in]  pPhydev     Pointer on the Phy device instance
+ * @param [in]  eChannel    Channel use to RX
+ * @param [in]  eModulation Modulation use to RX
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+static int32_t _do_RX(phydev_t *pPhydev, phy_chan_e eChannel, phy_mod_e eModulation)
+{
+    int32_t i32Ret = PHY_STATUS_OK;
+    adf7030_1_device_t* pDevice = pPhydev->pCxt;
+	PHY_LOCK();
+	if ( !(pDevice->eState & ADF7030_1_STATE_BUSY) )
+	{
+		if (eModulation > PHY_WM6400)
+		{
+			// modulation other than PHY_WM2400 and PHY_WM4800 are forbidden
+			pDevice->SPIInfo.eXferResult = ADF7030_1_INVALID_PHY_CONFIGURATION;
+			PhyLog_ErrPush(pDevice);
+			i32Ret = PHY_STATUS_ERROR;
+		}
+		else
+		{
+			// set modulation
+			if ( eModulation != pPhydev->eModulation)
+			{
+				pPhydev->eModulation = eModulation;
+				// full reconfiguration is required
+				pDevice->bCfgDone = 0;
+			}
+			// set the Channel
+			pPhydev->eChannel = eChannel;
+			i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
+			if (i32Ret == PHY_STATUS_OK)
+			{
+				i32Ret = _do_cmd(pPhydev, PHY_CMD_RX);
+			}
+		}
+	}
+	else
+	{
+		i32Ret = PHY_STATUS_BUSY;
+	}
+    PHY_UNLOCK();
+    return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief  This function execute a Noise Measurement sequence
+ *
+ * @param [in]  pPhydev     Pointer on the Phy device instance
+ * @param [in]  eChannel    Channel on which the Noise must be measured
+ * @param [in]  eModulation Modulation on which the Noise must be measured
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+static int32_t _do_CCA(phydev_t *pPhydev, phy_chan_e eChannel, phy_mod_e eModulation)
+{
+    int32_t i32Ret = PHY_STATUS_OK;
+    adf7030_1_device_t* pDevice = pPhydev->pCxt;
+	PHY_LOCK();
+	if ( !(pDevice->eState & ADF7030_1_STATE_BUSY) && !pDevice->bRxCont )
+	{
+		// set modulation
+		if ( eModulation != pPhydev->eModulation)
+		{
+			pPhydev->eModulation = eModulation;
+			// full reconfiguration is required
+			pDevice->bCfgDone = 0;
+		}
+		// set the Channel
+		pPhydev->eChannel = eChannel;
+
+		i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
+		if (i32Ret == PHY_STATUS_OK)
+		{
+			i32Ret = _do_cmd(pPhydev, PHY_CMD_CCA);
+			if ( i32Ret == PHY_STATUS_OK)
+			{
+				pPhydev->u16_Noise = adf7030_1__GetRawNoise( &(((adf7030_1_device_t*)pPhydev->pCxt)->SPIInfo), NOISE_MEAS_AVG_NB );
+				PHY_STATS_NOISE(pPhydev->eChannel, pPhydev->eModulation, pPhydev->u16_Noise);
+				i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
+				pDevice->eState &= ~ADF7030_1_STATE_NOISE_MEAS;
+			}
+		}
+	}
+	else
+	{
+		i32Ret = PHY_STATUS_BUSY;
+	}
+    PHY_UNLOCK();
+    return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief  This function execute a Listen Before Talk sequence
+ *
+ * @details The noise is sampled in CCA (infinite detection time) and averaged
+ * until the decision is clear (see phy_lbt_t). If the channel is free and
+ * bTxAfter is set, the PHY stay in CCA so that the next TX on the same channel
+ * doesn't need the transition through PHY_ON.
+ *
+ * @param [in]      pPhydev Pointer on the Phy device instance
+ * @param [in, out] pLbt    Pointer on the LBT request and result
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+static int32_t _do_LBT(phydev_t *pPhydev, phy_lbt_t *pLbt)
+{
+    int32_t i32Ret = PHY_STATUS_OK;
+    adf7030_1_device_t* pDevice = pPhydev->pCxt;
+    adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
+    cca_cfg_t cca_cfg;
+    int32_t i32Sum, i32Avg, i32Thr, i32Mrg;
+    uint16_t u16Sample;
+    uint8_t bBusy;
+
+	if ( (pLbt == NULL) || (pLbt->u8NbSample == 0) )
+	{
+		return PHY_STATUS_ERROR;
+	}
+	if (pDevice->eState & ADF7030_1_STATE_BUSY)
+	{
+		return PHY_STATUS_BUSY;
+	}
+	// set modulation
+	if ( pLbt->eModulation != pPhydev->eModulation)
+	{
+		pPhydev->eModulation = pLbt->eModulation;
+		// full reconfiguration is required
+		pDevice->bCfgDone = 0;
+	}
+	// set the Channel
+	pPhydev->eChannel = pLbt->eChannel;
+
+	i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
+	if (i32Ret != PHY_STATUS_OK)
+	{
+		return i32Ret;
+	}
+	// clear DETECTION_TIME in cca_cfg_t (stay in CCA, read-back updated on each sample)
+	cca_cfg.CCA_CFG = adf7030_1__SHADOW_Get(pDevice, ADF7030_1_SHADOW_CCA_CFG);
+	adf7030_1__SHADOW_Set(pDevice, ADF7030_1_SHADOW_CCA_CFG, cca_cfg.CCA_CFG & ~PROFILE_CCA_CFG_DETECTION_TIME_Msk);
+
+	i32Ret = _do_cmd(pPhydev, PHY_CMD_CCA);
+	if (i32Ret == PHY_STATUS_OK)
+	{
+		// in 0.25 dBm unit
+		i32Thr = (int32_t)pLbt->i8Threshold * 4;
+		i32Mrg = (int32_t)pLbt->u8Margin * 4;
+		i32Sum = 0;
+		i32Avg = 0;
+		bBusy = 1;
+		pLbt->u8Nb = 0;
+		while (pLbt->u8Nb < pLbt->u8NbSample)
+		{
+			if (adf7030_1__GetRawNoiseSample(pSPIDevInfo, &u16Sample))
+			{
+				break;
+			}
+			if (pLbt->pSamples)
+			{
+				pLbt->pSamples[pLbt->u8Nb] = u16Sample;
+			}
+			pLbt->u8Nb++;
+			// signed 11 bits
+			i32Sum += (int16_t)(u16Sample << 5) >> 5;
+			i32Avg = i32Sum / pLbt->u8Nb;
+			if (i32Avg >= i32Thr + i32Mrg)
+			{
+				// clearly busy
+				break;
+			}
+			if ( (pLbt->u8Nb >= PHY_LBT_MIN_FREE_NB) && (i32Avg < i32Thr - i32Mrg) )
+			{
+				// clearly free
+				bBusy = 0;
+				break;
+			}
+		}
+		if (pLbt->u8Nb == pLbt->u8NbSample)
+		{
+			bBusy = (i32Avg >= i32Thr)?(1):(0);
+		}
+		pLbt->bBusy = bBusy;
+		pLbt->u16Noise = (uint16_t)i32Avg & 0x7FF;
+		pPhydev->u16_Noise = pLbt->u16Noise;
+		pDevice->eState &= ~ADF7030_1_STATE_NOISE_MEAS;
+		if (pLbt->u8Nb)
+		{
+			PHY_STATS_NOISE(pPhydev->eChannel, pPhydev->eModulation, pLbt->u16Noise);
+		}
+		if (pLbt->u8Nb == 0)
+		{
+			i32Ret = PHY_STATUS_ERROR;
+		}
+		else if ( !bBusy && pLbt->bTxAfter )
+		{
+			// Leave the PHY in CCA, the next TX takes it from there
+			pDevice->bLbtTx = 1;
+		}
+	}
+	// Revert DETECTION_TIME (read on CCA entry)
+	adf7030_1__SHADOW_Set(pDevice, ADF7030_1_SHADOW_CCA_CFG, cca_cfg.CCA_CFG);
+	if ( !pDevice->bLbtTx )
+	{
+		if (_do_cmd(pPhydev, PHY_CTL_CMD_READY) != PHY_STATUS_OK)
+		{
+			i32Ret = PHY_STATUS_ERROR;
+		}
+	}
+    return i32Ret;
+}
+
+/*!
+ * @static
+ * @brief  This function execute a noise scan
+ *
+ * @details For each requested modulation, the PHY is configured and set in CCA
+ * (infinite detection time) on the first requested channel. Then, from one
+ * channel to the next, it is only set back to PHY_ON, the channel frequency is
+ * written and it is set in CCA again : no full ready and TRX sequence between
+ * two measures. The noise samples of each channel are averaged.
+ *
+ * @param [in]      pPhydev Pointer on the Phy device instance
+ * @param [in, out] pScan   Pointer on the scan request and result
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ *
+ */
+static int32_t _noise_scan(phydev_t *pPhydev, phy_scan_t *pScan)
+{
+    int32_t i32Ret = PHY_STATUS_OK;
+    adf7030_1_device_t* pDevice = pPhydev->pCxt;
+    adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
+    cca_cfg_t cca_cfg;
+    int32_t i32Sum;
+    uint16_t u16Sample;
+    uint8_t eMod, eCh, u8Nb;
+    uint8_t bInCca;
+
+	if ( (pScan == NULL) || (pScan->u8NbSample == 0) )
+	{
+		return PHY_STATUS_ERROR;
+	}
+	if (pDevice->eState & ADF7030_1_STATE_BUSY)
+	{
+		return PHY_STATUS_BUSY;
+	}
+	memset(pScan->aNoise, 0, sizeof(pScan->aNoise));
+	pScan->u8Nb = 0;
+
+	for (eMod = 0; (eMod < PHY_NB_MOD) && (i32Ret == PHY_STATUS_OK); eMod++)
+	{
+		if ( !(pScan->u8ModMsk & (1 << eMod)) )
+		{
+			continue;
+		}
+		bInCca = 0;
+		for (eCh = 0; eCh < PHY_NB_CH; eCh++)
+		{
+			if ( !(pScan->u8ChMsk & (1 << eCh)) )
+			{
+				continue;
+			}
+			pPhydev->eChannel = eCh;
+			if (!bInCca)
+			{
+				// set modulation
+				if ( eMod != pPhydev->eModulation)
+				{
+					pPhydev->eModulation = eMod;
+					// full reconfiguration is required
+					pDevice->bCfgDone = 0;
+				}
+				i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
+				if (i32Ret != PHY_STATUS_OK)
+				{
+					break;
+				}
+				// clear DETECTION_TIME in cca_cfg_t (stay in CCA, read-back updated on each sample)
+				cca_cfg.CCA_CFG = adf7030_1__SHADOW_Get(pDevice, ADF7030_1_SHADOW_CCA_CFG);
+				adf7030_1__SHADOW_Set(pDevice, ADF7030_1_SHADOW_CCA_CFG, cca_cfg.CCA_CFG & ~PROFILE_CCA_CFG_DETECTION_TIME_Msk);
+				bInCca = 1;
+				i32Ret = _do_cmd(pPhydev, PHY_CMD_CCA);
+			}
+			else
+			{
+				// Retune only (same frequency as set by _trx_seq)
+				if ( adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, PHY_ON, PHY_ON ) )
+				{
+					i32Ret = PHY_STATUS_ERROR;
+				}
+				else
+				{
+					adf7030_1__SHADOW_Set(pDevice, ADF7030_1_SHADOW_CH_FREQ, _ch_freq(pPhydev, eCh));
+					if ( pSPIDevInfo->eXferResult || adf7030_1__STATE_PhyCMD_WaitReady( pSPIDevInfo, CCA, CCA ) )
+					{
+						i32Ret = PHY_STATUS_ERROR;
+					}
+				}
+			}
+			if (i32Ret != PHY_STATUS_OK)
+			{
+				break;
+			}
+			i32Sum = 0;
+			for (u8Nb = 0; u8Nb < pScan->u8NbSample; u8Nb++)
+			{
+				if (adf7030_1__GetRawNoiseSample(pSPIDevInfo, &u16Sample))
+				{
+					break;
+				}
+				// signed 11 bits
+				i32Sum += (int16_t)(u16Sample << 5) >> 5;
+			}
+			if (u8Nb == 0)
+			{
+				i32Ret = PHY_STATUS_ERROR;
+				break;
+			}
+			pScan->aNoise[eMod][eCh] = (uint16_t)(i32Sum / u8Nb) & 0x7FF;
+			pScan->u8Nb++;
+			PHY_STATS_NOISE(eCh, eMod, pScan->aNoise[eMod][eCh]);
 		}
-		else if (pDevice->eState & ADF7030_1_STATE_NOISE_MEAS)
+		if (bInCca)
 		{
+			// Revert DETECTION_TIME (read on CCA entry)
+			adf7030_1__SHADOW_Set(pDevice, ADF7030_1_SHADOW_CCA_CFG, cca_cfg.CCA_CFG);
 			pDevice->eState &= ~ADF7030_1_STATE_NOISE_MEAS;
+			if (_do_cmd(pPhydev, PHY_CTL_CMD_READY) != PHY_STATUS_OK)
+			{
+				i32Ret = PHY_STATUS_ERROR;
+			}
 		}
-		else // abort TX or RX ?
-		{}
-	}
-
-	if(u32IrqStatus == 0 )
-	{
-		eEvt = PHYDEV_EVT_ERROR;
-	}
-
-    // just to help debug
-    pDevice->IntGPIOInfo[ADF7030_1_INTPIN0].nIntStatus = u32IrqStatus;
-    // clear interrupt status
-    adf7030_1__ClrIrqStatus(pSPIDevInfo, ADF7030_1_INTPIN0);
-    // event notification
-    if( (eEvt != PHYDEV_EVT_NONE) && pPhydev->pfEvtCb ) {
-		pPhydev->pfEvtCb(pPhydev->pCbParam, eEvt);
 	}
+	pPhydev->u16_Noise = (pScan->u8Nb)?(pScan->aNoise[pPhydev->eModulation][pPhydev->eChannel]):(pPhydev->u16_Noise);
+    return i32Ret;
 }
 
 /*!
- * @brief  Interruption handler as an instrumentation
+ * @static
+ * @brief  This function run the SPI micro-benchmark
  *
- * @param [in] p_CbParam Pointer on call-back parameter
- * @param [in] p_Arg     Pointer on call-back argument
+ * @details Back to back reads of the MISC_FW register (register profile) or of
+ * the packet buffer (bulk profile). The PHY must be awake.
+ *
+ * @param [in]      pPhydev Pointer on the Phy device instance
+ * @param [in, out] pBench  Pointer on the benchmark request and result
+ *
+ * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
+ * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
+ * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
  *
- * @return None
  */
-static void _instrum_it(void *p_CbParam, void *p_Arg)
+static int32_t _spi_bench(phydev_t *pPhydev, phy_spi_bench_t *pBench)
 {
-	phydev_t *pPhydev = (phydev_t *) p_CbParam;
-    adf7030_1_device_t* pDevice = (adf7030_1_device_t*)pPhydev->pCxt;
+    adf7030_1_device_t* pDevice = pPhydev->pCxt;
     adf7030_1_spi_info_t* pSPIDevInfo = &(pDevice->SPIInfo);
-    uint32_t u32IrqStatus;
+    uint8_t aBuf[PHY_SPI_BENCH_BULK_SZ];
+    data_blck_desc_t sBlock;
 
-    u32IrqStatus = adf7030_1__GetIrqStatus(pSPIDevInfo, ADF7030_1_INTPIN1);
-    // just to help debug
-    pDevice->IntGPIOInfo[ADF7030_1_INTPIN1].nIntStatus = u32IrqStatus;
-    // clear interrupt status
-    adf7030_1__ClrIrqStatus(pSPIDevInfo, ADF7030_1_INTPIN1);
+    pBench->u16Done = 0;
+    if (pSPIDevInfo->nPhyState == PHY_SLEEP)
+    {
+        return PHY_STATUS_BUSY;
+    }
+    sBlock.Addr = PARAM_ADF7030_1_SRAM_BASE | (GENERIC_PKT_BUFF_CFG0_PTR_TX_BASE_Rst << 2);
+    sBlock.pData = aBuf;
+    sBlock.WordXfer = 0;
+    sBlock.Size = sizeof(aBuf);
+    while (pBench->u16Done < pBench->u16Nb)
+    {
+        if (pBench->bBulk)
+        {
+            if (adf7030_1__ReadDataBlock(pSPIDevInfo, &sBlock))
+            {
+                break;
+            }
+            sBlock.pData = aBuf;
+        }
+        else
+        {
+            adf7030_1__SPI_GetMem32(pSPIDevInfo, MISC_FW_Addr);
+            if (pSPIDevInfo->eXferResult)
+            {
+                break;
+            }
+        }
+        pBench->u16Done++;
+    }
+    return (pBench->u16Done == pBench->u16Nb)?(PHY_STATUS_OK):(PHY_STATUS_ERROR);
 }
 
-/******************************************************************************/
-/******************************************************************************/
-
+#if defined (USE_PHY_SCHED)
 /*!
  * @static
- * @brief  This function execute a TX sequence
+ * @brief  This function wait for a scheduled TX or RX
  *
- * @param [in]  pPhydev     Pointer on the Phy device instance
- * @param [in]  eChannel    Channel use to TX
- * @param [in]  eModulation Modulation use to TX
+ * @details Check the request, then block until PHY_SCHED_LEAD_US before the
+ * start time. Called without the PHY lock, so the other PHY requests are not
+ * delayed meanwhile.
+ *
+ * @param [in]  pSched  Pointer on the scheduled TX or RX request
  *
  * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
- * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
  * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
  *
  */
-static int32_t _do_TX(phydev_t *pPhydev, phy_chan_e eChannel, phy_mod_e eModulation)
+static int32_t _sched_wait(phy_sched_t *pSched)
 {
-    int32_t i32Ret = PHY_STATUS_OK;
-    adf7030_1_device_t* pDevice = pPhydev->pCxt;
-	if ( !(pDevice->eState & ADF7030_1_STATE_BUSY) )
-	{
-		// set modulation
-		if ( eModulation != pPhydev->eModulation)
-		{
-			pPhydev->eModulation = eModulation;
-			// full reconfiguration is required
-			pDevice->bCfgDone = 0;
-		}
-		// set the Channel
-		pPhydev->eChannel = eChannel;
+	int32_t i32Delta;
 
-		i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
-		if (i32Ret == PHY_STATUS_OK)
-		{
-			uint8_t u8Sz = 0;
-			if (eModulation == PHY_WM6400)
-			{
-				// from here, configuration for WM6400 has been done (set in CFG file)
-				// - raw mode is already selected
-				// - CRC is disable
-				// - PREAMBLE and SYNC word are set in the TX packet buffer
-				// - adjust the TX buffer address (offset)
-				// So, to take into account PREAMBLE and SYNCHRO words :
-				// - adjust the payload length
-				u8Sz = (PHY_WM6400_PREAMBLE_SIZE/8) + (PHY_WM6400_SYNC_WORD_SIZE/8);
-			}
-			// set payload length
-			adf7030_1__SPI_SetField(&(pDevice->SPIInfo),
-					GENERIC_PKT_FRAME_CFG1_PAYLOAD_SIZE_Addr,
-					GENERIC_PKT_FRAME_CFG1_PAYLOAD_SIZE_Pos,
-					GENERIC_PKT_FRAME_CFG1_PAYLOAD_SIZE_Size,
-					(uint32_t)(pDevice->u8PendTXBuffSize + u8Sz)
-					);
-			pDevice->u8PendTXBuffSize = 0;
-			i32Ret = _do_cmd(pPhydev, PHY_CMD_TX);
-		}
+	if ( !pSched || !HiResTime_IsEnabled() ||
+	     ( (pSched->eCmd != PHY_CMD_TX) && (pSched->eCmd != PHY_CMD_RX) ) )
+	{
+		return PHY_STATUS_ERROR;
 	}
-	else
+	i32Delta = (int32_t)(pSched->u32Time - HiResTime_Now());
+	if (i32Delta < PHY_SCHED_MIN_US)
 	{
-		i32Ret = PHY_STATUS_BUSY;
+		// Already too late
+		return PHY_STATUS_ERROR;
 	}
-    return i32Ret;
+	// The start time is given by HiResTime (TIM2), then by the LPTIM1 (PCLK) :
+	// no STOP mode until the pulse is given or cancelled, even while the radio sleeps
+	BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_PHY_SCHED, 1);
+	if (i32Delta > PHY_SCHED_LEAD_US)
+	{
+		vTaskDelay(pdMS_TO_TICKS( (i32Delta - PHY_SCHED_LEAD_US) / 1000 ));
+	}
+	return PHY_STATUS_OK;
 }
 
 /*!
  * @static
- * @brief  This function execute an RX sequence
+ * @brief  This function execute a TX or RX sequence started at a given time
  *
- * @param [in]  pPhydev     Pointer on the Phy device instance
- * @param [in]  eChannel    Channel use to RX
- * @param [in]  eModulation Modulation use to RX
+ * @details Called under the PHY lock, after _sched_wait. Do the usual TX or
+ * RX sequence but the trigger pulse, left to the LPTIM interrupt (see
+ * _sched_arm).
+ *
+ * @param [in]  pPhydev Pointer on the Phy device instance
+ * @param [in]  pSched  Pointer on the scheduled TX or RX request
  *
  * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
  * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
  * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
  *
  */
-static int32_t _do_RX(phydev_t *pPhydev, phy_chan_e eChannel, phy_mod_e eModulation)
+static int32_t _sched(phydev_t *pPhydev, phy_sched_t *pSched)
 {
-    int32_t i32Ret = PHY_STATUS_OK;
-    adf7030_1_device_t* pDevice = pPhydev->pCxt;
-	if ( !(pDevice->eState & ADF7030_1_STATE_BUSY) )
+	int32_t i32Ret;
+
+	u32SchedTime = pSched->u32Time;
+	bSchedArm = 1;
+	if (pSched->eCmd == PHY_CMD_TX)
 	{
-		if (eModulation > PHY_WM6400)
-		{
-			// modulation other than PHY_WM2400 and PHY_WM4800 are forbidden
-			pDevice->SPIInfo.eXferResult = ADF7030_1_INVALID_PHY_CONFIGURATION;
-			i32Ret = PHY_STATUS_ERROR;
-		}
-		else
-		{
-			// set modulation
-			if ( eModulation != pPhydev->eModulation)
-			{
-				pPhydev->eModulation = eModulation;
-				// full reconfiguration is required
-				pDevice->bCfgDone = 0;
-			}
-			// set the Channel
-			pPhydev->eChannel = eChannel;
-			i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
-			if (i32Ret == PHY_STATUS_OK)
-			{
-				i32Ret = _do_cmd(pPhydev, PHY_CMD_RX);
-			}
-		}
+		i32Ret = _do_TX(pPhydev, pSched->eChannel, pSched->eModulation);
 	}
 	else
 	{
-		i32Ret = PHY_STATUS_BUSY;
+		i32Ret = _do_RX(pPhydev, pSched->eChannel, pSched->eModulation);
 	}
-    return i32Ret;
+	// Not consumed if the sequence failed before the command
+	bSchedArm = 0;
+	return i32Ret;
 }
 
 /*!
  * @static
- * @brief  This function execute a Noise Measurement sequence
+ * @brief  This function arm the LPTIM to pulse the trigger pin at the
+ *         scheduled time
  *
- * @param [in]  pPhydev     Pointer on the Phy device instance
- * @param [in]  eChannel    Channel on which the Noise must be measured
- * @param [in]  eModulation Modulation on which the Noise must be measured
+ * @details The PHY is in PHY_ON, the trigger pin is set on the TX or RX
+ * command. If it is too late, the state is reverted (nothing is started).
  *
- * @retval PHY_STATUS_OK (see phy_status_e::PHY_STATUS_OK)
- * @retval PHY_STATUS_BUSY (see phy_status_e::PHY_STATUS_BUSY)
- * @retval PHY_STATUS_ERROR (see phy_status_e::PHY_STATUS_ERROR)
+ * @param [in]  pPhydev Pointer on the Phy device instance
+ *
+ * @retval 0 Armed
+ * @retval 1 Too late (or too far for the LPTIM)
  *
  */
-static int32_t _do_CCA(phydev_t *pPhydev, phy_chan_e eChannel, phy_mod_e eModulation)
+static uint8_t _sched_arm(phydev_t *pPhydev)
 {
-    int32_t i32Ret = PHY_STATUS_OK;
-    adf7030_1_device_t* pDevice = pPhydev->pCxt;
-	if ( !(pDevice->eState & ADF7030_1_STATE_BUSY) )
+	adf7030_1_device_t* pDevice = pPhydev->pCxt;
+	int32_t i32Delta;
+	uint32_t u32Cnt = 0;
+
+	u32SchedFired = 0;
+	bSchedPend = 1;
+	// No preemption between the time read and the LPTIM start
+	taskENTER_CRITICAL();
+	i32Delta = (int32_t)(u32SchedTime - HiResTime_Now()) - PHY_SCHED_ADJ_US;
+	if (i32Delta >= PHY_SCHED_MIN_US)
 	{
-		// set modulation
-		if ( eModulation != pPhydev->eModulation)
-		{
-			pPhydev->eModulation = eModulation;
-			// full reconfiguration is required
-			pDevice->bCfgDone = 0;
-		}
-		// set the Channel
-		pPhydev->eChannel = eChannel;
+		u32Cnt = BSP_LpTimer_StartUs(PHY_SCHED_LPTIM_ID, (uint32_t)i32Delta);
+	}
+	taskEXIT_CRITICAL();
+	if (!u32Cnt)
+	{
+		bSchedPend = 0;
+		pDevice->eState &= ~(ADF7030_1_STATE_TRANSMITTING | ADF7030_1_STATE_RECEIVING);
+		pDevice->SPIInfo.eXferResult = ADF7030_1_INVALID_OPERATION;
+		return 1;
+	}
+	return 0;
+}
 
-		i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
-		if (i32Ret == PHY_STATUS_OK)
-		{
-			i32Ret = _do_cmd(pPhydev, PHY_CMD_CCA);
-			if ( i32Ret == PHY_STATUS_OK)
-			{
-				pPhydev->u16_Noise = adf7030_1__GetRawNoise( &(((adf7030_1_device_t*)pPhydev->pCxt)->SPIInfo), NOISE_MEAS_AVG_NB );
-				i32Ret = _do_cmd(pPhydev, PHY_CTL_CMD_READY);
-				pDevice->eState &= ~ADF7030_1_STATE_NOISE_MEAS;
-			}
-		}
+/*!
+ * @static
+ * @brief  This function cancel the pending scheduled TX or RX
+ *
+ * @details The PHY stays in PHY_ON (the trigger pin is left set).
+ *
+ * @param [in]  pPhydev Pointer on the Phy device instance
+ *
+ * @return None
+ */
+static void _sched_cancel(phydev_t *pPhydev)
+{
+	adf7030_1_device_t* pDevice = pPhydev->pCxt;
+
+	BSP_LpTimer_Stop(PHY_SCHED_LPTIM_ID);
+	// Check again, the pulse could have been given meanwhile
+	if (bSchedPend)
+	{
+		bSchedPend = 0;
+		pDevice->eState &= ~(ADF7030_1_STATE_TRANSMITTING | ADF7030_1_STATE_RECEIVING);
 	}
-	else
+	BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_PHY_SCHED, 0);
+}
+
+/*!
+ * @static
+ * @brief  LPTIM compare match interruption handler : pulse the trigger pin
+ *
+ * @details Above the RTOS interrupt priority, no RTOS call.
+ *
+ * @return None
+ */
+static void _sched_it(void)
+{
+	if (bSchedPend)
 	{
-		i32Ret = PHY_STATUS_BUSY;
+		u32SchedFired = HiResTime_Now();
+		adf7030_1_PulseTrigger(pSchedDevice, ADF7030_1_TRIGPIN0);
+		bSchedPend = 0;
+		BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_PHY_SCHED, 0);
 	}
-    return i32Ret;
 }
+#endif
 
 /*!
  * @static
@@ -1628,6 +3541,7 @@ static int32_t _set_send(phydev_t *pPhydev, uint8_t *pBuf, uint8_t u8Len)
     adf7030_1_device_t* pDevice = pPhydev->pCxt;
     if(pBuf && u8Len )
     {
+    	PHY_LOCK();
     	if (!(pDevice->eState & ADF7030_1_STATE_TRANSMITTING ))
     	{
 			if ( !(pDevice->eState & ADF7030_1_STATE_READY ) )
@@ -1661,6 +3575,7 @@ static int32_t _set_send(phydev_t *pPhydev, uint8_t *pBuf, uint8_t u8Len)
     	else {
     		i32Ret = PHY_STATUS_BUSY;
     	}
+    	PHY_UNLOCK();
     }
     return i32Ret;
 }
@@ -1682,9 +3597,29 @@ static int32_t _get_recv(phydev_t *pPhydev, uint8_t *pBuf, uint8_t* u8Len)
 {
 	int32_t i32Ret = PHY_STATUS_ERROR;
     adf7030_1_device_t* pDevice = pPhydev->pCxt;
+    phy_rx_frame_t *pFrame;
     if(pBuf && u8Len )
     {
-    	if (!(pDevice->eState & ADF7030_1_STATE_RECEIVING ) )
+    	PHY_LOCK();
+    	pFrame = _rx_pool_peek();
+    	if (pFrame || pDevice->bRxCont)
+    	{
+    		// Continuous RX : the frame is already read
+    		if (pFrame)
+    		{
+    			memcpy(pBuf, pFrame->aData, pFrame->u8Len);
+    			*u8Len = pFrame->u8Len;
+    			pPhydev->u16_Rssi = pFrame->u16Rssi;
+    			pPhydev->u16_Ferr = pFrame->u16Ferr;
+    			_rx_pool_free();
+    			i32Ret = PHY_STATUS_OK;
+    		}
+    		else
+    		{
+    			i32Ret = PHY_STATUS_BUSY;
+    		}
+    	}
+    	else if (!(pDevice->eState & ADF7030_1_STATE_RECEIVING ) )
 		{
 			if ( !(pDevice->eState & ADF7030_1_STATE_READY ) )
 			{
@@ -1700,6 +3635,8 @@ static int32_t _get_recv(phydev_t *pPhydev, uint8_t *pBuf, uint8_t* u8Len)
 				if ( !(adf7030_1__GetRxPacket( &(pDevice->SPIInfo), pBuf, u8Len )) )
 				{
 					pPhydev->u16_Rssi = adf7030_1__GetRawRSSI( &(pDevice->SPIInfo));
+					PHY_STATS_RX(pPhydev->eChannel, pPhydev->eModulation, pPhydev->u16_Rssi, pPhydev->u16_Ferr);
+					PHY_AFC_TRACK(pPhydev, pPhydev->u16_Rssi, pPhydev->u16_Ferr);
 				}
 				else
 				{
@@ -1710,6 +3647,7 @@ static int32_t _get_recv(phydev_t *pPhydev, uint8_t *pBuf, uint8_t* u8Len)
     	else {
     		i32Ret = PHY_STATUS_BUSY;
     	}
+    	PHY_UNLOCK();
     }
     return i32Ret;
 }
@@ -1737,8 +3675,22 @@ static int32_t _ioctl(phydev_t *pPhydev, uint32_t eCtl, uint32_t args)
 	{
 		return PHY_STATUS_ERROR;
 	}
+#if defined (USE_PHY_SCHED)
+	if ( (eCtl == PHY_CMD_SCHED) && _sched_wait((phy_sched_t*)(uintptr_t)args) )
+	{
+		return PHY_STATUS_ERROR;
+	}
+#endif
+	PHY_LOCK();
 
-	if(eCtl > PHY_CTL_CMD)
+	if ( pDevice->bRxCont && (eCtl > PHY_CTL_CMD) &&
+	     (eCtl != PHY_CMD_RX_CONT) && (eCtl != PHY_CMD_RX_POP) && (eCtl != PHY_CMD_RX_STAGE) &&
+	     (eCtl != PHY_CMD_SLEEP_MODE) && (eCtl != PHY_CMD_SCHED_START) )
+	{
+		// Continuous RX : the end of frame restarts the RX, so the PHY state is not the caller one
+		i32Ret = PHY_STATUS_BUSY;
+	}
+	else if(eCtl > PHY_CTL_CMD)
 	{
 		if (eCtl == PHY_CMD_SPORT)
 		{
@@ -1769,6 +3721,84 @@ static int32_t _ioctl(phydev_t *pPhydev, uint32_t eCtl, uint32_t args)
 		{
 			i32Ret = _rssi_calibrate_seq(pPhydev, (int8_t)(args & 0xFF));
 		}
+		else if (eCtl == PHY_CMD_SLEEP_MODE)
+		{
+			// Take effect on the next PHY_SLEEP
+			pDevice->bColdSleep = (args)?(1):(0);
+		}
+		else if (eCtl == PHY_CMD_RX_CONT)
+		{
+			// Take effect on the next end of received frame
+			if (args && !pDevice->bRxCont)
+			{
+				u8RxPoolOut = u8RxPoolIn;
+				u32RxPoolDrop = 0;
+			}
+			pDevice->bRxCont = (args)?(1):(0);
+		}
+		else if (eCtl == PHY_CMD_RX_STAGE)
+		{
+			pDevice->u8RxStage = RX_STAGE_NONE;
+			if ( ((rx_stage_info_t)args).bEnable )
+			{
+				pDevice->u8RxStageCh = ((rx_stage_info_t)args).eChannel;
+				pDevice->u8RxStageMod = ((rx_stage_info_t)args).eModulation;
+				// Written at the next TX end of frame
+				pDevice->u8RxStage = RX_STAGE_REQ;
+			}
+		}
+		else if (eCtl == PHY_CMD_CAL_ENV)
+		{
+			i32Ret = _cal_env_seq(pPhydev, (cal_env_info_t)args);
+		}
+		else if (eCtl == PHY_CMD_LBT)
+		{
+			i32Ret = _do_LBT(pPhydev, (phy_lbt_t*)(uintptr_t)args);
+		}
+		else if (eCtl == PHY_CMD_NOISE_SCAN)
+		{
+			i32Ret = _noise_scan(pPhydev, (phy_scan_t*)(uintptr_t)args);
+		}
+		else if (eCtl == PHY_CMD_SPI_BENCH)
+		{
+			i32Ret = _spi_bench(pPhydev, (phy_spi_bench_t*)(uintptr_t)args);
+		}
+		else if (eCtl == PHY_CMD_SCHED)
+		{
+#if defined (USE_PHY_SCHED)
+			i32Ret = _sched(pPhydev, (phy_sched_t*)(uintptr_t)args);
+#else
+			i32Ret = PHY_STATUS_ERROR;
+#endif
+		}
+		else if (eCtl == PHY_CMD_SCHED_START)
+		{
+#if defined (USE_PHY_SCHED)
+			if (args)
+			{
+				*(uint32_t*)(uintptr_t)args = u32SchedFired;
+			}
+			else
+#endif
+			{
+				i32Ret = PHY_STATUS_ERROR;
+			}
+		}
+		else if (eCtl == PHY_CMD_RX_POP)
+		{
+			phy_rx_frame_t *pFrame = _rx_pool_peek();
+			if (pFrame && args)
+			{
+				*(phy_rx_frame_t*)(uintptr_t)args = *pFrame;
+				pPhydev->u16_Rssi = pFrame->u16Rssi;
+				pPhydev->u16_Ferr = pFrame->u16Ferr;
+				_rx_pool_free();
+			}
+			else
+			{
+				i32Ret = PHY_STATUS_ERROR;
+			}
+		}
 		else
 		{
 			i32Ret = _do_cmd(pPhydev, eCtl);
@@ -1780,9 +3810,9 @@ static int32_t _ioctl(phydev_t *pPhydev, uint32_t eCtl, uint32_t args)
 		{
 			if(pSPIDevInfo->eXferResult)
 			{
-				//*((char*)args) = getErrMsg(pDevice);
-				uint32_t tt = (uint32_t)getErrMsg(pDevice);
-				*((uint32_t*)args) = tt;
+				//*((char*)(uintptr_t)args) = getErrMsg(pDevice);
+				uint32_t tt = (uint32_t)(uintptr_t)getErrMsg(pDevice);
+				*((uint32_t*)(uintptr_t)args) = tt;
 			}
 			pSPIDevInfo->eXferResult = 0;
 		}
@@ -1797,24 +3827,16 @@ static int32_t _ioctl(phydev_t *pPhydev, uint32_t eCtl, uint32_t args)
 					pPhydev->i16TxFreqOffset = (int16_t)args;
 					break;
 				case PHY_CTL_SET_TX_POWER:
-					if ( (phy_power_e)args != pPhydev->eTxPower)
-					{
-						pPhydev->eTxPower = (phy_power_e)args;
-						// run-time configure TX power is required
-						((adf7030_1_device_t*)pPhydev->pCxt)->bTxPwrDone = 0;
-					}
+					// written with the next TX or RX setup
+					pPhydev->eTxPower = (phy_power_e)args;
 					break;
 				case PHY_CTL_SET_PWR_ENTRY:
-					if ( ((phy_power_entry_t*)args)->eEntryId < PHY_NB_PWR)
+					if ( ((phy_power_entry_t*)(uintptr_t)args)->eEntryId < PHY_NB_PWR)
 					{
-						aPhyPower[((phy_power_entry_t*)args)->eEntryId].coarse = ((phy_power_entry_t*)args)->sEntryValue.coarse;
-						aPhyPower[((phy_power_entry_t*)args)->eEntryId].fine = ((phy_power_entry_t*)args)->sEntryValue.fine;
-						aPhyPower[((phy_power_entry_t*)args)->eEntryId].micro = ((phy_power_entry_t*)args)->sEntryValue.micro;
-						if ( ((phy_power_entry_t*)args)->eEntryId == pPhydev->eTxPower)
-						{
-							// run-time configure TX power is required
-							pDevice->bTxPwrDone = 0;
-						}
+						aPhyPower[((phy_power_entry_t*)(uintptr_t)args)->eEntryId].coarse = ((phy_power_entry_t*)(uintptr_t)args)->sEntryValue.coarse;
+						aPhyPower[((phy_power_entry_t*)(uintptr_t)args)->eEntryId].fine = ((phy_power_entry_t*)(uintptr_t)args)->sEntryValue.fine;
+						aPhyPower[((phy_power_entry_t*)(uintptr_t)args)->eEntryId].micro = ((phy_power_entry_t*)(uintptr_t)args)->sEntryValue.micro;
+						_tx_pwr_build();
 					}
 					else
 					{
@@ -1822,11 +3844,11 @@ static int32_t _ioctl(phydev_t *pPhydev, uint32_t eCtl, uint32_t args)
 					}
 					break;
 				case PHY_CTL_GET_PWR_ENTRY:
-					if ( ((phy_power_entry_t*)args)->eEntryId < PHY_NB_PWR)
+					if ( ((phy_power_entry_t*)(uintptr_t)args)->eEntryId < PHY_NB_PWR)
 					{
-						((phy_power_entry_t*)args)->sEntryValue.coarse = aPhyPower[((phy_power_entry_t*)args)->eEntryId].coarse;
-						((phy_power_entry_t*)args)->sEntryValue.fine = aPhyPower[((phy_power_entry_t*)args)->eEntryId].fine;
-						((phy_power_entry_t*)args)->sEntryValue.micro = aPhyPower[((phy_power_entry_t*)args)->eEntryId].micro;
+						((phy_power_entry_t*)(uintptr_t)args)->sEntryValue.coarse = aPhyPower[((phy_power_entry_t*)(uintptr_t)args)->eEntryId].coarse;
+						((phy_power_entry_t*)(uintptr_t)args)->sEntryValue.fine = aPhyPower[((phy_power_entry_t*)(uintptr_t)args)->eEntryId].fine;
+						((phy_power_entry_t*)(uintptr_t)args)->sEntryValue.micro = aPhyPower[((phy_power_entry_t*)(uintptr_t)args)->eEntryId].micro;
 					}
 					else
 					{
@@ -1834,34 +3856,42 @@ static int32_t _ioctl(phydev_t *pPhydev, uint32_t eCtl, uint32_t args)
 					}
 					break;
 				case PHY_CTL_GET_PA:
-					*(uint8_t*)args = (BSP_PwrLine_Get(PA_EN_MSK))?(1):(0);
+					*(uint8_t*)(uintptr_t)args = (BSP_PwrLine_Get(PA_EN_MSK))?(1):(0);
 					break;
 				case PHY_CTL_GET_TX_FREQ_OFF:
-					*(uint8_t*)args = pPhydev->i16TxFreqOffset;
+					*(uint8_t*)(uintptr_t)args = pPhydev->i16TxFreqOffset;
 					break;
 				case PHY_CTL_GET_TX_POWER:
-					*(uint8_t*)args = pPhydev->eTxPower;
+					*(uint8_t*)(uintptr_t)args = pPhydev->eTxPower;
 					break;
 				case PHY_CTL_GET_FREQ_ERR:
-					*(float*)args = PHY_CONV_AfcFreqErrToFloat( pPhydev->u16_Ferr );
+					*(float*)(uintptr_t)args = PHY_CONV_AfcFreqErrToFloat( pPhydev->u16_Ferr );
 					break;
 				case PHY_CTL_GET_RSSI:
-					*(uint8_t*)args = PHY_CONV_Signed11ToRssi( pPhydev->u16_Rssi );
+					*(uint8_t*)(uintptr_t)args = PHY_CONV_Signed11ToRssi( pPhydev->u16_Rssi );
 					break;
 				case PHY_CTL_GET_NOISE:
-					*(uint8_t*)args = PHY_CONV_Signed11ToRssi( pPhydev->u16_Noise );
+					*(uint8_t*)(uintptr_t)args = PHY_CONV_Signed11ToRssi( pPhydev->u16_Noise );
 					break;
 				case PHY_CTL_GET_ERR:
-					*(uint8_t*)args = ((adf7030_1_device_t*)pPhydev->pCxt)->SPIInfo.eXferResult;
+					*(uint8_t*)(uintptr_t)args = ((adf7030_1_device_t*)pPhydev->pCxt)->SPIInfo.eXferResult;
 					break;
 				case PHY_CTL_GET_STATE:
-					*(uint8_t*)args = ((adf7030_1_device_t*)pPhydev->pCxt)->eState;
+					*(uint8_t*)(uintptr_t)args = ((adf7030_1_device_t*)pPhydev->pCxt)->eState;
 					break;
 				default:
 					break;
 			}
 		}
 	}
+#if defined (USE_PHY_SCHED)
+	if ( (eCtl == PHY_CMD_SCHED) && !bSchedPend )
+	{
+		// Not armed (busy, failed or too late) or already given
+		BSP_LowPower_StopInhibit(LP_STOP_INHIBIT_PHY_SCHED, 0);
+	}
+#endif
+	PHY_UNLOCK();
 	return i32Ret;
 }
 
@@ -0,0 +1,318 @@
+/**
+  * @file phy_stats.c
+  * @brief This file implement the PHY signal statistics
+  *
+  * @details For each channel and modulation, the RSSI of the received frames
+  * and the noise level of the CCA / LBT measures update an exponentially
+  * weighted moving average, the minimum, the maximum and a level histogram
+  * (2 dB bins) from which the percentiles are computed on request. The AFC
+  * frequency error of the received frames is averaged. All is integer (1/4 dBm
+  * and raw AFC units), each update is O(1) (the histogram halving when a bin
+  * saturates is amortized).
+  *
+  * The short term EWMA against the long term median tells about a link
+  * degradation, the noise EWMA of each channel gives the quietest one.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup phy_layer
+ * @{
+ *
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined (USE_PHY_STATS)
+
+#include <string.h>
+
+#include "phy_stats.h"
+#include "phy_itf.h"
+#include "adf7030-1_phy_conv.h"
+
+/*!
+ * @brief This struct define the counters of one level
+ */
+typedef struct
+{
+	uint16_t u16Count;
+	int16_t  i16Acc;   /*!< EWMA << PHY_STATS_EWMA_SHIFT */
+	int16_t  i16Min;
+	int16_t  i16Max;
+	uint8_t  aHist[PHY_STATS_HIST_NB];
+} stats_lvl_cnt_t;
+
+/*!
+ * @brief This struct define the counters of one channel and modulation
+ */
+typedef struct
+{
+	stats_lvl_cnt_t sRssi;
+	stats_lvl_cnt_t sNoise;
+	uint16_t u16FerrNb;
+	int32_t  i32FerrSum; /*!< Raw AFC units */
+} stats_cell_t;
+
+static stats_cell_t aStats[PHY_NB_CH][PHY_NB_MOD];
+
+/*!
+ * @static
+ * @brief Update the counters of one level
+ *
+ * @param [in] pCnt  Pointer on the level counters
+ * @param [in] i16Lvl The level (1/4 dBm)
+ *
+ */
+static void _lvl_add(stats_lvl_cnt_t *pCnt, int16_t i16Lvl)
+{
+	int16_t i16Bin;
+	uint8_t i;
+
+	if (pCnt->u16Count == 0)
+	{
+		pCnt->i16Acc = i16Lvl << PHY_STATS_EWMA_SHIFT;
+		pCnt->i16Min = i16Lvl;
+		pCnt->i16Max = i16Lvl;
+	}
+	else
+	{
+		pCnt->i16Acc += i16Lvl - (pCnt->i16Acc >> PHY_STATS_EWMA_SHIFT);
+		if (i16Lvl < pCnt->i16Min)
+		{
+			pCnt->i16Min = i16Lvl;
+		}
+		if (i16Lvl > pCnt->i16Max)
+		{
+			pCnt->i16Max = i16Lvl;
+		}
+	}
+	if (pCnt->u16Count < 0xFFFF)
+	{
+		pCnt->u16Count++;
+	}
+
+	i16Bin = (i16Lvl - 4*PHY_STATS_HIST_MIN) / (4*PHY_STATS_HIST_STEP);
+	if (i16Bin < 0)
+	{
+		i16Bin = 0;
+	}
+	else if (i16Bin >= PHY_STATS_HIST_NB)
+	{
+		i16Bin = PHY_STATS_HIST_NB - 1;
+	}
+	if (pCnt->aHist[i16Bin] == 0xFF)
+	{
+		// Keep the distribution, halve all bins
+		for (i = 0; i < PHY_STATS_HIST_NB; i++)
+		{
+			pCnt->aHist[i] >>= 1;
+		}
+	}
+	pCnt->aHist[i16Bin]++;
+}
+
+/*!
+ * @static
+ * @brief Get the statistics of one level
+ *
+ * @param [in]  pCnt Pointer on the level counters
+ * @param [out] pLvl Pointer on the statistics
+ *
+ */
+static void _lvl_get(const stats_lvl_cnt_t *pCnt, phy_stats_lvl_t *pLvl)
+{
+	int16_t *aPct[3] = { &(pLvl->i16P10), &(pLvl->i16P50), &(pLvl->i16P90) };
+	const uint8_t aPctVal[3] = { 10, 50, 90 };
+	uint32_t u32Total = 0;
+	uint32_t u32Acc = 0;
+	uint8_t i, j;
+
+	memset(pLvl, 0, sizeof(phy_stats_lvl_t));
+	if (pCnt->u16Count == 0)
+	{
+		return;
+	}
+	pLvl->u16Count = pCnt->u16Count;
+	pLvl->i16Ewma = pCnt->i16Acc >> PHY_STATS_EWMA_SHIFT;
+	pLvl->i16Min = pCnt->i16Min;
+	pLvl->i16Max = pCnt->i16Max;
+
+	for (i = 0; i < PHY_STATS_HIST_NB; i++)
+	{
+		u32Total += pCnt->aHist[i];
+	}
+	// first bin where the cumulated count reach the percentile, its center
+	for (i = 0, j = 0; (i < PHY_STATS_HIST_NB) && (j < 3); i++)
+	{
+		u32Acc += pCnt->aHist[i];
+		while ( (j < 3) && (100*u32Acc >= aPctVal[j]*u32Total) )
+		{
+			*(aPct[j]) = 4*PHY_STATS_HIST_MIN + (4*PHY_STATS_HIST_STEP*i) + 2*PHY_STATS_HIST_STEP;
+			if (*(aPct[j]) < pLvl->i16Min)
+			{
+				*(aPct[j]) = pLvl->i16Min;
+			}
+			if (*(aPct[j]) > pLvl->i16Max)
+			{
+				*(aPct[j]) = pLvl->i16Max;
+			}
+			j++;
+		}
+	}
+}
+
+/*!
+ * @brief Clear all the statistics
+ *
+ */
+void PhyStats_Clear(void)
+{
+	memset(aStats, 0, sizeof(aStats));
+}
+
+/*!
+ * @brief Add a received frame measure
+ *
+ * @param [in] u8Ch    The channel (see phy_chan_e)
+ * @param [in] u8Mod   The modulation (see phy_mod_e)
+ * @param [in] u16Rssi The RSSI (ADF7030 signed 11 bits)
+ * @param [in] u16Ferr The AFC frequency error (ADF7030 raw)
+ *
+ */
+void PhyStats_Rx(uint8_t u8Ch, uint8_t u8Mod, uint16_t u16Rssi, uint16_t u16Ferr)
+{
+	stats_cell_t *pCell;
+
+	if ( (u8Ch >= PHY_NB_CH) || (u8Mod >= PHY_NB_MOD) )
+	{
+		return;
+	}
+	pCell = &(aStats[u8Ch][u8Mod]);
+	_lvl_add(&(pCell->sRssi), PHY_CONV_Signed11ToQdBm(u16Rssi));
+
+	if (pCell->u16FerrNb == 0x8000)
+	{
+		// Keep the mean, don't overflow
+		pCell->u16FerrNb >>= 1;
+		pCell->i32FerrSum /= 2;
+	}
+	pCell->u16FerrNb++;
+	pCell->i32FerrSum += (int16_t)u16Ferr;
+}
+
+/*!
+ * @brief Add a noise measure
+ *
+ * @param [in] u8Ch     The channel (see phy_chan_e)
+ * @param [in] u8Mod    The modulation (see phy_mod_e)
+ * @param [in] u16Noise The noise level (ADF7030 signed 11 bits)
+ *
+ */
+void PhyStats_Noise(uint8_t u8Ch, uint8_t u8Mod, uint16_t u16Noise)
+{
+	if ( (u8Ch >= PHY_NB_CH) || (u8Mod >= PHY_NB_MOD) )
+	{
+		return;
+	}
+	_lvl_add(&(aStats[u8Ch][u8Mod].sNoise), PHY_CONV_Signed11ToQdBm(u16Noise));
+}
+
+/*!
+ * @brief Get the statistics of one channel and modulation
+ *
+ * @details Could be preempted by an update, so one level could be slightly
+ * inconsistent (e.g. the count).
+ *
+ * @param [in]  u8Ch   The channel (see phy_chan_e)
+ * @param [in]  u8Mod  The modulation (see phy_mod_e)
+ * @param [out] pStats Pointer on the statistics (all 0 if no measure)
+ *
+ * @retval 0 on success
+ * @retval 1 if a parameter is invalid
+ */
+uint8_t PhyStats_Get(uint8_t u8Ch, uint8_t u8Mod, phy_stats_t *pStats)
+{
+	stats_cell_t *pCell;
+	int32_t i32Sum;
+	uint16_t u16Nb;
+
+	if ( !pStats || (u8Ch >= PHY_NB_CH) || (u8Mod >= PHY_NB_MOD) )
+	{
+		return 1;
+	}
+	pCell = &(aStats[u8Ch][u8Mod]);
+	_lvl_get(&(pCell->sRssi), &(pStats->sRssi));
+	_lvl_get(&(pCell->sNoise), &(pStats->sNoise));
+
+	u16Nb = pCell->u16FerrNb;
+	i32Sum = pCell->i32FerrSum;
+	pStats->u16FerrNb = u16Nb;
+	pStats->i32FerrHz = (u16Nb)?(PHY_CONV_AfcFreqErrToHz(i32Sum / u16Nb)):(0);
+	return 0;
+}
+
+/*!
+ * @brief Get the quietest channel (lowest noise average) for a modulation
+ *
+ * @param [in]  u8Mod     The modulation (see phy_mod_e)
+ * @param [out] pi16Noise Pointer on its noise average (1/4 dBm, could be NULL)
+ *
+ * @return The channel (see phy_chan_e), PHY_NB_CH if none has been measured
+ */
+uint8_t PhyStats_Quietest(uint8_t u8Mod, int16_t *pi16Noise)
+{
+	stats_lvl_cnt_t *pCnt;
+	int16_t i16Best = 0;
+	uint8_t u8Best = PHY_NB_CH;
+	uint8_t i;
+
+	if (u8Mod >= PHY_NB_MOD)
+	{
+		return PHY_NB_CH;
+	}
+	for (i = 0; i < PHY_NB_CH; i++)
+	{
+		pCnt = &(aStats[i][u8Mod].sNoise);
+		if ( pCnt->u16Count && ( (u8Best == PHY_NB_CH) || ((pCnt->i16Acc >> PHY_STATS_EWMA_SHIFT) < i16Best) ) )
+		{
+			i16Best = pCnt->i16Acc >> PHY_STATS_EWMA_SHIFT;
+			u8Best = i;
+		}
+	}
+	if (pi16Noise)
+	{
+		*pi16Noise = i16Best;
+	}
+	return u8Best;
+}
+
+#endif /* USE_PHY_STATS */
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @} */
@@ -0,0 +1,428 @@
+/**
+  * @file phy_trace.c
+  * @brief This file implement the PHY timing trace
+  *
+  * @details Each traced event is time-stamped with the high resolution timer
+  * (1 us) and written in a ring buffer. The slot is reserved with an atomic
+  * increment, so events could be added from the PHY service task, the caller
+  * task and the interrupt handlers without lock. In the same call, the start
+  * and end events of the measured transitions (see phy_trace_lat_e) update
+  * their min, max, sum and latency histogram, from which the average and the
+  * 99th percentile are computed on request. This shared state is only updated
+  * and read in a critical section.
+  *
+  * @copyright 2019, GRDF, Inc.  All rights reserved.
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted (subject to the limitations in the disclaimer
+  * below) provided that the following conditions are met:
+  *    - Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *    - Redistributions in binary form must reproduce the above copyright
+  *      notice, this list of conditions and the following disclaimer in the
+  *      documentation and/or other materials provided with the distribution.
+  *    - Neither the name of GRDF, Inc. nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  *
+  * @par Revision history
+  *
+  * @par 1.0.0 : 2026/10/17
+  * Initial version
+  *
+  *
+  */
+
+/*!
+ * @addtogroup phy_layer
+ * @{
+ *
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined (USE_PHY_TIME_TRACE)
+
+#ifndef HAS_HIRES_TIME_MEAS
+#error "USE_PHY_TIME_TRACE requires HAS_HIRES_TIME_MEAS (time-stamp source)"
+#endif
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <bsp_hires_time.h>
+
+#include "phy_trace.h"
+#include "adf7030-1__state.h"
+
+#if (PHY_TRACE_RING_SIZE & (PHY_TRACE_RING_SIZE - 1))
+#error "PHY_TRACE_RING_SIZE must be a power of 2"
+#endif
+
+/*!
+ * @brief This struct define the statistic counters of one transition
+ */
+typedef struct
+{
+	uint32_t u32Count;
+	uint32_t u32Min;
+	uint32_t u32Max;
+	uint64_t u64Sum;
+	uint16_t aHist[PHY_TRACE_HIST_NB];
+} trace_lat_cnt_t;
+
+/*!
+ * @brief This struct define the trace context
+ */
+typedef struct
+{
+	volatile uint32_t u32Head;                /*!< Next entry index (never wrapped) */
+	uint32_t u32StartMsk;                     /*!< Bit n set : transition n is started */
+	uint32_t aStart[PHY_TRACE_NB_LAT];        /*!< Transition start time-stamp */
+	uint8_t  u8CmdLat;                        /*!< Transition of the pending command */
+	phy_trace_entry_t aRing[PHY_TRACE_RING_SIZE];
+	trace_lat_cnt_t aLat[PHY_TRACE_NB_LAT];
+} phy_trace_t;
+
+static phy_trace_t sTrace;
+
+/*!
+ * @static
+ * @brief Get the histogram bin of a latency
+ *
+ * @details Bins 0 to 3 are 1 us wide, then 4 bins per octave.
+ *
+ * @param [in] u32Us The latency (us)
+ *
+ * @return The bin index
+ */
+static uint8_t _hist_bin(uint32_t u32Us)
+{
+	uint32_t u32Msb;
+	uint32_t u32Bin;
+	if (u32Us < 4)
+	{
+		return (uint8_t)u32Us;
+	}
+	u32Msb = 31 - __builtin_clz(u32Us);
+	u32Bin = 4*(u32Msb - 1) + ((u32Us >> (u32Msb - 2)) & 0x3);
+	return (u32Bin < PHY_TRACE_HIST_NB)?((uint8_t)u32Bin):(PHY_TRACE_HIST_NB - 1);
+}
+
+/*!
+ * @static
+ * @brief Get the upper bound of a histogram bin
+ *
+ * @param [in] u8Bin The bin index
+ *
+ * @return The upper bound (us)
+ */
+static uint32_t _hist_upper(uint8_t u8Bin)
+{
+	uint32_t u32Shift;
+	if (u8Bin < 4)
+	{
+		return u8Bin;
+	}
+	u32Shift = (u8Bin >> 2) - 1;
+	return ((4UL + (u8Bin & 0x3)) << u32Shift) + (1UL << u32Shift) - 1;
+}
+
+/*!
+ * @static
+ * @brief Start a transition measure
+ *
+ * @param [in] u8Lat  The transition (see phy_trace_lat_e)
+ * @param [in] u32Now The current time-stamp
+ *
+ */
+static void _lat_start(uint8_t u8Lat, uint32_t u32Now)
+{
+	sTrace.aStart[u8Lat] = u32Now;
+	sTrace.u32StartMsk |= (1UL << u8Lat);
+}
+
+/*!
+ * @static
+ * @brief End a transition measure (if started), and update its statistics
+ *
+ * @param [in] u8Lat  The transition (see phy_trace_lat_e)
+ * @param [in] u32Now The current time-stamp
+ *
+ */
+static void _lat_end(uint8_t u8Lat, uint32_t u32Now)
+{
+	trace_lat_cnt_t *pLat = &(sTrace.aLat[u8Lat]);
+	uint32_t u32Delta;
+	uint8_t u8Bin;
+	uint8_t i;
+
+	if ( !(sTrace.u32StartMsk & (1UL << u8Lat)) )
+	{
+		return;
+	}
+	sTrace.u32StartMsk &= ~(1UL << u8Lat);
+	u32Delta = u32Now - sTrace.aStart[u8Lat];
+
+	if (pLat->u32Count == 0 || u32Delta < pLat->u32Min)
+	{
+		pLat->u32Min = u32Delta;
+	}
+	if (u32Delta > pLat->u32Max)
+	{
+		pLat->u32Max = u32Delta;
+	}
+	pLat->u32Count++;
+	pLat->u64Sum += u32Delta;
+
+	u8Bin = _hist_bin(u32Delta);
+	if (pLat->aHist[u8Bin] == 0xFFFF)
+	{
+		// Keep the distribution, halve all bins
+		for (i = 0; i < PHY_TRACE_HIST_NB; i++)
+		{
+			pLat->aHist[i] >>= 1;
+		}
+	}
+	pLat->aHist[u8Bin]++;
+}
+
+/*!
+ * @static
+ * @brief Get the transition of a radio command
+ *
+ * @param [in] u8Cmd The command byte
+ *
+ * @return The transition, PHY_TRACE_NB_LAT if not measured
+ */
+static uint8_t _cmd_lat(uint8_t u8Cmd)
+{
+	if ( (u8Cmd & SPECIAL_CMD) != RADIO_CMD )
+	{
+		return PHY_TRACE_NB_LAT;
+	}
+	switch (u8Cmd & ~RADIO_CMD)
+	{
+		case PHY_OFF: return PHY_TRACE_LAT_OFF;
+		case PHY_ON:  return PHY_TRACE_LAT_ON;
+		case CFG_DEV: return PHY_TRACE_LAT_CFG_DEV;
+		case PHY_TX:  return PHY_TRACE_LAT_TX;
+		case PHY_RX:  return PHY_TRACE_LAT_RX;
+		case CCA:     return PHY_TRACE_LAT_CCA;
+		default:      return PHY_TRACE_NB_LAT;
+	}
+}
+
+/*!
+ * @brief Initialize the trace (start the time-stamp source if required)
+ *
+ */
+void PhyTrace_Init(void)
+{
+	if ( !HiResTime_IsEnabled() )
+	{
+		HiResTime_EnDis(1);
+	}
+	PhyTrace_Clear();
+}
+
+/*!
+ * @brief Clear the trace ring and the statistics
+ *
+ */
+void PhyTrace_Clear(void)
+{
+	taskENTER_CRITICAL();
+	memset(&sTrace, 0, sizeof(sTrace));
+	sTrace.u8CmdLat = PHY_TRACE_NB_LAT;
+	taskEXIT_CRITICAL();
+}
+
+/*!
+ * @brief Add an event to the trace (could be called from interrupt)
+ *
+ * @param [in] u8Evt  The event (see phy_trace_evt_e)
+ * @param [in] u16Arg The event argument
+ *
+ */
+void PhyTrace_Add(uint8_t u8Evt, uint16_t u16Arg)
+{
+	uint32_t u32Now = HiResTime_Now();
+	uint32_t u32Idx;
+	phy_trace_entry_t *pEntry;
+	UBaseType_t uxSavedMask;
+
+	// Reserve the slot (LDREX/STREX), so interrupts could preempt safely
+	u32Idx = __atomic_fetch_add(&sTrace.u32Head, 1, __ATOMIC_RELAXED);
+	pEntry = &(sTrace.aRing[u32Idx & (PHY_TRACE_RING_SIZE - 1)]);
+	pEntry->u32Time = u32Now;
+	pEntry->u8Evt = u8Evt;
+	pEntry->u16Arg = u16Arg;
+	pEntry->u8Seq = (uint8_t)u32Idx;
+
+	// The transition state is shared by the tasks and the interrupt handlers.
+	// The FROM_ISR variant only raises BASEPRI (no nesting count), so it is
+	// valid from both.
+	uxSavedMask = taskENTER_CRITICAL_FROM_ISR();
+	switch (u8Evt)
+	{
+		case PHY_TRACE_CMD:
+			sTrace.u8CmdLat = _cmd_lat((uint8_t)u16Arg);
+			if (sTrace.u8CmdLat < PHY_TRACE_NB_LAT)
+			{
+				_lat_start(sTrace.u8CmdLat, u32Now);
+			}
+			if (sTrace.u8CmdLat != PHY_TRACE_LAT_RX && sTrace.u8CmdLat != PHY_TRACE_LAT_ON)
+			{
+				// not a turnaround (PHY_ON then PHY_RX)
+				sTrace.u32StartMsk &= ~(1UL << PHY_TRACE_LAT_TX_EOF_RX);
+			}
+			break;
+		case PHY_TRACE_CMD_DONE:
+			if (sTrace.u8CmdLat < PHY_TRACE_NB_LAT)
+			{
+				_lat_end(sTrace.u8CmdLat, u32Now);
+				if (sTrace.u8CmdLat == PHY_TRACE_LAT_RX)
+				{
+					_lat_end(PHY_TRACE_LAT_TX_EOF_RX, u32Now);
+				}
+				sTrace.u8CmdLat = PHY_TRACE_NB_LAT;
+			}
+			break;
+		case PHY_TRACE_IRQ:
+			if (u16Arg == 0)
+			{
+				_lat_start(PHY_TRACE_LAT_FRM_IRQ, u32Now);
+			}
+			break;
+		case PHY_TRACE_FRM_PROCESS:
+			_lat_end(PHY_TRACE_LAT_FRM_IRQ, u32Now);
+			break;
+		case PHY_TRACE_TX_EOF:
+			_lat_start(PHY_TRACE_LAT_TX_EOF_RX, u32Now);
+			break;
+		case PHY_TRACE_WAKEUP:
+			_lat_start(PHY_TRACE_LAT_WAKEUP, u32Now);
+			break;
+		case PHY_TRACE_READY:
+			if (u16Arg == 0)
+			{
+				_lat_end(PHY_TRACE_LAT_WAKEUP, u32Now);
+			}
+			else
+			{
+				sTrace.u32StartMsk &= ~(1UL << PHY_TRACE_LAT_WAKEUP);
+			}
+			break;
+		default:
+			break;
+	}
+	taskEXIT_CRITICAL_FROM_ISR(uxSavedMask);
+}
+
+/*!
+ * @brief Get the statistics of one transition
+ *
+ * @param [in]  u8Lat The transition (see phy_trace_lat_e)
+ * @param [out] pLat  Pointer on the statistics (all 0 if no measure)
+ *
+ */
+void PhyTrace_GetLat(uint8_t u8Lat, phy_trace_lat_t *pLat)
+{
+	trace_lat_cnt_t sCnt;
+	trace_lat_cnt_t *pCnt = &sCnt;
+	uint32_t u32Total = 0;
+	uint32_t u32Acc = 0;
+	uint8_t i;
+
+	if (!pLat)
+	{
+		return;
+	}
+	memset(pLat, 0, sizeof(phy_trace_lat_t));
+	if (u8Lat >= PHY_TRACE_NB_LAT)
+	{
+		return;
+	}
+	// Consistent copy (could be updated from interrupt)
+	taskENTER_CRITICAL();
+	sCnt = sTrace.aLat[u8Lat];
+	taskEXIT_CRITICAL();
+	if (pCnt->u32Count == 0)
+	{
+		return;
+	}
+	pLat->u32Count = pCnt->u32Count;
+	pLat->u32Min = pCnt->u32Min;
+	pLat->u32Max = pCnt->u32Max;
+	pLat->u32Avg = (uint32_t)(pCnt->u64Sum / pCnt->u32Count);
+
+	for (i = 0; i < PHY_TRACE_HIST_NB; i++)
+	{
+		u32Total += pCnt->aHist[i];
+	}
+	// first bin where the cumulated count reach 99%
+	for (i = 0; i < PHY_TRACE_HIST_NB; i++)
+	{
+		u32Acc += pCnt->aHist[i];
+		if (100*u32Acc >= 99*u32Total)
+		{
+			break;
+		}
+	}
+	pLat->u32P99 = _hist_upper(i);
+	if (pLat->u32P99 > pLat->u32Max)
+	{
+		pLat->u32P99 = pLat->u32Max;
+	}
+}
+
+/*!
+ * @brief Get the last trace entries
+ *
+ * @param [out] pEntry Pointer on the destination buffer
+ * @param [in]  u16Nb  Maximum number of entries to get
+ *
+ * @return The number of entries copied (oldest first). Entries overwritten
+ *         during the copy are skipped.
+ */
+uint16_t PhyTrace_GetLast(phy_trace_entry_t *pEntry, uint16_t u16Nb)
+{
+	uint32_t u32Head = sTrace.u32Head;
+	uint32_t u32Idx;
+	uint16_t u16Cnt = 0;
+
+	if (!pEntry)
+	{
+		return 0;
+	}
+	if (u16Nb > PHY_TRACE_RING_SIZE)
+	{
+		u16Nb = PHY_TRACE_RING_SIZE;
+	}
+	if (u16Nb > u32Head)
+	{
+		u16Nb = (uint16_t)u32Head;
+	}
+	for (u32Idx = u32Head - u16Nb; u32Idx != u32Head; u32Idx++)
+	{
+		pEntry[u16Cnt] = sTrace.aRing[u32Idx & (PHY_TRACE_RING_SIZE - 1)];
+		if (pEntry[u16Cnt].u8Seq == (uint8_t)u32Idx)
+		{
+			u16Cnt++;
+		}
+	}
+	return u16Cnt;
+}
+
+#endif /* USE_PHY_TIME_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @} */
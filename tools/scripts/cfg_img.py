@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Convert an ADF7030-1 "*.cfg" configuration file (ADI design center C array
+format) into a SPI transaction image, ready to be streamed as-is to the PHY
+by adf7030_1__SendConfigImage().
+
+The image keeps the "*.cfg" framing (3 bytes length, then the SPI frame), so
+it stays readable by adf7030_1__SendConfiguration(). Compare to the source:
+ - only 32 bits address block write sequences are accepted,
+ - contiguous sequences are merged into one SPI transaction,
+ - sequences longer than the max frame size are split,
+ - each SPI frame is in wire order (command, address and words big-endian),
+   so it can be sent from flash without any copy or byte reversing.
+
+With "--base", a delta image is produced : it only holds the words of the
+input that differ from the base configuration, so that a PHY configured with
+the base ends up configured as with the full input.
+
+Usage :
+    cfg_img.py [-m MAX_FRAME] [--no-merge] [-b BASE.cfg [-g GAP]] input.cfg output.img
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# 32 bits address block write : WRITE | BLOCK | ADDRESS | LONG
+SPI_MEM_WR_BLK_ADDR_LONG = 0x38
+# ADF7030_1_SPI_MAX_TRX_SIZE (ADF7030_1_SPI_BUFFER_SIZE - 8)
+DEFAULT_MAX_FRAME = 292
+
+
+def parse_cfg(text):
+    """ Extract the bytes from the C array text """
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+    return bytes(int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{1,2})\b', text))
+
+
+def split_seq(blob):
+    """ Return the list of (address, data) block write """
+    seqs = []
+    pos = 0
+    while pos < len(blob):
+        if pos + 8 > len(blob):
+            raise ValueError("truncated sequence at offset %d" % pos)
+        length = (blob[pos] << 16) | (blob[pos + 1] << 8) | blob[pos + 2]
+        cmd = blob[pos + 3]
+        if length < 8 or (pos + length) > len(blob) or (length - 8) % 4:
+            raise ValueError("bad sequence length %d at offset %d" % (length, pos))
+        if cmd != SPI_MEM_WR_BLK_ADDR_LONG:
+            raise ValueError("unsupported SPI command 0x%02X at offset %d" % (cmd, pos))
+        addr = int.from_bytes(blob[pos + 4:pos + 8], 'big')
+        seqs.append((addr, blob[pos + 8:pos + length]))
+        pos += length
+    return seqs
+
+
+def merge_seq(seqs):
+    """ Merge the consecutive sequences with contiguous address """
+    out = []
+    for addr, data in seqs:
+        if out and (out[-1][0] + len(out[-1][1])) == addr:
+            out[-1] = (out[-1][0], out[-1][1] + data)
+        else:
+            out.append((addr, data))
+    return out
+
+
+def words(seqs):
+    """ Return the {address : word} memory map of the sequences """
+    mem = {}
+    for addr, data in seqs:
+        for i in range(0, len(data), 4):
+            mem[addr + i] = data[i:i + 4]
+    return mem
+
+
+def delta_seq(seqs, base, gap):
+    """ Return the sequences writing only the words of seqs that differ from base.
+        Runs separated by up to "gap" identical words are joined (a new SPI frame
+        costs 8 more bytes, plus the chip select toggling). """
+    new = words(seqs)
+    old = words(base)
+    missing = sorted(set(old) - set(new))
+    if missing:
+        raise ValueError("base configuration writes @%08X, not restored by input" % missing[0])
+    diff = sorted(a for a in new if old.get(a) != new[a])
+    out = []
+    for addr in diff:
+        if out:
+            last = out[-1][0] + len(out[-1][1])
+            if addr == last:
+                out[-1] = (out[-1][0], out[-1][1] + new[addr])
+                continue
+            if addr - last <= gap * 4 and all(a in new for a in range(last, addr, 4)):
+                fill = b"".join(new[a] for a in range(last, addr + 4, 4))
+                out[-1] = (out[-1][0], out[-1][1] + fill)
+                continue
+        out.append((addr, new[addr]))
+    return out
+
+
+def cut_seq(seqs, max_frame):
+    """ Cut the sequences so that each SPI frame (cmd + addr + data) fit """
+    max_data = (max_frame - 5) & ~0x3
+    if max_data <= 0:
+        raise ValueError("max frame size too small")
+    out = []
+    for addr, data in seqs:
+        for i in range(0, len(data), max_data):
+            out.append((addr + i, data[i:i + max_data]))
+    return out
+
+
+def emit(seqs, src_name, dst_name, max_frame, eol, full=None):
+    lines = [
+        "/*",
+        " * %s generated by cfg_img.py from %s" % (dst_name, src_name),
+        " * SPI transaction image (wire order, max frame %d bytes). Do not edit." % max_frame,
+        "*/",
+    ]
+    if full is not None:
+        lines.insert(3, " * Delta image, the full image is %d transactions, %d bytes." % full)
+    total = 0
+    for addr, data in seqs:
+        length = len(data) + 8
+        hdr = [(length >> 16) & 0xFF, (length >> 8) & 0xFF, length & 0xFF,
+               SPI_MEM_WR_BLK_ADDR_LONG] + list(addr.to_bytes(4, 'big'))
+        lines.append("/* @%08X : %d words */" % (addr, len(data) // 4))
+        lines.append("\t\t" + ", ".join("0x%02X" % b for b in hdr) + ",")
+        for i in range(0, len(data), 8):
+            lines.append("\t\t" + ", ".join("0x%02X" % b for b in data[i:i + 8]) + ",")
+        total += length
+    lines.append("/* %d transactions, %d bytes, %d bytes on SPI */" % (len(seqs), total, total - 3 * len(seqs)))
+    return eol.join(lines) + eol
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("input", help="ADI *.cfg file")
+    parser.add_argument("output", help="SPI transaction image file")
+    parser.add_argument("-m", "--max-frame", type=int, default=DEFAULT_MAX_FRAME,
+                        help="maximum SPI frame size in bytes (default %d)" % DEFAULT_MAX_FRAME)
+    parser.add_argument("--no-merge", action="store_true",
+                        help="don't merge contiguous sequences")
+    parser.add_argument("-b", "--base",
+                        help="base *.cfg file, to produce a delta image")
+    parser.add_argument("-g", "--gap", type=int, default=1,
+                        help="identical words allowed inside a delta frame (default 1)")
+    args = parser.parse_args()
+
+    with open(args.input, newline='') as f:
+        text = f.read()
+    eol = "\r\n" if "\r\n" in text else "\n"
+    try:
+        seqs = split_seq(parse_cfg(text))
+    except ValueError as e:
+        sys.exit("%s: %s" % (args.input, e))
+    if not args.no_merge:
+        seqs = merge_seq(seqs)
+    full = None
+    src_name = os.path.basename(args.input)
+    if args.base:
+        full_seqs = cut_seq(seqs, args.max_frame)
+        full = (len(full_seqs), sum(len(d) + 8 for _, d in full_seqs))
+        try:
+            with open(args.base, newline='') as f:
+                base = split_seq(parse_cfg(f.read()))
+            seqs = delta_seq(seqs, base, args.gap)
+        except ValueError as e:
+            sys.exit("%s: %s" % (args.base, e))
+        src_name = "%s (base %s)" % (src_name, os.path.basename(args.base))
+    seqs = cut_seq(seqs, args.max_frame)
+
+    with open(args.output, "w", newline='') as f:
+        f.write(emit(seqs, src_name, os.path.basename(args.output),
+                     args.max_frame, eol, full))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Decode the ADF7030-1 error codes of a firmware built with USE_PHY_LOG_CODE.
+
+On target, the error messages are replaced by their code : "#Ixx" for a host
+driver instance error (adf7030_1_res_e), "#Pxx" for a PHY Radio hardware
+error (MISC_FW ERR_CODE), both in hexadecimal. The descriptions come from the
+same list as the firmware strings (adf7030-1_phy_log_tbl.h), or from a decoder
+table previously generated with "-o".
+
+Usage :
+    phy_err_decode.py [-t TABLE] -o phy_err_codes.csv
+        generate the decoder table (CSV : kind, code, name, description)
+    phy_err_decode.py [-t TABLE] -c CODE [-c CODE ...]
+        decode the given codes (e.g. "#I0A", "P11")
+    phy_err_decode.py [-t TABLE] [LOG ...]
+        copy the log files (or stdin) to stdout, each code followed by its
+        name and description
+"""
+
+import argparse
+import csv
+import os
+import re
+import sys
+
+DEFAULT_TABLE = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    '..', '..', 'sources', 'device', 'Adf7030', 'include', 'adf7030-1_phy_log_tbl.h')
+
+KINDS = {'INST': 'I', 'PHY': 'P'}
+
+ENTRY_RE = re.compile(
+    r'^\s*PHY_LOG_(INST|PHY)_ERR\(\s*(0x[0-9A-Fa-f]+)\s*,\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)',
+    re.M)
+CODE_RE = re.compile(r'#?([IP])([0-9A-Fa-f]{2})\b')
+LOG_CODE_RE = re.compile(r'#([IP])([0-9A-Fa-f]{2})\b')
+
+
+def load_table(path):
+    """ Return the {(kind, code) : (name, description)} dictionary """
+    table = {}
+    with open(path, newline='') as f:
+        if path.endswith('.csv'):
+            for row in csv.DictReader(f):
+                table[(row['kind'], int(row['code'], 16))] = (row['name'], row['description'])
+        else:
+            for kind, code, name, desc in ENTRY_RE.findall(f.read()):
+                table[(KINDS[kind], int(code, 16))] = (name, desc.strip())
+    if not table:
+        raise ValueError("no error code found in %s" % path)
+    return table
+
+
+def write_table(table, path):
+    """ Write the decoder table as CSV """
+    with open(path, 'w', newline='') as f:
+        out = csv.writer(f, lineterminator='\n')
+        out.writerow(['kind', 'code', 'name', 'description'])
+        for (kind, code), (name, desc) in sorted(table.items()):
+            out.writerow([kind, '0x%02X' % code, name, desc])
+
+
+def decode(table, kind, code):
+    """ Return the "NAME -> description" string of a code """
+    kind = kind.upper()
+    if (kind, code) in table:
+        return "%s -> %s" % table[(kind, code)]
+    if kind == 'P' and code == 0xFF:
+        return "HW_ERROR -> undetermined !"
+    return "unknown %s error 0x%02X" % ('instance' if kind == 'I' else 'PHY', code)
+
+
+def decode_line(table, line):
+    """ Append the description after each code of a log line """
+    return LOG_CODE_RE.sub(
+        lambda m: "%s (%s)" % (m.group(0), decode(table, m.group(1), int(m.group(2), 16))),
+        line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-t', '--table', default=DEFAULT_TABLE,
+                        help="error list (*.h) or decoder table (*.csv)")
+    parser.add_argument('-o', '--output', help="generate the decoder table")
+    parser.add_argument('-c', '--code', action='append', default=[],
+                        help="code to decode (e.g. \"#I0A\", \"P11\")")
+    parser.add_argument('log', nargs='*', help="log files (default : stdin)")
+    args = parser.parse_args()
+
+    try:
+        table = load_table(args.table)
+    except (OSError, ValueError, KeyError) as e:
+        sys.stderr.write("%s\n" % e)
+        return 1
+
+    if args.output:
+        write_table(table, args.output)
+        return 0
+
+    if args.code:
+        for c in args.code:
+            m = CODE_RE.fullmatch(c.strip())
+            if not m:
+                sys.stderr.write("invalid code \"%s\"\n" % c)
+                return 1
+            print("%s : %s" % (c, decode(table, m.group(1), int(m.group(2), 16))))
+        return 0
+
+    for path in (args.log or ['-']):
+        f = sys.stdin if path == '-' else open(path, errors='replace')
+        with f:
+            for line in f:
+                sys.stdout.write(decode_line(table, line))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())